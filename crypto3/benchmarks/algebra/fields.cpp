@@ -30,7 +30,12 @@
 #include <ostream>
 #include <fstream>
 #include <chrono>
+#include <functional>
+#include <iomanip>
+#include <random>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -52,6 +57,7 @@
 #include <nil/crypto3/algebra/fields/secp/secp_r1/base_field.hpp>
 #include <nil/crypto3/algebra/fields/secp/secp_r1/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/curve25519/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/detail/arithmetic.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3::algebra;
@@ -198,4 +204,53 @@ BOOST_AUTO_TEST_CASE(field_operation_perf_test_bls12_381_scalar) {
     run_perf_test<nil::crypto3::algebra::fields::bls12_scalar_field<381u>>("bls12_381_scalar");
 }
 
+BOOST_AUTO_TEST_CASE(field_batch_kernels_perf_test_goldilocks64) {
+    using arithmetic = nil::crypto3::algebra::fields::detail::goldilocks64_arithmetic;
+    using word_type = typename arithmetic::word_type;
+    using duration = std::chrono::duration<double, std::nano>;
+
+    // Arrays fit into L1 together, so the timings are of the kernels rather than of the memory.
+    const std::size_t SAMPLES_COUNT = 1024;
+    const std::size_t ITERATIONS = 100000;
+
+    std::mt19937_64 rng(0x601d);
+    std::vector<word_type> a(SAMPLES_COUNT), b(SAMPLES_COUNT), w(SAMPLES_COUNT);
+    for (std::size_t i = 0; i < SAMPLES_COUNT; ++i) {
+        a[i] = rng() % arithmetic::modulus;
+        b[i] = rng() % arithmetic::modulus;
+        w[i] = rng() % arithmetic::modulus;
+    }
+
+    const std::pair<arithmetic::backend_type, std::string> backends[] = {
+        {arithmetic::backend_type::portable, "portable"},
+        {arithmetic::backend_type::avx2, "avx2"},
+        {arithmetic::backend_type::avx512, "avx512"}};
+
+    for (const auto &[backend, backend_name] : backends) {
+        if (!arithmetic::supports(backend)) {
+            std::cout << "Goldilocks backend " << backend_name << " is not supported by the CPU" << std::endl;
+            continue;
+        }
+
+        auto measure = [&](const std::string &operation_name, const std::function<void()> &operation) {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (std::size_t i = 0; i < ITERATIONS; ++i) {
+                operation();
+            }
+            duration elapsed = std::chrono::high_resolution_clock::now() - start;
+            std::cout << "Goldilocks " << backend_name << " " << operation_name << ": " << std::fixed
+                      << std::setprecision(3) << elapsed.count() / (ITERATIONS * SAMPLES_COUNT) << " ns per element"
+                      << std::endl;
+        };
+
+        // The results are fed back into the inputs, so nothing can be optimized out.
+        measure("addition", [&]() { arithmetic::add(backend, a.data(), a.data(), b.data(), SAMPLES_COUNT); });
+        measure("subtraction", [&]() { arithmetic::sub(backend, a.data(), a.data(), b.data(), SAMPLES_COUNT); });
+        measure("multiplication", [&]() { arithmetic::mul(backend, a.data(), a.data(), b.data(), SAMPLES_COUNT); });
+        measure("butterfly",
+                [&]() { arithmetic::butterfly(backend, a.data(), b.data(), w.data(), SAMPLES_COUNT); });
+    }
+    std::cerr << a[3] << " " << b[3] << std::endl;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE pairing_benchmark
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename Func>
+double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// Compares n reduced pairings multiplied in GT with a single multi-pairing, as done by the KZG verifiers.
+template<typename CurveType>
+void benchmark_multi_pairing(std::string const &curve_name) {
+    using g1_value_type = typename CurveType::template g1_type<>::value_type;
+    using g2_value_type = typename CurveType::template g2_type<>::value_type;
+    using gt_value_type = typename CurveType::gt_type::value_type;
+    using g2_precomputed_type = typename pairing::pairing_policy<CurveType>::g2_precomputed_type;
+
+    std::cout << curve_name << std::endl;
+    std::cout << "pairs\tseparate, ms\tmulti, ms\tmulti cached G2, ms" << std::endl;
+
+    for (std::size_t n = 2; n <= 64; n *= 2) {
+        std::vector<g1_value_type> P;
+        std::vector<g2_value_type> Q;
+        for (std::size_t i = 0; i < n; ++i) {
+            P.push_back(random_element<typename CurveType::template g1_type<>>());
+            Q.push_back(random_element<typename CurveType::template g2_type<>>());
+        }
+        std::vector<g2_precomputed_type> prec_Q;
+        for (const auto &q : Q) {
+            prec_Q.push_back(precompute_g2<CurveType>(q));
+        }
+
+        gt_value_type separate = gt_value_type::one();
+        double separate_ms = measure_ms([&]() {
+            for (std::size_t i = 0; i < n; ++i) {
+                separate = separate * *pair_reduced<CurveType>(P[i], Q[i]);
+            }
+        });
+
+        std::optional<gt_value_type> multi, multi_cached;
+        double multi_ms = measure_ms([&]() { multi = multi_pair_reduced<CurveType>(P, Q); });
+        double multi_cached_ms = measure_ms([&]() { multi_cached = multi_pair_reduced<CurveType>(P, prec_Q); });
+
+        BOOST_CHECK(multi && *multi == separate);
+        BOOST_CHECK(multi_cached && *multi_cached == separate);
+
+        std::cout << n << "\t" << separate_ms << "\t" << multi_ms << "\t" << multi_cached_ms << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(pairing_benchmark)
+
+BOOST_AUTO_TEST_CASE(bls12_381) {
+    benchmark_multi_pairing<curves::bls12<381>>("BLS12-381");
+}
+
+BOOST_AUTO_TEST_CASE(alt_bn128_254) {
+    benchmark_multi_pairing<curves::alt_bn128<254>>("BN254");
+}
+
+BOOST_AUTO_TEST_CASE(mnt4_298) {
+    benchmark_multi_pairing<curves::mnt4<298>>("MNT4-298");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
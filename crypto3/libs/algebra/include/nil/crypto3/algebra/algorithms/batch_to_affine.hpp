@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_TO_AFFINE_HPP
+#define CRYPTO3_ALGEBRA_BATCH_TO_AFFINE_HPP
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/algorithms/run_in_chunks.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Converts projective or jacobian points to affine coordinates with Montgomery's trick: the Z coordinates
+             * of a chunk are inverted together with a single field inversion and three multiplications per point.
+             * Points with Z = 1 are copied as they are. With threads > 1 the chunks are converted in parallel.
+             */
+            template<typename InputIterator>
+            std::vector<decltype(std::declval<typename std::iterator_traits<InputIterator>::value_type>().to_affine())>
+                batch_to_affine(InputIterator first, InputIterator last, std::size_t threads = 1) {
+
+                using point_type = typename std::iterator_traits<InputIterator>::value_type;
+                using affine_type = decltype(std::declval<point_type>().to_affine());
+                using field_value_type = typename point_type::field_type::value_type;
+
+                const std::size_t n = std::distance(first, last);
+                std::vector<affine_type> result(n);
+
+                run_in_chunks<bool>(n, threads, [&first, &result](std::size_t begin, std::size_t end) {
+                    // prefix[i] is the product of the Z coordinates of the points in [begin, i) that need an inversion.
+                    std::vector<field_value_type> prefix(end - begin);
+                    field_value_type acc = field_value_type::one();
+                    for (std::size_t i = begin; i < end; ++i) {
+                        const point_type &point = first[i];
+                        if (point.is_zero() || point.Z == field_value_type::one()) {
+                            continue;
+                        }
+                        prefix[i - begin] = acc;
+                        acc *= point.Z;
+                    }
+
+                    field_value_type acc_inversed = acc.inversed();
+                    for (std::size_t i = end; i > begin; --i) {
+                        const point_type &point = first[i - 1];
+                        if (point.is_zero()) {
+                            continue;
+                        }
+                        if (point.Z == field_value_type::one()) {
+                            result[i - 1] = affine_type(point.X, point.Y);
+                            continue;
+                        }
+                        result[i - 1] = point.to_affine(acc_inversed * prefix[i - 1 - begin]);
+                        acc_inversed *= point.Z;
+                    }
+                    return true;
+                });
+
+                return result;
+            }
+
+            template<typename InputRange>
+            std::vector<decltype(std::declval<typename InputRange::value_type>().to_affine())>
+                batch_to_affine(const InputRange &points, std::size_t threads = 1) {
+                return batch_to_affine(std::begin(points), std::end(points), threads);
+            }
+
+            /**
+             * Brings the points to Z = 1 in place, using a single inversion per chunk. Fixed bases, like commitment keys,
+             * are normalized once, so that multi-exponentiations over them can use mixed additions without
+             * converting the bases again.
+             */
+            template<typename InputRange>
+            void batch_normalize(InputRange &points, std::size_t threads = 1) {
+                using point_type = typename InputRange::value_type;
+
+                auto affine_points = batch_to_affine(points, threads);
+                auto it = std::begin(points);
+                for (std::size_t i = 0; i < affine_points.size(); ++i, ++it) {
+                    if (!it->is_zero()) {
+                        *it = point_type::from_affine(affine_points[i]);
+                    }
+                }
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_TO_AFFINE_HPP
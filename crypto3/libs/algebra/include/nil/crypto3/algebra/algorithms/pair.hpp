@@ -29,6 +29,9 @@
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 #include <optional>
+#include <vector>
+
+#include <boost/assert.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -104,6 +107,56 @@ namespace nil {
 
                 return PairingPolicy::miller_loop::process(prec_P, prec_Q);
             }
+
+            /**
+             * Product of the Miller loops of the pairs (prec_P[i], prec_Q[i]). The pairs share the squarings of a
+             * single loop. The policy loop also takes a range of the pairs, so parallel callers can split the pairs
+             * into chunks on their own executor and multiply the results.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                multi_miller_loop(const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                                  const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q) {
+                BOOST_ASSERT(prec_P.size() == prec_Q.size());
+                return PairingPolicy::multi_miller_loop::process(prec_P, prec_Q, 0, prec_P.size());
+            }
+
+            /**
+             * Reduced pairing product e(P[0], Q[0]) * ... * e(P[n-1], Q[n-1]) with a single final exponentiation.
+             * G2 points are taken precomputed, so callers can cache the line coefficients of fixed G2 points, like the
+             * generator or a verification key, with precompute_g2.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            std::optional<typename PairingCurveType::gt_type::value_type>
+                multi_pair_reduced(const std::vector<typename PairingCurveType::template g1_type<>::value_type> &P,
+                                   const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q) {
+                BOOST_ASSERT(P.size() == prec_Q.size());
+
+                std::vector<typename PairingPolicy::g1_precomputed_type> prec_P;
+                prec_P.reserve(P.size());
+                for (const auto &p : P) {
+                    prec_P.push_back(PairingPolicy::precompute_g1::process(p));
+                }
+
+                return PairingPolicy::final_exponentiation::process(
+                    multi_miller_loop<PairingCurveType, PairingPolicy>(prec_P, prec_Q));
+            }
+
+            // Same as above, the line coefficients of all the G2 points are computed here.
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            std::optional<typename PairingCurveType::gt_type::value_type>
+                multi_pair_reduced(const std::vector<typename PairingCurveType::template g1_type<>::value_type> &P,
+                                   const std::vector<typename PairingCurveType::template g2_type<>::value_type> &Q) {
+                BOOST_ASSERT(P.size() == Q.size());
+
+                std::vector<typename PairingPolicy::g2_precomputed_type> prec_Q;
+                prec_Q.reserve(Q.size());
+                for (const auto &q : Q) {
+                    prec_Q.push_back(PairingPolicy::precompute_g2::process(q));
+                }
+
+                return multi_pair_reduced<PairingCurveType, PairingPolicy>(P, prec_Q);
+            }
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
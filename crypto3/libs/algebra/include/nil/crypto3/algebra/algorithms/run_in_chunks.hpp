@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_ALGORITHMS_RUN_IN_CHUNKS_HPP
+#define CRYPTO3_ALGEBRA_ALGORITHMS_RUN_IN_CHUNKS_HPP
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /**
+             * Runs func(begin, end) over at most 'threads' consecutive chunks of [0, n) and returns the results in
+             * the order of the chunks. threads = 0 uses all the hardware threads.
+             *
+             * The chunks are run with std::async. The thread pool of parallel-crypto3 (parallelization-utils) is
+             * not part of the crypto3 build, so the algorithms here and in blueprint share this helper instead.
+             */
+            template<typename ReturnType, typename Func>
+            std::vector<ReturnType> run_in_chunks(std::size_t n, std::size_t threads, Func func) {
+                if (threads == 0) {
+                    threads = std::thread::hardware_concurrency();
+                }
+                threads = std::max<std::size_t>(1, std::min(threads, n));
+                if (threads == 1) {
+                    return {func(0, n)};
+                }
+
+                std::vector<std::future<ReturnType>> futures;
+                for (std::size_t t = 0; t < threads; ++t) {
+                    std::size_t begin = n * t / threads;
+                    std::size_t end = n * (t + 1) / threads;
+                    futures.push_back(std::async(std::launch::async, func, begin, end));
+                }
+                std::vector<ReturnType> results;
+                for (auto &future : futures) {
+                    results.push_back(future.get());
+                }
+                return results;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_ALGORITHMS_RUN_IN_CHUNKS_HPP
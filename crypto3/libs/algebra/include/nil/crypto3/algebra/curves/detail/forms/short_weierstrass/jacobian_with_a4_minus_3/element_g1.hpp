@@ -216,7 +216,26 @@ namespace nil {
 
                             auto Zi = Z.inversed();
 
-                            return result_type(X * Zi * Zi, Y * Zi * Zi);    //  x=X/Z^2, y=Y/Z^3
+                            return result_type(X * Zi * Zi, Y * Zi * Zi * Zi);    //  x=X/Z^2, y=Y/Z^3
+                        }
+
+                        /** @brief
+                         *
+                         * @param Z_inversed the inverse of Z, e.g. computed for a batch of points at once
+                         * @return return the corresponding element from jacobian_with_a4_minus_3 coordinates to
+                         * affine coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::affine>
+                            to_affine(const field_value_type &Z_inversed) const {
+
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            field_value_type Zi2 = Z_inversed.squared();
+                            return result_type(X * Zi2, Y * Zi2 * Z_inversed);    //  x=X/Z^2, y=Y/Z^3
                         }
 
                         /** @brief
@@ -335,6 +354,32 @@ namespace nil {
 
                             mixed_addition_processor::process(*this, other);
                         }
+
+                        /** @brief
+                         *
+                         * Mixed addition of an element in affine coordinates, which is cheaper than the addition
+                         * of two jacobian_with_a4_minus_3 elements. Unlike madd-2007-bl alone, handles the addition of equal points.
+                         */
+                        constexpr void mixed_add(const curve_element<params_type, form, curves::coordinates::affine> &other) {
+
+                            if (other.is_zero()) {
+                                return;
+                            }
+
+                            if (this->is_zero()) {
+                                *this = from_affine(other);
+                                return;
+                            }
+
+                            mixed_addition_processor::process(*this, other);
+
+                            // For equal X coordinates H = 0, so Z3 = 0 and X3 = r^2. If the points were equal,
+                            // r = 0 too and the result has to be recomputed by doubling.
+                            if (this->Z.is_zero() && this->X.is_zero()) {
+                                *this = from_affine(other);
+                                common_doubling_processor::process(*this);
+                            }
+                        }
                     };
 
                     template<typename CurveParams>
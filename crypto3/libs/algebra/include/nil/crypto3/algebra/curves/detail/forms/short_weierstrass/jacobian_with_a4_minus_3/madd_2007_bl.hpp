@@ -39,9 +39,9 @@ namespace nil {
 
                     struct short_weierstrass_element_g1_jacobian_with_a4_minus_3_madd_2007_bl {
 
-                        template<typename ElementType>
+                        template<typename ElementType, typename OtherElementType>
                         constexpr static inline void process(ElementType &first,
-                                                                    const ElementType &second) {
+                                                                    const OtherElementType &second) {
 
                             using field_value_type = typename ElementType::field_type::value_type;
 
@@ -199,6 +199,24 @@ namespace nil {
                             return result_type(X * Z.inversed(), Y * Z.inversed());    //  x=X/Z, y=Y/Z
                         }
 
+                        /** @brief
+                         *
+                         * @param Z_inversed the inverse of Z, e.g. computed for a batch of points at once
+                         * @return return the corresponding element from projective coordinates to
+                         * affine coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::affine>
+                            to_affine(const field_value_type &Z_inversed) const {
+
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            return result_type(X * Z_inversed, Y * Z_inversed);    //  x=X/Z, y=Y/Z
+                        }
+
                         static curve_element from_affine(curve_element<params_type, form, curves::coordinates::affine> const &other) {
                             return curve_element(other.X, other.Y, field_value_type::one());
                         }
@@ -324,6 +342,16 @@ namespace nil {
                             Z = vvv * this->Z;                  // Z3 = vvv*Z1
 
                         }
+
+                        /** @brief
+                         *
+                         * Mixed addition of an element in affine coordinates.
+                         */
+                        constexpr void mixed_add(const curve_element<params_type, form, curves::coordinates::affine> &other) {
+                            if (!other.is_zero()) {
+                                mixed_add(from_affine(other));
+                            }
+                        }
                     };
 
                     template<typename CurveParams>
@@ -30,6 +30,7 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/detail/arithmetic.hpp>
 
 #include <nil/crypto3/multiprecision/ressol.hpp>
 #include <nil/crypto3/multiprecision/inverse.hpp>
@@ -50,6 +51,10 @@ namespace nil {
                     class element_fp {
                         typedef FieldParams policy_type;
 
+                        // Goldilocks elements fit a single limb, their arithmetic skips the generic modular adaptor.
+                        constexpr static const bool is_goldilocks64 =
+                            std::is_same<typename policy_type::field_type, goldilocks64_base_field>::value;
+
                     public:
                         typedef typename policy_type::field_type field_type;
 
@@ -64,6 +69,15 @@ namespace nil {
                         using data_type = modular_type;
                         data_type data;
 
+                        // The least significant limb of the Montgomery form, the whole value for single-limb fields.
+                        constexpr auto &word() {
+                            return data.backend().base_data().limbs()[0];
+                        }
+
+                        constexpr const auto &word() const {
+                            return data.backend().base_data().limbs()[0];
+                        }
+
                         constexpr element_fp() = default;
 
                         constexpr element_fp(const data_type &data) : data(data) {}
@@ -113,27 +127,51 @@ namespace nil {
                         }
 
                         constexpr element_fp operator+(const element_fp &B) const {
-                            return element_fp(data + B.data);
+                            if constexpr (is_goldilocks64) {
+                                element_fp result(*this);
+                                result.word() = goldilocks64_arithmetic::add(word(), B.word());
+                                return result;
+                            } else {
+                                return element_fp(data + B.data);
+                            }
                         }
 
                         constexpr element_fp operator-(const element_fp &B) const {
-                            return element_fp(data - B.data);
+                            if constexpr (is_goldilocks64) {
+                                element_fp result(*this);
+                                result.word() = goldilocks64_arithmetic::sub(word(), B.word());
+                                return result;
+                            } else {
+                                return element_fp(data - B.data);
+                            }
                         }
 
                         constexpr element_fp &operator-=(const element_fp &B) {
-                            data -= B.data;
+                            if constexpr (is_goldilocks64) {
+                                word() = goldilocks64_arithmetic::sub(word(), B.word());
+                            } else {
+                                data -= B.data;
+                            }
 
                             return *this;
                         }
 
                         constexpr element_fp &operator+=(const element_fp &B) {
-                            data += B.data;
+                            if constexpr (is_goldilocks64) {
+                                word() = goldilocks64_arithmetic::add(word(), B.word());
+                            } else {
+                                data += B.data;
+                            }
 
                             return *this;
                         }
 
                         constexpr element_fp &operator*=(const element_fp &B) {
-                            data *= B.data;
+                            if constexpr (is_goldilocks64) {
+                                word() = goldilocks64_arithmetic::mul(word(), B.word());
+                            } else {
+                                data *= B.data;
+                            }
 
                             return *this;
                         }
@@ -144,11 +182,21 @@ namespace nil {
                         }
 
                         constexpr element_fp operator-() const {
-                            return element_fp(-data);
+                            if constexpr (is_goldilocks64) {
+                                element_fp result(*this);
+                                result.word() = goldilocks64_arithmetic::neg(word());
+                                return result;
+                            } else {
+                                return element_fp(-data);
+                            }
                         }
 
                         constexpr void negate_inplace() {
-                            data = -data;
+                            if constexpr (is_goldilocks64) {
+                                word() = goldilocks64_arithmetic::neg(word());
+                            } else {
+                                data = -data;
+                            }
                         }
 
                         constexpr element_fp operator/(const element_fp &B) const {
@@ -157,7 +205,13 @@ namespace nil {
                         }
 
                         constexpr element_fp operator*(const element_fp &B) const {
-                            return element_fp(data * B.data);
+                            if constexpr (is_goldilocks64) {
+                                element_fp result(*this);
+                                result.word() = goldilocks64_arithmetic::mul(word(), B.word());
+                                return result;
+                            } else {
+                                return element_fp(data * B.data);
+                            }
                         }
 
                         constexpr bool operator<(const element_fp &B) const {
@@ -199,11 +253,21 @@ namespace nil {
                         }
 
                         constexpr element_fp doubled() const {
-                            return element_fp(data + data);
+                            if constexpr (is_goldilocks64) {
+                                element_fp result(*this);
+                                result.word() = goldilocks64_arithmetic::add(word(), word());
+                                return result;
+                            } else {
+                                return element_fp(data + data);
+                            }
                         }
 
                         constexpr void double_inplace() {
-                            data += data;
+                            if constexpr (is_goldilocks64) {
+                                word() = goldilocks64_arithmetic::add(word(), word());
+                            } else {
+                                data += data;
+                            }
                         }
 
                         // If the element does not have a square root, this function must not be called.
@@ -221,11 +285,21 @@ namespace nil {
                         }
 
                         constexpr element_fp squared() const {
-                            return element_fp(data * data);    // maybe can be done more effective
+                            if constexpr (is_goldilocks64) {
+                                element_fp result(*this);
+                                result.word() = goldilocks64_arithmetic::square(word());
+                                return result;
+                            } else {
+                                return element_fp(data * data);    // maybe can be done more effective
+                            }
                         }
 
                         constexpr element_fp& square_inplace() {
-                            data *= data;
+                            if constexpr (is_goldilocks64) {
+                                word() = goldilocks64_arithmetic::square(word());
+                            } else {
+                                data *= data;
+                            }
                             return *this;
                         }
 
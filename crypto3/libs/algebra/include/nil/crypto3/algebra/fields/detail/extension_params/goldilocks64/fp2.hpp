@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_FP2_EXTENSION_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_FP2_EXTENSION_PARAMS_HPP
+
+#include <nil/crypto3/algebra/fields/params.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+
+                template<typename BaseField>
+                class fp2;
+
+                namespace detail {
+
+                    template<typename BaseField>
+                    class fp2_extension_params;
+
+                    /************************* GOLDILOCKS64 ***********************************/
+
+                    // Quadratic extension Fp[u] / (u^2 - 7) of the Goldilocks field, 7 is a quadratic non-residue.
+                    template<>
+                    class fp2_extension_params<goldilocks64_base_field> : public params<goldilocks64_base_field> {
+
+                        typedef goldilocks64_base_field base_field_type;
+                        typedef params<base_field_type> policy_type;
+
+                    public:
+                        using field_type = fields::fp2<base_field_type>;
+
+                        typedef typename policy_type::integral_type integral_type;
+
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<2 * policy_type::modulus_bits>>
+                            extended_integral_type;
+
+                        constexpr static const integral_type modulus = policy_type::modulus;
+
+                        typedef base_field_type non_residue_field_type;
+                        typedef typename non_residue_field_type::value_type non_residue_type;
+                        typedef base_field_type underlying_field_type;
+                        typedef typename underlying_field_type::value_type underlying_type;
+
+                        constexpr static const std::size_t s = 0x21;
+                        constexpr static const extended_integral_type t =
+                            0x7FFFFFFF000000017FFFFFFF_cppui_modular128;
+                        constexpr static const extended_integral_type t_minus_1_over_2 =
+                            0x3FFFFFFF80000000BFFFFFFF_cppui_modular128;
+                        constexpr static const std::array<integral_type, 2> nqr = {0x00, 0x01};
+                        constexpr static const std::array<integral_type, 2> nqr_to_t = {
+                            0x00, 0x076DE30B51A3F645_cppui_modular64};
+
+                        constexpr static const extended_integral_type group_order_minus_one_half =
+                            0x7FFFFFFF000000017FFFFFFF00000000_cppui_modular128;
+
+                        constexpr static const std::array<integral_type, 2> Frobenius_coeffs_c1 = {
+                            0x01, 0xFFFFFFFF00000000_cppui_modular64};
+
+                        constexpr static const non_residue_type non_residue = non_residue_type(0x07u);
+                    };
+
+                    constexpr typename fp2_extension_params<goldilocks64_base_field>::non_residue_type const
+                        fp2_extension_params<goldilocks64_base_field>::non_residue;
+
+                    constexpr std::size_t const fp2_extension_params<goldilocks64_base_field>::s;
+
+                    constexpr typename fp2_extension_params<goldilocks64_base_field>::extended_integral_type const
+                        fp2_extension_params<goldilocks64_base_field>::t;
+
+                    constexpr typename fp2_extension_params<goldilocks64_base_field>::extended_integral_type const
+                        fp2_extension_params<goldilocks64_base_field>::t_minus_1_over_2;
+
+                    constexpr std::array<typename fp2_extension_params<goldilocks64_base_field>::integral_type, 2> const
+                        fp2_extension_params<goldilocks64_base_field>::nqr;
+
+                    constexpr std::array<typename fp2_extension_params<goldilocks64_base_field>::integral_type, 2> const
+                        fp2_extension_params<goldilocks64_base_field>::nqr_to_t;
+
+                    constexpr typename fp2_extension_params<goldilocks64_base_field>::extended_integral_type const
+                        fp2_extension_params<goldilocks64_base_field>::group_order_minus_one_half;
+
+                    constexpr std::array<typename fp2_extension_params<goldilocks64_base_field>::integral_type, 2> const
+                        fp2_extension_params<goldilocks64_base_field>::Frobenius_coeffs_c1;
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_FP2_EXTENSION_PARAMS_HPP
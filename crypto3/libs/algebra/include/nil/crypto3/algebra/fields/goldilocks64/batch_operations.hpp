@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BATCH_OPERATIONS_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BATCH_OPERATIONS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/detail/arithmetic.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                // True if the batch operations below can be used on elements of type T.
+                template<typename T>
+                constexpr bool is_goldilocks64_element = std::is_same<T, typename goldilocks64_base_field::value_type>::value;
+
+                /**
+                 * Element-wise operations over contiguous arrays of Goldilocks elements. The Montgomery words of
+                 * the elements are processed in blocks by the kernels of goldilocks64_arithmetic, which use AVX2
+                 * or AVX-512 when the CPU supports them. All the arrays may alias.
+                 */
+                struct goldilocks64_batch_operations {
+                    using value_type = typename goldilocks64_base_field::value_type;
+                    using arithmetic = detail::goldilocks64_arithmetic;
+                    using word_type = typename arithmetic::word_type;
+
+                    // dst[i] = a[i] + b[i]
+                    static void add(value_type *dst, const value_type *a, const value_type *b, std::size_t n) {
+                        apply(dst, a, b, n, [](word_type *x, const word_type *y, std::size_t size) {
+                            arithmetic::add(x, x, y, size);
+                        });
+                    }
+
+                    // dst[i] = a[i] - b[i]
+                    static void sub(value_type *dst, const value_type *a, const value_type *b, std::size_t n) {
+                        apply(dst, a, b, n, [](word_type *x, const word_type *y, std::size_t size) {
+                            arithmetic::sub(x, x, y, size);
+                        });
+                    }
+
+                    // dst[i] = a[i] * b[i]
+                    static void mul(value_type *dst, const value_type *a, const value_type *b, std::size_t n) {
+                        apply(dst, a, b, n, [](word_type *x, const word_type *y, std::size_t size) {
+                            arithmetic::mul(x, x, y, size);
+                        });
+                    }
+
+                    /**
+                     * Radix-2 butterflies (lo[i], hi[i]) = (lo[i] + w * hi[i], lo[i] - w * hi[i]), where
+                     * w = twiddles[i * twiddle_stride].
+                     */
+                    static void butterfly(value_type *lo, value_type *hi, const value_type *twiddles,
+                                          std::size_t twiddle_stride, std::size_t n) {
+                        std::array<word_type, block_size> lo_words, hi_words, twiddle_words;
+                        for (std::size_t begin = 0; begin < n; begin += block_size) {
+                            const std::size_t size = std::min(block_size, n - begin);
+                            for (std::size_t i = 0; i < size; ++i) {
+                                lo_words[i] = lo[begin + i].word();
+                                hi_words[i] = hi[begin + i].word();
+                                twiddle_words[i] = twiddles[(begin + i) * twiddle_stride].word();
+                            }
+                            arithmetic::butterfly(lo_words.data(), hi_words.data(), twiddle_words.data(), size);
+                            for (std::size_t i = 0; i < size; ++i) {
+                                lo[begin + i].word() = lo_words[i];
+                                hi[begin + i].word() = hi_words[i];
+                            }
+                        }
+                    }
+
+                private:
+                    // Elements are wider than their words, so the words are copied to contiguous blocks for the kernels.
+                    constexpr static const std::size_t block_size = 256;
+
+                    template<typename Kernel>
+                    static void apply(value_type *dst, const value_type *a, const value_type *b, std::size_t n,
+                                      Kernel kernel) {
+                        std::array<word_type, block_size> a_words, b_words;
+                        for (std::size_t begin = 0; begin < n; begin += block_size) {
+                            const std::size_t size = std::min(block_size, n - begin);
+                            for (std::size_t i = 0; i < size; ++i) {
+                                a_words[i] = a[begin + i].word();
+                                b_words[i] = b[begin + i].word();
+                            }
+                            kernel(a_words.data(), b_words.data(), size);
+                            for (std::size_t i = 0; i < size; ++i) {
+                                dst[begin + i].word() = a_words[i];
+                            }
+                        }
+                    }
+                };
+            }    // namespace fields
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_BATCH_OPERATIONS_HPP
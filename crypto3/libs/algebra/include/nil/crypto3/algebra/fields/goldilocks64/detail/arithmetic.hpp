@@ -0,0 +1,433 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_ARITHMETIC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                class goldilocks64_base_field;
+
+                namespace detail {
+#ifdef CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+                    /**
+                     * Instruction set extensions the Goldilocks batch kernels may use, detected once per process.
+                     */
+                    struct goldilocks64_x86_64_features {
+                        bool avx2;
+                        bool avx512f;
+
+                        static const goldilocks64_x86_64_features &get() {
+                            static const goldilocks64_x86_64_features features = detect();
+                            return features;
+                        }
+
+                    private:
+                        static goldilocks64_x86_64_features detect() {
+                            __builtin_cpu_init();
+                            // __builtin_cpu_supports also checks that the OS saves the YMM/ZMM state.
+                            return {static_cast<bool>(__builtin_cpu_supports("avx2")),
+                                    static_cast<bool>(__builtin_cpu_supports("avx512f"))};
+                        }
+                    };
+#endif
+
+                    /**
+                     * Arithmetic modulo p = 2^64 - 2^32 + 1 on single 64-bit words. Values are canonical (less than p)
+                     * and kept in the Montgomery form with R = 2^64, the same representation as the one stored by
+                     * element_fp, so the words can be read from and written to field elements directly.
+                     * Since p^-1 = 2^32 + 1 mod 2^64, the Montgomery reduction needs only shifts, additions and
+                     * subtractions after a single 64x64 multiplication.
+                     */
+                    struct goldilocks64_arithmetic {
+                        using word_type = std::uint64_t;
+
+                        constexpr static const word_type modulus = 0xFFFFFFFF00000001ull;
+                        // 2^64 mod p.
+                        constexpr static const word_type epsilon = 0xFFFFFFFFull;
+
+                        constexpr static inline word_type add(word_type a, word_type b) {
+                            word_type sum = a + b;
+                            // On overflow 2^64 = epsilon mod p, the sum then stays below p.
+                            sum += (sum < a) ? epsilon : 0;
+                            return sum >= modulus ? sum - modulus : sum;
+                        }
+
+                        constexpr static inline word_type sub(word_type a, word_type b) {
+                            word_type diff = a - b;
+                            // On borrow the difference is off by 2^64, adding p is subtracting epsilon.
+                            return (a < b) ? diff - epsilon : diff;
+                        }
+
+                        constexpr static inline word_type neg(word_type a) {
+                            return a == 0 ? 0 : modulus - a;
+                        }
+
+                        // Returns x / 2^64 mod p for x < p * 2^64.
+                        constexpr static inline word_type montgomery_reduce(word_type x_lo, word_type x_hi) {
+                            // m = x_lo * p^-1 mod 2^64, then (x - m * p) / 2^64 = x_hi - hi(m * p).
+                            word_type m = x_lo + (x_lo << 32);
+                            word_type carry = m < x_lo ? 1 : 0;
+                            word_type mp_hi = m - (m >> 32) - carry;
+                            word_type result = x_hi - mp_hi;
+                            result -= (x_hi < mp_hi) ? epsilon : 0;
+                            return result >= modulus ? result - modulus : result;
+                        }
+
+                        constexpr static inline word_type mul(word_type a, word_type b) {
+                            unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+                            return montgomery_reduce(static_cast<word_type>(product),
+                                                     static_cast<word_type>(product >> 64));
+                        }
+
+                        constexpr static inline word_type square(word_type a) {
+                            return mul(a, a);
+                        }
+
+                        /*************************  Batch kernels  ***********************************/
+
+                        /**
+                         * Implementations of the batch kernels. The vector ones are compiled under target
+                         * attributes, so no global -m flags are needed, and are only run when the CPU supports them.
+                         */
+                        enum class backend_type { portable, avx2, avx512 };
+
+                        static inline bool supports(backend_type backend) {
+                            switch (backend) {
+#ifdef CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+                                case backend_type::avx2:
+                                    return goldilocks64_x86_64_features::get().avx2;
+                                case backend_type::avx512:
+                                    return goldilocks64_x86_64_features::get().avx512f;
+#endif
+                                case backend_type::portable:
+                                    return true;
+                                default:
+                                    return false;
+                            }
+                        }
+
+                        // The widest backend the CPU supports.
+                        static inline backend_type backend() {
+                            static const backend_type best = supports(backend_type::avx512) ? backend_type::avx512 :
+                                                             supports(backend_type::avx2)   ? backend_type::avx2 :
+                                                                                              backend_type::portable;
+                            return best;
+                        }
+
+                        // dst[i] = a[i] + b[i], the arrays may alias.
+                        static void add(word_type *dst, const word_type *a, const word_type *b, std::size_t n) {
+                            add(backend(), dst, a, b, n);
+                        }
+
+                        static void add(backend_type backend, word_type *dst, const word_type *a, const word_type *b,
+                                        std::size_t n) {
+                            std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+                            if (backend == backend_type::avx512) {
+                                i = add_avx512(dst, a, b, n);
+                            } else if (backend == backend_type::avx2) {
+                                i = add_avx2(dst, a, b, n);
+                            }
+#endif
+                            for (; i < n; ++i) {
+                                dst[i] = add(a[i], b[i]);
+                            }
+                        }
+
+                        // dst[i] = a[i] - b[i], the arrays may alias.
+                        static void sub(word_type *dst, const word_type *a, const word_type *b, std::size_t n) {
+                            sub(backend(), dst, a, b, n);
+                        }
+
+                        static void sub(backend_type backend, word_type *dst, const word_type *a, const word_type *b,
+                                        std::size_t n) {
+                            std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+                            if (backend == backend_type::avx512) {
+                                i = sub_avx512(dst, a, b, n);
+                            } else if (backend == backend_type::avx2) {
+                                i = sub_avx2(dst, a, b, n);
+                            }
+#endif
+                            for (; i < n; ++i) {
+                                dst[i] = sub(a[i], b[i]);
+                            }
+                        }
+
+                        // dst[i] = a[i] * b[i], the arrays may alias.
+                        static void mul(word_type *dst, const word_type *a, const word_type *b, std::size_t n) {
+                            mul(backend(), dst, a, b, n);
+                        }
+
+                        static void mul(backend_type backend, word_type *dst, const word_type *a, const word_type *b,
+                                        std::size_t n) {
+                            std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+                            if (backend == backend_type::avx512) {
+                                i = mul_avx512(dst, a, b, n);
+                            } else if (backend == backend_type::avx2) {
+                                i = mul_avx2(dst, a, b, n);
+                            }
+#endif
+                            for (; i < n; ++i) {
+                                dst[i] = mul(a[i], b[i]);
+                            }
+                        }
+
+                        // Radix-2 butterflies: (lo[i], hi[i]) = (lo[i] + w[i] * hi[i], lo[i] - w[i] * hi[i]).
+                        static void butterfly(word_type *lo, word_type *hi, const word_type *w, std::size_t n) {
+                            butterfly(backend(), lo, hi, w, n);
+                        }
+
+                        static void butterfly(backend_type backend, word_type *lo, word_type *hi, const word_type *w,
+                                              std::size_t n) {
+                            std::size_t i = 0;
+#ifdef CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+                            if (backend == backend_type::avx512) {
+                                i = butterfly_avx512(lo, hi, w, n);
+                            } else if (backend == backend_type::avx2) {
+                                i = butterfly_avx2(lo, hi, w, n);
+                            }
+#endif
+                            for (; i < n; ++i) {
+                                word_type t = mul(hi[i], w[i]);
+                                hi[i] = sub(lo[i], t);
+                                lo[i] = add(lo[i], t);
+                            }
+                        }
+
+                    private:
+#ifdef CRYPTO3_ALGEBRA_GOLDILOCKS64_X86_64_DISPATCH
+                        // The vector kernels process the longest prefix of whole vectors and return its length.
+
+                        __attribute__((target("avx512f"))) static std::size_t add_avx512(word_type *dst,
+                                                                                        const word_type *a,
+                                                                                        const word_type *b,
+                                                                                        std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 8 <= n; i += 8) {
+                                _mm512_storeu_si512(dst + i, add_x8(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                            }
+                            return i;
+                        }
+
+                        __attribute__((target("avx512f"))) static std::size_t sub_avx512(word_type *dst,
+                                                                                        const word_type *a,
+                                                                                        const word_type *b,
+                                                                                        std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 8 <= n; i += 8) {
+                                _mm512_storeu_si512(dst + i, sub_x8(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                            }
+                            return i;
+                        }
+
+                        __attribute__((target("avx512f"))) static std::size_t mul_avx512(word_type *dst,
+                                                                                        const word_type *a,
+                                                                                        const word_type *b,
+                                                                                        std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 8 <= n; i += 8) {
+                                _mm512_storeu_si512(dst + i, mul_x8(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                            }
+                            return i;
+                        }
+
+                        __attribute__((target("avx512f"))) static std::size_t butterfly_avx512(word_type *lo,
+                                                                                              word_type *hi,
+                                                                                              const word_type *w,
+                                                                                              std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 8 <= n; i += 8) {
+                                __m512i u = _mm512_loadu_si512(lo + i);
+                                __m512i t = mul_x8(_mm512_loadu_si512(hi + i), _mm512_loadu_si512(w + i));
+                                _mm512_storeu_si512(lo + i, add_x8(u, t));
+                                _mm512_storeu_si512(hi + i, sub_x8(u, t));
+                            }
+                            return i;
+                        }
+
+                        __attribute__((target("avx2"))) static std::size_t add_avx2(word_type *dst, const word_type *a,
+                                                                                   const word_type *b, std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 4 <= n; i += 4) {
+                                store_x4(dst + i, add_x4(load_x4(a + i), load_x4(b + i)));
+                            }
+                            return i;
+                        }
+
+                        __attribute__((target("avx2"))) static std::size_t sub_avx2(word_type *dst, const word_type *a,
+                                                                                   const word_type *b, std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 4 <= n; i += 4) {
+                                store_x4(dst + i, sub_x4(load_x4(a + i), load_x4(b + i)));
+                            }
+                            return i;
+                        }
+
+                        __attribute__((target("avx2"))) static std::size_t mul_avx2(word_type *dst, const word_type *a,
+                                                                                   const word_type *b, std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 4 <= n; i += 4) {
+                                store_x4(dst + i, mul_x4(load_x4(a + i), load_x4(b + i)));
+                            }
+                            return i;
+                        }
+
+                        __attribute__((target("avx2"))) static std::size_t butterfly_avx2(word_type *lo, word_type *hi,
+                                                                                         const word_type *w,
+                                                                                         std::size_t n) {
+                            std::size_t i = 0;
+                            for (; i + 4 <= n; i += 4) {
+                                __m256i u = load_x4(lo + i);
+                                __m256i t = mul_x4(load_x4(hi + i), load_x4(w + i));
+                                store_x4(lo + i, add_x4(u, t));
+                                store_x4(hi + i, sub_x4(u, t));
+                            }
+                            return i;
+                        }
+
+                        /*************************  AVX-512, 8 words per vector  *********************/
+
+                        __attribute__((target("avx512f"))) static inline __m512i add_x8(__m512i a, __m512i b) {
+                            const __m512i p = _mm512_set1_epi64(modulus);
+                            __m512i sum = _mm512_add_epi64(a, b);
+                            sum = _mm512_mask_add_epi64(sum, _mm512_cmplt_epu64_mask(sum, a), sum,
+                                                        _mm512_set1_epi64(epsilon));
+                            return _mm512_mask_sub_epi64(sum, _mm512_cmpge_epu64_mask(sum, p), sum, p);
+                        }
+
+                        __attribute__((target("avx512f"))) static inline __m512i sub_x8(__m512i a, __m512i b) {
+                            __m512i diff = _mm512_sub_epi64(a, b);
+                            return _mm512_mask_sub_epi64(diff, _mm512_cmplt_epu64_mask(a, b), diff,
+                                                         _mm512_set1_epi64(epsilon));
+                        }
+
+                        __attribute__((target("avx512f"))) static inline __m512i mul_x8(__m512i a, __m512i b) {
+                            const __m512i low_mask = _mm512_set1_epi64(0xFFFFFFFFull);
+                            __m512i a_hi = _mm512_srli_epi64(a, 32);
+                            __m512i b_hi = _mm512_srli_epi64(b, 32);
+
+                            __m512i ll = _mm512_mul_epu32(a, b);
+                            __m512i lh = _mm512_mul_epu32(a, b_hi);
+                            __m512i hl = _mm512_mul_epu32(a_hi, b);
+                            __m512i hh = _mm512_mul_epu32(a_hi, b_hi);
+
+                            __m512i mid = _mm512_add_epi64(lh, _mm512_srli_epi64(ll, 32));
+                            __m512i mid2 = _mm512_add_epi64(hl, _mm512_and_si512(mid, low_mask));
+                            __m512i x_lo = _mm512_or_si512(_mm512_slli_epi64(mid2, 32), _mm512_and_si512(ll, low_mask));
+                            __m512i x_hi = _mm512_add_epi64(
+                                hh, _mm512_add_epi64(_mm512_srli_epi64(mid, 32), _mm512_srli_epi64(mid2, 32)));
+
+                            __m512i m = _mm512_add_epi64(x_lo, _mm512_slli_epi64(x_lo, 32));
+                            __m512i mp_hi = _mm512_sub_epi64(m, _mm512_srli_epi64(m, 32));
+                            mp_hi = _mm512_mask_sub_epi64(mp_hi, _mm512_cmplt_epu64_mask(m, x_lo), mp_hi,
+                                                          _mm512_set1_epi64(1));
+                            __m512i result = _mm512_sub_epi64(x_hi, mp_hi);
+                            result = _mm512_mask_sub_epi64(result, _mm512_cmplt_epu64_mask(x_hi, mp_hi), result,
+                                                           _mm512_set1_epi64(epsilon));
+                            const __m512i p = _mm512_set1_epi64(modulus);
+                            return _mm512_mask_sub_epi64(result, _mm512_cmpge_epu64_mask(result, p), result, p);
+                        }
+
+                        /*************************  AVX2, 4 words per vector  ************************/
+
+                        __attribute__((target("avx2"))) static inline __m256i load_x4(const word_type *ptr) {
+                            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+                        }
+
+                        __attribute__((target("avx2"))) static inline void store_x4(word_type *ptr, __m256i value) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), value);
+                        }
+
+                        // AVX2 has only signed 64-bit comparisons, both sides are shifted by 2^63.
+                        __attribute__((target("avx2"))) static inline __m256i less_than_x4(__m256i a, __m256i b) {
+                            const __m256i sign = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+                            return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+                        }
+
+                        __attribute__((target("avx2"))) static inline __m256i canonical_x4(__m256i a) {
+                            const __m256i p = _mm256_set1_epi64x(static_cast<long long>(modulus));
+                            __m256i below = less_than_x4(a, p);
+                            return _mm256_sub_epi64(a, _mm256_andnot_si256(below, p));
+                        }
+
+                        __attribute__((target("avx2"))) static inline __m256i add_x4(__m256i a, __m256i b) {
+                            const __m256i eps = _mm256_set1_epi64x(static_cast<long long>(epsilon));
+                            __m256i sum = _mm256_add_epi64(a, b);
+                            sum = _mm256_add_epi64(sum, _mm256_and_si256(less_than_x4(sum, a), eps));
+                            return canonical_x4(sum);
+                        }
+
+                        __attribute__((target("avx2"))) static inline __m256i sub_x4(__m256i a, __m256i b) {
+                            const __m256i eps = _mm256_set1_epi64x(static_cast<long long>(epsilon));
+                            __m256i diff = _mm256_sub_epi64(a, b);
+                            return _mm256_sub_epi64(diff, _mm256_and_si256(less_than_x4(a, b), eps));
+                        }
+
+                        __attribute__((target("avx2"))) static inline __m256i mul_x4(__m256i a, __m256i b) {
+                            const __m256i low_mask = _mm256_set1_epi64x(0xFFFFFFFFll);
+                            const __m256i eps = _mm256_set1_epi64x(static_cast<long long>(epsilon));
+                            __m256i a_hi = _mm256_srli_epi64(a, 32);
+                            __m256i b_hi = _mm256_srli_epi64(b, 32);
+
+                            __m256i ll = _mm256_mul_epu32(a, b);
+                            __m256i lh = _mm256_mul_epu32(a, b_hi);
+                            __m256i hl = _mm256_mul_epu32(a_hi, b);
+                            __m256i hh = _mm256_mul_epu32(a_hi, b_hi);
+
+                            __m256i mid = _mm256_add_epi64(lh, _mm256_srli_epi64(ll, 32));
+                            __m256i mid2 = _mm256_add_epi64(hl, _mm256_and_si256(mid, low_mask));
+                            __m256i x_lo = _mm256_or_si256(_mm256_slli_epi64(mid2, 32), _mm256_and_si256(ll, low_mask));
+                            __m256i x_hi = _mm256_add_epi64(
+                                hh, _mm256_add_epi64(_mm256_srli_epi64(mid, 32), _mm256_srli_epi64(mid2, 32)));
+
+                            __m256i m = _mm256_add_epi64(x_lo, _mm256_slli_epi64(x_lo, 32));
+                            // The comparison mask is -1 on carry, adding it subtracts the carry.
+                            __m256i mp_hi = _mm256_add_epi64(_mm256_sub_epi64(m, _mm256_srli_epi64(m, 32)),
+                                                             less_than_x4(m, x_lo));
+                            __m256i result = _mm256_sub_epi64(x_hi, mp_hi);
+                            result = _mm256_sub_epi64(result, _mm256_and_si256(less_than_x4(x_hi, mp_hi), eps));
+                            return canonical_x4(result);
+                        }
+#endif
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_GOLDILOCKS64_ARITHMETIC_HPP
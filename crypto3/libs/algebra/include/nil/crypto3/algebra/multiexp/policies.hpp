@@ -27,12 +27,14 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <type_traits>
 #include <vector>
 
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_to_affine.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -54,6 +56,18 @@ namespace nil {
                             return (this->r < other.r);
                         }
                     };
+
+                    // True if GroupValueType can be converted to affine coordinates and add affine points with mixed_add.
+                    template<typename GroupValueType, typename = void>
+                    struct has_affine_mixed_add : std::false_type {};
+
+                    template<typename GroupValueType>
+                    struct has_affine_mixed_add<
+                        GroupValueType,
+                        std::void_t<decltype(std::declval<GroupValueType &>().mixed_add(
+                                        std::declval<const GroupValueType &>().to_affine())),
+                                    decltype(GroupValueType::from_affine(
+                                        std::declval<const GroupValueType &>().to_affine()))>> : std::true_type {};
                 }    // namespace detail
 
                 /**
@@ -95,6 +109,8 @@ namespace nil {
                  * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
                  * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
                  * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 * If base_value_type supports mixed addition of affine points, the bases are converted to affine
+                 * coordinates once with batch_to_affine and added to the buckets with mixed additions.
                  */
                 struct multiexp_method_BDLO12 {
                     template<typename InputBaseIterator, typename InputFieldIterator>
@@ -129,6 +145,17 @@ namespace nil {
 
                         std::size_t num_groups = (num_bits + c - 1) / c;
 
+                        constexpr bool use_affine_bases = detail::has_affine_mixed_add<base_value_type>::value;
+                        using affine_bases_type = typename std::conditional<
+                            use_affine_bases,
+                            std::vector<decltype(std::declval<base_value_type>().to_affine())>,
+                            std::vector<base_value_type>>::type;
+                        affine_bases_type affine_bases;
+                        if constexpr (use_affine_bases) {
+                            // Every base is added once per group, a single conversion makes all those additions mixed.
+                            affine_bases = batch_to_affine(bases, bases_end);
+                        }
+
                         base_value_type result;
                         bool result_nonzero = false;
 
@@ -154,6 +181,16 @@ namespace nil {
                                     continue;
                                 }
 
+                                if constexpr (use_affine_bases) {
+                                    if (bucket_nonzero[id]) {
+                                        buckets[id].mixed_add(affine_bases[i]);
+                                    } else {
+                                        buckets[id] = base_value_type::from_affine(affine_bases[i]);
+                                        bucket_nonzero[id] = true;
+                                    }
+                                    continue;
+                                }
+
                                 if (bucket_nonzero[id]) {
 #ifdef USE_MIXED_ADDITION
                                     buckets[id].mixed_add(bases[i]);
@@ -36,6 +36,7 @@
 
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0_sbit/ate_double_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0_sbit/ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0_sbit/ate_multi_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0_sbit/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0_sbit/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0_sbit/final_exponentiation.hpp>
@@ -56,6 +57,8 @@ namespace nil {
                     using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_sbit_ate_miller_loop<curve_type>;
                     using double_miller_loop =
                         pairing::short_weierstrass_jacobian_with_a4_0_sbit_ate_double_miller_loop<curve_type>;
+                    using multi_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_sbit_ate_multi_miller_loop<curve_type>;
                     using final_exponentiation =
                         pairing::short_weierstrass_jacobian_with_a4_0_sbit_final_exponentiation<curve_type>;
 
@@ -33,6 +33,7 @@
 #include <nil/crypto3/algebra/pairing/detail/bls12/377/params.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_double_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_multi_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/final_exponentiation.hpp>
@@ -52,6 +53,8 @@ namespace nil {
                     using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_ate_miller_loop<curve_type>;
                     using double_miller_loop =
                         pairing::short_weierstrass_jacobian_with_a4_0_ate_double_miller_loop<curve_type>;
+                    using multi_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_ate_multi_miller_loop<curve_type>;
                     using final_exponentiation =
                         pairing::short_weierstrass_jacobian_with_a4_0_final_exponentiation<curve_type>;
 
@@ -68,6 +71,8 @@ namespace nil {
                     using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_ate_miller_loop<curve_type>;
                     using double_miller_loop =
                         pairing::short_weierstrass_jacobian_with_a4_0_ate_double_miller_loop<curve_type>;
+                    using multi_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_ate_multi_miller_loop<curve_type>;
                     using final_exponentiation =
                         pairing::short_weierstrass_jacobian_with_a4_0_final_exponentiation<curve_type>;
 
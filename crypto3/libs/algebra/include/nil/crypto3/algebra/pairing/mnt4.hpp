@@ -31,6 +31,7 @@
 #include <nil/crypto3/algebra/pairing/detail/mnt4/298/params.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4/298/ate_double_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4/298/ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4/298/ate_multi_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/projective/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/projective/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4/298/final_exponentiation.hpp>
@@ -51,6 +52,7 @@ namespace nil {
                     using precompute_g2 = pairing::short_weierstrass_projective_ate_precompute_g2<curve_type>;
                     using miller_loop = pairing::mnt4_ate_miller_loop<298>;
                     using double_miller_loop = pairing::mnt4_ate_double_miller_loop<298>;
+                    using multi_miller_loop = pairing::mnt4_ate_multi_miller_loop<298>;
                     using final_exponentiation = pairing::mnt4_final_exponentiation<298>;
 
                     using g1_precomputed_type = typename precompute_g1::g1_precomputed_type;
@@ -27,6 +27,7 @@
 #define BOOST_TEST_MODULE algebra_fields_test
 
 #include <iostream>
+#include <random>
 #include <string>
 
 #include <boost/test/unit_test.hpp>
@@ -58,6 +59,7 @@
 #include <nil/crypto3/algebra/fields/curve25519/base_field.hpp>
 #include <nil/crypto3/algebra/fields/curve25519/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/batch_operations.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp2.hpp>
@@ -639,4 +641,94 @@ BOOST_AUTO_TEST_CASE(field_not_square_test_secp_r1) {
 
 }
 
+BOOST_AUTO_TEST_CASE(field_goldilocks64_fast_arithmetic) {
+    using field_type = fields::goldilocks64_base_field;
+    using value_type = typename field_type::value_type;
+    using integral_type = typename field_type::integral_type;
+
+    value_type a = 123456789u;
+    value_type b = 0xFFFFFFFF00000000_cppui_modular64;
+
+    BOOST_CHECK_EQUAL(a * b, value_type(0xFFFFFFFEF8A432EC_cppui_modular64));
+    BOOST_CHECK_EQUAL(a + b, value_type(123456788u));
+    BOOST_CHECK_EQUAL(a - b, value_type(123456790u));
+    BOOST_CHECK_EQUAL(-a, value_type(0xFFFFFFFEF8A432EC_cppui_modular64));
+    BOOST_CHECK_EQUAL(b.squared(), value_type::one());
+    BOOST_CHECK_EQUAL(a.doubled(), value_type(246913578u));
+    BOOST_CHECK_EQUAL(a * a.inversed(), value_type::one());
+
+    // Batch operations must match the element operations, sizes cover the vector tails.
+    std::mt19937_64 rng(42);
+    const std::size_t n = 1027;
+    std::vector<value_type> x(n), y(n), w(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = value_type(integral_type(rng()));
+        y[i] = value_type(integral_type(rng()));
+        w[i] = value_type(integral_type(rng()));
+    }
+    x[0] = value_type::zero();
+    y[1] = -value_type::one();
+    x[2] = -value_type::one();
+    y[2] = -value_type::one();
+
+    std::vector<value_type> sum(n), difference(n), product(n), lo(x), hi(y);
+    fields::goldilocks64_batch_operations::add(sum.data(), x.data(), y.data(), n);
+    fields::goldilocks64_batch_operations::sub(difference.data(), x.data(), y.data(), n);
+    fields::goldilocks64_batch_operations::mul(product.data(), x.data(), y.data(), n);
+    fields::goldilocks64_batch_operations::butterfly(lo.data(), hi.data(), w.data(), 1, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(sum[i], x[i] + y[i]);
+        BOOST_CHECK_EQUAL(difference[i], x[i] - y[i]);
+        BOOST_CHECK_EQUAL(product[i], x[i] * y[i]);
+        BOOST_CHECK_EQUAL(lo[i], x[i] + w[i] * y[i]);
+        BOOST_CHECK_EQUAL(hi[i], x[i] - w[i] * y[i]);
+    }
+
+    using fp2_value_type = typename fields::fp2<field_type>::value_type;
+    fp2_value_type u(x[3], y[3]), v(x[4], y[4]);
+    BOOST_CHECK_EQUAL(u * v * v.inversed(), u);
+    BOOST_CHECK_EQUAL(u.squared(), u * u);
+    BOOST_CHECK_EQUAL(u.squared().sqrt().squared(), u.squared());
+}
+
+BOOST_AUTO_TEST_CASE(field_goldilocks64_batch_kernel_backends) {
+    using arithmetic = fields::detail::goldilocks64_arithmetic;
+    using word_type = typename arithmetic::word_type;
+
+    std::mt19937_64 rng(43);
+    const std::size_t n = 1027;
+    std::vector<word_type> x(n), y(n), w(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = rng() % arithmetic::modulus;
+        y[i] = rng() % arithmetic::modulus;
+        w[i] = rng() % arithmetic::modulus;
+    }
+    x[0] = 0;
+    y[1] = arithmetic::modulus - 1;
+    x[2] = arithmetic::modulus - 1;
+    y[2] = arithmetic::modulus - 1;
+
+    // Every backend the CPU supports must match the scalar operations, including on the vector tails.
+    for (auto backend : {arithmetic::backend_type::portable, arithmetic::backend_type::avx2,
+                         arithmetic::backend_type::avx512}) {
+        if (!arithmetic::supports(backend)) {
+            BOOST_TEST_MESSAGE("Goldilocks backend " << static_cast<int>(backend) << " is not supported, skipped");
+            continue;
+        }
+        std::vector<word_type> sum(n), difference(n), product(n), lo(x), hi(y);
+        arithmetic::add(backend, sum.data(), x.data(), y.data(), n);
+        arithmetic::sub(backend, difference.data(), x.data(), y.data(), n);
+        arithmetic::mul(backend, product.data(), x.data(), y.data(), n);
+        arithmetic::butterfly(backend, lo.data(), hi.data(), w.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const word_type t = arithmetic::mul(y[i], w[i]);
+            BOOST_CHECK_EQUAL(sum[i], arithmetic::add(x[i], y[i]));
+            BOOST_CHECK_EQUAL(difference[i], arithmetic::sub(x[i], y[i]));
+            BOOST_CHECK_EQUAL(product[i], arithmetic::mul(x[i], y[i]));
+            BOOST_CHECK_EQUAL(lo[i], arithmetic::add(x[i], t));
+            BOOST_CHECK_EQUAL(hi[i], arithmetic::sub(x[i], t));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
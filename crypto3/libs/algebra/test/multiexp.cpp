@@ -38,6 +38,7 @@
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_to_affine.hpp>
 
 #include <nil/crypto3/algebra/curves/params/wnaf/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
@@ -116,4 +117,95 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(multiexp_test, runner, multiexp_runners) {
     BOOST_CHECK(runner::run());
 }
 
+template<typename curve_group_type>
+class batch_to_affine_runner {
+    public:
+    bool static run() {
+        using point = typename curve_group_type::value_type;
+        using scalar = typename curve_group_type::params_type::scalar_field_type;
+
+        std::size_t N = 8;
+
+        std::vector<point> points(N);
+        std::vector<typename scalar::value_type> scalars(N);
+
+        for(auto & p: points) {
+            p = random_element<curve_group_type>();
+        }
+        points[2] = point::zero();
+        points[5] = point::from_affine(points[4].to_affine());
+
+        for(auto & s: scalars) {
+            s = random_element<scalar>();
+        }
+
+        bool result = true;
+        for (std::size_t threads : {1, 3}) {
+            auto affine_points = batch_to_affine(points, threads);
+            BOOST_CHECK_EQUAL(affine_points.size(), N);
+            for (std::size_t i = 0; i < N; ++i) {
+                BOOST_CHECK_EQUAL(affine_points[i], points[i].to_affine());
+                result = result && (affine_points[i] == points[i].to_affine());
+            }
+        }
+
+        // Mixed addition of affine points, including the cases of zero, equal and opposite points.
+        point p = points[0];
+        auto q = points[1].to_affine();
+        point sum = p;
+        sum.mixed_add(q);
+        BOOST_CHECK_EQUAL(sum, p + points[1]);
+
+        sum = p;
+        sum.mixed_add(p.to_affine());
+        BOOST_CHECK_EQUAL(sum, p + p);
+
+        sum = p;
+        sum.mixed_add((-p).to_affine());
+        BOOST_CHECK(sum.is_zero());
+
+        sum = point::zero();
+        sum.mixed_add(q);
+        BOOST_CHECK_EQUAL(sum, points[1]);
+
+        sum = p;
+        sum.mixed_add(point::zero().to_affine());
+        BOOST_CHECK_EQUAL(sum, p);
+
+        // Multi-exponentiation over normalized bases.
+        std::vector<point> normalized = points;
+        batch_normalize(normalized);
+        for (std::size_t i = 0; i < N; ++i) {
+            BOOST_CHECK_EQUAL(normalized[i], points[i]);
+        }
+
+        point naive_result = policies::multiexp_method_naive_plain::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
+        point bdlo12_result = policies::multiexp_method_BDLO12::process(
+                normalized.begin(), normalized.end(),
+                scalars.begin(), scalars.end());
+
+        BOOST_CHECK_EQUAL(naive_result, bdlo12_result);
+
+        return result && (naive_result == bdlo12_result);
+    }
+};
+
+using batch_to_affine_runners = boost::mpl::list<
+    batch_to_affine_runner<curves::alt_bn128_254::template g1_type<>>,
+    batch_to_affine_runner<curves::alt_bn128_254::template g2_type<>>,
+
+    batch_to_affine_runner<curves::bls12_381::template g1_type<>>,
+    batch_to_affine_runner<curves::bls12_381::template g2_type<>>,
+
+    batch_to_affine_runner<curves::mnt4_298::template g1_type<>>,
+    batch_to_affine_runner<curves::mnt6_298::template g1_type<>>
+    >;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_to_affine_test, runner, batch_to_affine_runners) {
+    BOOST_CHECK(runner::run());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -190,6 +190,20 @@ void check_pairing_operations(std::vector<Fr_value_type> const& Fr_elements,
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * Multi-pairing tests started..." << std::endl;
+    std::vector<g1_precomp_value_type> multi_prec_P = {G1_prec_elements[prec_A1], G1_prec_elements[prec_A2]};
+    std::vector<g2_precomp_value_type> multi_prec_Q = {G2_prec_elements[prec_B1], G2_prec_elements[prec_B2]};
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(multi_prec_P, multi_prec_Q),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+
+    std::vector<G1_value_type> multi_P = {G1_elements[A1], G1_elements[A2], -G1_elements[VKx], -G1_elements[C1]};
+    std::vector<G2_value_type> multi_Q = {G2_elements[B1], G2_elements[B2], G2_elements[VKy], G2_elements[VKz]};
+    BOOST_CHECK_EQUAL(*multi_pair_reduced<CurveType>(multi_P, multi_Q),
+                      *pair_reduced<CurveType>(G1_elements[A2], G2_elements[B2]));
+    BOOST_CHECK_EQUAL(*multi_pair_reduced<CurveType>(std::vector<G1_value_type>(), std::vector<G2_value_type>()),
+                      GT_value_type::one());
+    std::cout << " * Multi-pairing tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_BENCH_BENCHMARK_REPORT_HPP
+#define CRYPTO3_BENCH_BENCHMARK_REPORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace bench {
+
+            // Wall times of all the runs of one benchmark on one input size with a given number of threads.
+            struct benchmark_result {
+                std::string name;
+                std::size_t size;
+                std::size_t threads;
+                std::vector<double> samples_ms;
+
+                double min_ms() const {
+                    return samples_ms.empty() ? 0 : *std::min_element(samples_ms.begin(), samples_ms.end());
+                }
+
+                double median_ms() const {
+                    if (samples_ms.empty()) {
+                        return 0;
+                    }
+                    std::vector<double> sorted = samples_ms;
+                    std::sort(sorted.begin(), sorted.end());
+                    std::size_t middle = sorted.size() / 2;
+                    return sorted.size() % 2 == 1 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2;
+                }
+
+                double mean_ms() const {
+                    double sum = 0;
+                    for (double sample: samples_ms) {
+                        sum += sample;
+                    }
+                    return samples_ms.empty() ? 0 : sum / samples_ms.size();
+                }
+            };
+
+            // A benchmark that got slower than its baseline by more than the allowed threshold.
+            struct benchmark_regression {
+                std::string name;
+                std::size_t size;
+                std::size_t threads;
+                double baseline_ms;
+                double current_ms;
+            };
+
+            /**
+             * Collects benchmark results and writes them as JSON:
+             *   {"metadata": {...}, "results": [{"name", "size", "threads", "min_ms", "median_ms", "mean_ms",
+             *   "samples_ms": [...]}, ...]}
+             * Files in this format can be used as a baseline, results are matched by name, size and threads
+             * and compared by median.
+             */
+            class benchmark_report {
+            public:
+                using key_type = std::tuple<std::string, std::size_t, std::size_t>;
+
+                void add_metadata(const std::string& key, const std::string& value) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    metadata[key] = value;
+                }
+
+                void add(const benchmark_result& result) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    results.push_back(result);
+                }
+
+                std::vector<benchmark_result> get_results() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return results;
+                }
+
+                bool write_json(const std::string& path) const {
+                    std::ofstream out(path);
+                    if (!out.is_open()) {
+                        return false;
+                    }
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    out << "{\"metadata\":{";
+                    bool first = true;
+                    for (const auto& [key, value]: metadata) {
+                        out << (first ? "" : ",") << "\"" << escape(key) << "\":\"" << escape(value) << "\"";
+                        first = false;
+                    }
+                    out << "},\"results\":[";
+                    first = true;
+                    for (const auto& result: results) {
+                        out << (first ? "" : ",") << "\n{\"name\":\"" << escape(result.name)
+                            << "\",\"size\":" << result.size << ",\"threads\":" << result.threads
+                            << ",\"min_ms\":" << result.min_ms() << ",\"median_ms\":" << result.median_ms()
+                            << ",\"mean_ms\":" << result.mean_ms() << ",\"samples_ms\":[";
+                        for (std::size_t i = 0; i < result.samples_ms.size(); ++i) {
+                            out << (i == 0 ? "" : ",") << result.samples_ms[i];
+                        }
+                        out << "]}";
+                        first = false;
+                    }
+                    out << "\n]}\n";
+                    return out.good();
+                }
+
+                // Median times of all the results in a file written by write_json. Throws if the file can't be parsed.
+                static std::map<key_type, double> read_medians(const std::string& path) {
+                    boost::property_tree::ptree tree;
+                    boost::property_tree::read_json(path, tree);
+
+                    std::map<key_type, double> medians;
+                    for (const auto& [_, result]: tree.get_child("results")) {
+                        medians[key_type(result.get<std::string>("name"), result.get<std::size_t>("size"),
+                                         result.get<std::size_t>("threads"))] = result.get<double>("median_ms");
+                    }
+                    return medians;
+                }
+
+                /**
+                 * Compares the medians of the collected results with the baseline file. A result regresses if it
+                 * is slower than the baseline by more than 'threshold', e.g. 0.1 for 10%. Results missing from
+                 * the baseline are ignored.
+                 */
+                std::vector<benchmark_regression> compare(const std::string& baseline_path, double threshold) const {
+                    std::map<key_type, double> baseline = read_medians(baseline_path);
+
+                    std::vector<benchmark_regression> regressions;
+                    for (const auto& result: get_results()) {
+                        auto it = baseline.find(key_type(result.name, result.size, result.threads));
+                        if (it == baseline.end()) {
+                            continue;
+                        }
+                        double current = result.median_ms();
+                        if (current > it->second * (1 + threshold)) {
+                            regressions.push_back({result.name, result.size, result.threads, it->second, current});
+                        }
+                    }
+                    return regressions;
+                }
+
+            private:
+                static std::string escape(const std::string& s) {
+                    std::string result;
+                    for (char c: s) {
+                        if (c == '"' || c == '\\') {
+                            result.push_back('\\');
+                        }
+                        result.push_back(c);
+                    }
+                    return result;
+                }
+
+                mutable std::mutex mutex;
+                std::map<std::string, std::string> metadata;
+                std::vector<benchmark_result> results;
+            };
+
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BENCH_BENCHMARK_REPORT_HPP
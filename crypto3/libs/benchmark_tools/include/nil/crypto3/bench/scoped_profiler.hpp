@@ -32,6 +32,8 @@
 #include <iomanip>
 #include <unordered_map>
 
+#include <nil/crypto3/bench/tracer.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace bench {
@@ -113,11 +115,14 @@ class scoped_aggregate_profiler
     }            // namespace crypto3
 }    // namespace nil
 
+// Profiled scopes are also spans of the runtime tracer, see tracer.hpp.
 #ifdef PROFILING_ENABLED
     #define PROFILE_SCOPE(name) \
-        nil::crypto3::bench::detail::scoped_profiler profiler(name);
+        nil::crypto3::bench::detail::scoped_profiler profiler(name); \
+        TRACE_SCOPE(name)
 #else
-    #define PROFILE_SCOPE(name) 
+    #define PROFILE_SCOPE(name) \
+        TRACE_SCOPE(name)
 #endif
 
 #ifdef PROFILING_ENABLED
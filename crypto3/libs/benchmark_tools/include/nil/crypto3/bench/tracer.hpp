@@ -0,0 +1,336 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BENCH_TRACER_HPP
+#define CRYPTO3_BENCH_TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace bench {
+
+            /**
+             * Runtime tracer of nested spans. Spans are recorded into per-thread buffers and written as
+             * Chrome trace event JSON, which can be opened in chrome://tracing or the Perfetto UI.
+             * While the tracer is not started, a span costs a single relaxed atomic load.
+             */
+            class tracer {
+            public:
+                struct event {
+                    const char* name;
+                    // Used instead of 'name' for names built at runtime.
+                    std::string dynamic_name;
+                    const char* category;
+                    const char* arg_name;
+                    std::int64_t arg_value;
+                    double start_us;
+                    double duration_us;
+                    std::size_t depth;
+                    // Resident set size of the process at the end of the span and its change over the span.
+                    std::size_t rss_bytes;
+                    std::int64_t rss_delta_bytes;
+                    std::uint64_t allocations;
+                };
+
+                static tracer& get_instance() {
+                    static tracer instance;
+                    return instance;
+                }
+
+                static bool is_enabled() {
+                    return enabled.load(std::memory_order_relaxed);
+                }
+
+                // Called from the replaced operator new of the executable, if it counts allocations.
+                static void count_allocation() {
+                    if (is_enabled()) {
+                        ++thread_allocations();
+                    }
+                }
+
+                static std::uint64_t& thread_allocations() {
+                    static thread_local std::uint64_t allocations = 0;
+                    return allocations;
+                }
+
+                /**
+                 * Current resident set size of the process, read from /proc/self/statm. The file is kept open and
+                 * read without allocating, so the allocation counts of the spans are not affected. Returns 0 where
+                 * /proc is not available.
+                 */
+                static std::size_t current_rss_bytes() {
+                    static const int statm = ::open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+                    static const std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                    if (statm < 0) {
+                        return 0;
+                    }
+                    char data[128];
+                    ssize_t length = ::pread(statm, data, sizeof(data) - 1, 0);
+                    if (length <= 0) {
+                        return 0;
+                    }
+                    data[length] = '\0';
+                    // The fields are the total program size and the resident set size, in pages.
+                    char* resident = nullptr;
+                    std::strtoull(data, &resident, 10);
+                    return static_cast<std::size_t>(std::strtoull(resident, nullptr, 10)) * page_size;
+                }
+
+                static std::size_t peak_rss_bytes() {
+                    struct rusage usage;
+                    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+                        return 0;
+                    }
+                    // ru_maxrss is in kilobytes on Linux.
+                    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+                }
+
+                void start() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    for (auto& buffer: buffers) {
+                        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+                        buffer->events.clear();
+                    }
+                    metadata.clear();
+                    start_time = std::chrono::steady_clock::now();
+                    enabled.store(true, std::memory_order_relaxed);
+                }
+
+                void stop() {
+                    enabled.store(false, std::memory_order_relaxed);
+                    end_time = std::chrono::steady_clock::now();
+                }
+
+                double now_us() const {
+                    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time).count();
+                }
+
+                void add_metadata(const std::string& key, const std::string& value) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    metadata[key] = value;
+                }
+
+                std::size_t& thread_depth() {
+                    return local_buffer().depth;
+                }
+
+                void record(event&& e) {
+                    auto& buffer = local_buffer();
+                    std::lock_guard<std::mutex> lock(buffer.mutex);
+                    buffer.events.push_back(std::move(e));
+                }
+
+                /**
+                 * Writes all the recorded spans in Chrome trace event format. For each span category that starts
+                 * with "pool", the utilization of the threads that ran such spans is added to the metadata.
+                 */
+                bool write_chrome_trace(const std::string& path) {
+                    std::ofstream out(path);
+                    if (!out.is_open()) {
+                        return false;
+                    }
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    const double total_us = std::chrono::duration<double, std::micro>(end_time - start_time).count();
+
+                    std::map<std::string, double> busy_us;
+                    std::map<std::string, std::set<std::size_t>> busy_threads;
+
+                    // Timestamps are written in microseconds with a fixed precision, so long runs keep their resolution.
+                    out << std::fixed << std::setprecision(3);
+                    out << "{\"traceEvents\":[";
+                    bool first = true;
+                    for (const auto& buffer: buffers) {
+                        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+                        if (!buffer->events.empty()) {
+                            out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                                << buffer->thread_id << ",\"args\":{\"name\":\"thread " << buffer->thread_id << "\"}}";
+                            first = false;
+                        }
+                        for (const auto& e: buffer->events) {
+                            std::string category = e.category;
+                            if (category.rfind("pool", 0) == 0) {
+                                busy_us[category] += e.duration_us;
+                                busy_threads[category].insert(buffer->thread_id);
+                            }
+
+                            out << ",\n{\"name\":\"" << escape(e.dynamic_name.empty() ? e.name : e.dynamic_name)
+                                << "\",\"cat\":\"" << escape(category) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                                << buffer->thread_id << ",\"ts\":" << e.start_us << ",\"dur\":" << e.duration_us
+                                << ",\"args\":{\"depth\":" << e.depth << ",\"rss_mb\":" << (e.rss_bytes >> 20)
+                                << ",\"rss_delta_mb\":" << e.rss_delta_bytes / double(1 << 20)
+                                << ",\"allocations\":" << e.allocations;
+                            if (e.arg_name != nullptr) {
+                                out << ",\"" << escape(e.arg_name) << "\":" << e.arg_value;
+                            }
+                            out << "}}";
+                        }
+                    }
+                    out << "\n],\"displayTimeUnit\":\"ms\",\"metadata\":{";
+
+                    std::map<std::string, std::string> all_metadata = metadata;
+                    all_metadata["total_time_ms"] = std::to_string(total_us / 1000);
+                    all_metadata["peak_rss_mb"] = std::to_string(peak_rss_bytes() >> 20);
+                    for (const auto& [category, busy]: busy_us) {
+                        double capacity = total_us * busy_threads[category].size();
+                        all_metadata[category + " utilization"] = std::to_string(capacity > 0 ? busy / capacity : 0);
+                    }
+                    first = true;
+                    for (const auto& [key, value]: all_metadata) {
+                        out << (first ? "" : ",") << "\"" << escape(key) << "\":\"" << escape(value) << "\"";
+                        first = false;
+                    }
+                    out << "}}\n";
+                    return out.good();
+                }
+
+            private:
+                struct thread_buffer {
+                    std::mutex mutex;
+                    std::vector<event> events;
+                    std::size_t thread_id;
+                    std::size_t depth = 0;
+                };
+
+                tracer() : start_time(std::chrono::steady_clock::now()), end_time(start_time) {
+                }
+
+                thread_buffer& local_buffer() {
+                    static thread_local std::shared_ptr<thread_buffer> buffer;
+                    if (!buffer) {
+                        buffer = std::make_shared<thread_buffer>();
+                        std::lock_guard<std::mutex> lock(mutex);
+                        buffer->thread_id = buffers.size() + 1;
+                        buffers.push_back(buffer);
+                    }
+                    return *buffer;
+                }
+
+                static std::string escape(const std::string& s) {
+                    std::string result;
+                    for (char c: s) {
+                        if (c == '"' || c == '\\') {
+                            result.push_back('\\');
+                        }
+                        result.push_back(c);
+                    }
+                    return result;
+                }
+
+                static inline std::atomic<bool> enabled = false;
+
+                std::mutex mutex;
+                std::vector<std::shared_ptr<thread_buffer>> buffers;
+                std::map<std::string, std::string> metadata;
+                std::chrono::steady_clock::time_point start_time;
+                std::chrono::steady_clock::time_point end_time;
+            };
+
+            // Records a span from construction to destruction if the tracer is running.
+            class trace_span {
+            public:
+                trace_span(const char* name, const char* category = "prover",
+                           const char* arg_name = nullptr, std::int64_t arg_value = 0) {
+                    if (tracer::is_enabled()) {
+                        begin(name, category, arg_name, arg_value);
+                    }
+                }
+
+                trace_span(const std::string& name, const char* category = "prover",
+                           const char* arg_name = nullptr, std::int64_t arg_value = 0) {
+                    if (tracer::is_enabled()) {
+                        begin("", category, arg_name, arg_value);
+                        e.dynamic_name = name;
+                    }
+                }
+
+                trace_span(const trace_span&) = delete;
+                trace_span& operator=(const trace_span&) = delete;
+
+                ~trace_span() {
+                    if (!active) {
+                        return;
+                    }
+                    auto& t = tracer::get_instance();
+                    --t.thread_depth();
+                    e.duration_us = t.now_us() - e.start_us;
+                    e.allocations = tracer::thread_allocations() - e.allocations;
+                    e.rss_bytes = tracer::current_rss_bytes();
+                    e.rss_delta_bytes = static_cast<std::int64_t>(e.rss_bytes) - e.rss_delta_bytes;
+                    t.record(std::move(e));
+                }
+
+            private:
+                void begin(const char* name, const char* category, const char* arg_name, std::int64_t arg_value) {
+                    auto& t = tracer::get_instance();
+                    active = true;
+                    e.name = name;
+                    e.category = category;
+                    e.arg_name = arg_name;
+                    e.arg_value = arg_value;
+                    e.depth = t.thread_depth()++;
+                    // Holds the resident set size at the beginning until the span ends.
+                    e.rss_delta_bytes = static_cast<std::int64_t>(tracer::current_rss_bytes());
+                    e.allocations = tracer::thread_allocations();
+                    e.start_us = t.now_us();
+                }
+
+                bool active = false;
+                tracer::event e;
+            };
+
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace nil
+
+#define CRYPTO3_TRACE_CONCAT_IMPL(a, b) a##b
+#define CRYPTO3_TRACE_CONCAT(a, b) CRYPTO3_TRACE_CONCAT_IMPL(a, b)
+
+// Traces the enclosing scope when the tracer is running.
+#define TRACE_SCOPE(name) \
+    nil::crypto3::bench::trace_span CRYPTO3_TRACE_CONCAT(trace_span_, __LINE__)(name);
+
+// Same as TRACE_SCOPE, with a named integer argument shown in the trace, e.g. the size of an FFT.
+#define TRACE_SCOPE_ARG(name, arg_name, arg_value) \
+    nil::crypto3::bench::trace_span CRYPTO3_TRACE_CONCAT(trace_span_, __LINE__)( \
+        name, "prover", arg_name, static_cast<std::int64_t>(arg_value));
+
+#endif    // CRYPTO3_BENCH_TRACER_HPP
@@ -24,19 +24,27 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <numeric>
 #include <utility>
 #include <unordered_map>
 #include <map>
 
+#include <boost/functional/hash.hpp>
+
 #include <nil/blueprint/manifest.hpp>
 #include <nil/blueprint/blueprint/plonk/assignment.hpp>
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
 #include <nil/blueprint/utils/gate_mover.hpp>
 
+#include <nil/crypto3/algebra/algorithms/run_in_chunks.hpp>
+
 namespace nil {
     namespace blueprint {
         namespace detail {
@@ -61,6 +69,18 @@ namespace nil {
                 }
             };
 
+            // Inputs are deduplicated by the variables they consist of, in all_vars() order
+            template<typename VariableType>
+            struct input_key_hash {
+                std::size_t operator()(const std::vector<VariableType> &key) const {
+                    std::size_t result = key.size();
+                    for (const auto &variable : key) {
+                        boost::hash_combine(result, std::hash<VariableType>()(variable));
+                    }
+                    return result;
+                }
+            };
+
             template<typename ComponentType, typename WitnessContainerType, typename ConstantContainerType,
                      typename PublicInputContainerType, typename... ComponentParams>
             ComponentType component_builder(
@@ -157,11 +177,19 @@ namespace nil {
             using constraint_type = crypto3::zk::snark::plonk_constraint<BlueprintFieldType>;
             using gate_type = crypto3::zk::snark::plonk_gate<BlueprintFieldType, constraint_type>;
             using component_params_type = typename std::tuple<ComponentParams...>;
-            // input-output pairs for batched components
-            // the second bool determines whether the result has been actually filled; is left unfilled if called
-            // from generate_circuit
-            std::map<input_type, std::pair<result_type, bool>, comparison_for_inputs_results<BlueprintFieldType, input_type>>
-                inputs_results;
+            using input_key_type = std::vector<var>;
+
+            struct input_result_type {
+                input_key_type key;
+                input_type input;
+                result_type result;
+                // false if the result is a placeholder added from generate_circuit
+                bool assigned;
+            };
+            // input-output pairs for batched components, in insertion order
+            // finalize_batch places them in the order of their keys
+            std::vector<input_result_type> inputs_results;
+            std::unordered_map<input_key_type, std::size_t, detail::input_key_hash<var>> inputs_index;
             // pointer to the assignment we are going to use in the end
             assignment<ArithmetizationType> &parent_assignment;
             // we cache this; use this to store intermediate results
@@ -177,6 +205,12 @@ namespace nil {
                     std::vector<std::size_t>, std::vector<std::size_t>, std::vector<std::size_t>,
                     ComponentParams...>;
 
+            // the manifest intersection and the component at column 0 only depend on the witness amount,
+            // so they are built once instead of once per input
+            std::size_t cached_witnesses_amount = 0;
+            std::size_t cached_component_witness_amount = 0;
+            std::shared_ptr<ComponentType> cached_component_instance;
+
             component_batch(assignment<ArithmetizationType> &_assignment,
                             component_params_type params)
                 : parent_assignment(_assignment),
@@ -216,20 +250,42 @@ namespace nil {
                 return component_witness_amount;
             }
 
+            // same as above, recomputed only if the parent assignment got resized
+            std::size_t cached_component_witness_amount_for_parent() {
+                if (!cached_component_instance || cached_witnesses_amount != parent_assignment.witnesses_amount()) {
+                    cached_witnesses_amount = parent_assignment.witnesses_amount();
+                    cached_component_witness_amount = get_component_witness_amount();
+                    cached_component_instance = std::make_shared<ComponentType>(
+                        build_component_instance(cached_component_witness_amount));
+                }
+                return cached_component_witness_amount;
+            }
+
+            static input_key_type input_key(const input_type &input) {
+                input_type input_copy = input;
+                input_key_type key;
+                for (const auto &variable : input_copy.all_vars()) {
+                    key.push_back(variable.get());
+                }
+                return key;
+            }
+
             // call this in both generate_assignments and generate_circuit
             result_type add_input(const input_type &input, bool called_from_generate_circuit = false) {
+                input_key_type key = input_key(input);
                 // short-circuit if the input has already been through batching
                 bool unassigned_result_found = false;
-                if (inputs_results.find(input) != inputs_results.end()) {
-                    auto result_pair = inputs_results.at(input);
-                    if (result_pair.second || called_from_generate_circuit) {
-                        return result_pair.first;
+                auto found = inputs_index.find(key);
+                if (found != inputs_index.end()) {
+                    const auto &input_result = inputs_results[found->second];
+                    if (input_result.assigned || called_from_generate_circuit) {
+                        return input_result.result;
                     }
                     unassigned_result_found = true;
                 }
 
-                std::size_t component_witness_amount = get_component_witness_amount();
-                ComponentType component_instance = build_component_instance(component_witness_amount);
+                std::size_t component_witness_amount = cached_component_witness_amount_for_parent();
+                const ComponentType &component_instance = *cached_component_instance;
 
                 if (called_from_generate_circuit) {
                     // if we found a result we have already returned before this point
@@ -238,8 +294,8 @@ namespace nil {
                     for (auto variable : result.all_vars()) {
                         variable.get() = parent_assignment.add_batch_variable(0);
                     }
-                    bool insertion_result = inputs_results.insert({input, {result, false}}).second;
-                    BOOST_ASSERT(insertion_result);
+                    inputs_results.push_back({key, input, result, false});
+                    inputs_index.emplace(std::move(key), inputs_results.size() - 1);
                     return result;
                 }
 
@@ -264,26 +320,27 @@ namespace nil {
                     for (auto variable : result.all_vars()) {
                         variable_transform(variable);
                     }
-                    bool insertion_result = inputs_results.insert({input, {result, true}}).second;
-                    BOOST_ASSERT(insertion_result);
+                    inputs_results.push_back({key, input, result, true});
+                    inputs_index.emplace(std::move(key), inputs_results.size() - 1);
                     return result;
                 } else {
                     // already have some vars
-                    auto unassigned_result = inputs_results.find(input)->second.first;
-                    auto unsassigned_vars = unassigned_result.all_vars();
+                    auto &unassigned_result = inputs_results[found->second];
+                    auto unsassigned_vars = unassigned_result.result.all_vars();
                     auto result_vars = result.all_vars();
                     BOOST_ASSERT(unsassigned_vars.size() == result_vars.size());
                     for (std::size_t i = 0; i < unsassigned_vars.size(); i++) {
                         parent_assignment.batch_private_storage(unsassigned_vars[i].get().rotation) =
                             var_value(internal_assignment, result_vars[i].get());
                     }
-                    inputs_results.erase(input);
-                    bool insertion_result = inputs_results.insert({input, {unassigned_result, true}}).second;
-                    BOOST_ASSERT(insertion_result);
-                    return unassigned_result;
+                    unassigned_result.assigned = true;
+                    return unassigned_result.result;
                 }
             }
 
+            // rows assigned by one thread in finalize_batch, at least
+            static constexpr std::size_t rows_per_thread = 16;
+
             // call this once in the end in assignment
             // note that the copy constraint replacement is done by assignment in order to reduce the amount of
             // spinning through the constraints; we pass variable_map for this purpose
@@ -296,51 +353,106 @@ namespace nil {
                 if (inputs_results.empty()) {
                     return start_row_index;
                 }
+                // components are placed in the order of their input variables, as with an ordered map
+                std::vector<std::size_t> order(inputs_results.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+                    return inputs_results[lhs].key < inputs_results[rhs].key;
+                });
                 // First figure out how much we can scale the component
                 const std::size_t component_witness_amount = get_component_witness_amount();
-                std::size_t row = start_row_index,
-                            col_offset = 0;
-                const std::vector<std::size_t> constants = {}, public_inputs = {};
-                std::size_t gate_id = generate_batch_gate(
-                    bp, inputs_results.begin()->first, component_witness_amount);
-                for (auto &input_result : inputs_results) {
-                    const input_type &input = input_result.first;
-                    result_type &result = input_result.second.first;
-                    bool result_status = input_result.second.second;
-                    BOOST_ASSERT(result_status);
-                    if (col_offset == 0) {
-                        parent_assignment.enable_selector(gate_id, row);
-                    }
-                    ComponentType component_instance = build_component_instance(component_witness_amount, col_offset);
-                    auto actual_result = generate_assignments(component_instance, parent_assignment, input, row);
-                    generate_copy_constraints(component_instance, bp, parent_assignment, input, row);
-                    std::size_t vars_amount = result.all_vars().size();
-                    for (std::size_t i = 0; i < vars_amount; i++) {
-                        const var batch_var = result.all_vars()[i].get();
-                        variable_map[batch_var] = actual_result.all_vars()[i].get();
-                    }
+                const std::size_t witnesses_amount = parent_assignment.witnesses_amount();
+                const std::size_t components_per_row = witnesses_amount / component_witness_amount;
+                const std::size_t used_columns = components_per_row * component_witness_amount;
+                const std::size_t rows_amount = (order.size() + components_per_row - 1) / components_per_row;
+                const input_type &first_input = inputs_results[order[0]].input;
+
+                std::size_t gate_id = generate_batch_gate(bp, first_input, component_witness_amount);
+                std::vector<ComponentType> component_instances;
+                for (std::size_t slot = 0; slot < components_per_row; slot++) {
+                    component_instances.push_back(
+                        build_component_instance(component_witness_amount, slot * component_witness_amount));
+                }
 
-                    col_offset += component_witness_amount;
-                    if (col_offset + component_witness_amount - 1 >= parent_assignment.witnesses_amount()) {
-                        col_offset = 0;
-                        row += 1;
+                // Rows are independent: every chunk assigns its rows into its own single-row assignment, with the
+                // inputs moved into the public input column like in add_input. The parent assignment is only read
+                // here and written afterwards, so it is never resized concurrently.
+                // The unused places of the last row are filled with copies of the component for the first input
+                // to satisfy the gate.
+                std::vector<value_type> row_values(rows_amount * used_columns, value_type::zero());
+                std::vector<std::uint8_t> row_values_assigned(rows_amount * used_columns, 0);
+                std::vector<std::vector<var>> actual_results(order.size());
+                // Blueprint is built without parallel-crypto3, so the chunks are std::async tasks of run_in_chunks
+                // rather than jobs of its thread pool. Tasks get at least rows_per_thread rows to pay for the start.
+                const std::size_t threads = std::min<std::size_t>(
+                    std::max<std::size_t>(1, std::thread::hardware_concurrency()),
+                    (rows_amount + rows_per_thread - 1) / rows_per_thread);
+                crypto3::algebra::run_in_chunks<bool>(
+                    rows_amount, threads,
+                    [&](std::size_t begin, std::size_t end) {
+                        assignment<ArithmetizationType> row_assignment(witnesses_amount, 1, 0, 0);
+                        for (std::size_t row = begin; row < end; row++) {
+                            std::vector<var> row_input_vars;
+                            for (std::size_t slot = 0; slot < components_per_row; slot++) {
+                                const std::size_t position = row * components_per_row + slot;
+                                input_type input_copy = position < order.size() ?
+                                    inputs_results[order[position]].input : first_input;
+                                for (auto variable : input_copy.all_vars()) {
+                                    row_assignment.public_input(0, row_input_vars.size()) =
+                                        var_value(parent_assignment, variable.get());
+                                    row_input_vars.push_back(variable.get());
+                                    variable.get() = var(0, row_input_vars.size() - 1, false, var::column_type::public_input);
+                                }
+                                auto actual_result = generate_assignments(
+                                    component_instances[slot], row_assignment, input_copy, 0);
+                                if (position >= order.size()) {
+                                    continue;
+                                }
+                                for (auto variable : actual_result.all_vars()) {
+                                    var actual = variable.get();
+                                    if (actual.type == var::column_type::witness) {
+                                        actual.rotation += start_row_index + row;
+                                    } else if (actual.type == var::column_type::public_input && actual.index == 0) {
+                                        actual = row_input_vars[actual.rotation];
+                                    }
+                                    actual_results[position].push_back(actual);
+                                }
+                            }
+                            for (std::size_t column = 0; column < used_columns; column++) {
+                                if (row_assignment.witness_column_size(column) > 0) {
+                                    row_values[row * used_columns + column] = row_assignment.witness(column, 0);
+                                    row_values_assigned[row * used_columns + column] = 1;
+                                    row_assignment.witness(column, 0) = value_type::zero();
+                                }
+                            }
+                        }
+                        return true;
+                    });
+
+                for (std::size_t row = 0; row < rows_amount; row++) {
+                    parent_assignment.enable_selector(gate_id, start_row_index + row);
+                    for (std::size_t column = 0; column < used_columns; column++) {
+                        if (row_values_assigned[row * used_columns + column]) {
+                            parent_assignment.witness(column, start_row_index + row) =
+                                row_values[row * used_columns + column];
+                        }
                     }
                 }
-                // we fill the unused places with copies of components for the first input to satisfy the gate
-                if (col_offset != 0 &&
-                    (col_offset + component_witness_amount - 1 < parent_assignment.witnesses_amount())) {
-
-                    while (col_offset + component_witness_amount - 1 < parent_assignment.witnesses_amount()) {
-                        std::vector<std::size_t> witness_columns(component_witness_amount);
-                        std::iota(witness_columns.begin(), witness_columns.end(), col_offset);
-                        ComponentType component_instance =
-                            std::apply(component_builder, std::make_tuple(witness_columns, constants, public_inputs, params_tuple));
-                        generate_assignments(component_instance, parent_assignment, inputs_results.begin()->first, row);
-                        col_offset += component_witness_amount;
+                for (std::size_t position = 0; position < order.size(); position++) {
+                    const input_result_type &input_result = inputs_results[order[position]];
+                    BOOST_ASSERT(input_result.assigned);
+                    const std::size_t row = start_row_index + position / components_per_row;
+                    generate_copy_constraints(
+                        component_instances[position % components_per_row], bp, parent_assignment,
+                        input_result.input, row);
+                    result_type result = input_result.result;
+                    auto result_vars = result.all_vars();
+                    BOOST_ASSERT(result_vars.size() == actual_results[position].size());
+                    for (std::size_t i = 0; i < result_vars.size(); i++) {
+                        variable_map[result_vars[i].get()] = actual_results[position][i];
                     }
-                    row += 1;
                 }
-                return row;
+                return start_row_index + rows_amount;
             }
 
             std::vector<constraint_type> move_constraints(
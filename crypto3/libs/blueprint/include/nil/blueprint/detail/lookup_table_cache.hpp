@@ -0,0 +1,276 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_BLUEPRINT_DETAIL_LOOKUP_TABLE_CACHE_HPP
+#define CRYPTO3_BLUEPRINT_DETAIL_LOOKUP_TABLE_CACHE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <nil/crypto3/algebra/algorithms/run_in_chunks.hpp>
+#include <nil/crypto3/marshalling/algebra/types/field_element_block.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+
+            // FNV-1a over 64-bit words, the content of a table file is hashed at memory speed.
+            inline std::uint64_t lookup_table_cache_hash(const void *data, std::size_t size,
+                                                         std::uint64_t hash = 0xcbf29ce484222325ULL) {
+                const unsigned char *bytes = static_cast<const unsigned char *>(data);
+                std::size_t i = 0;
+                for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+                    std::uint64_t word;
+                    std::memcpy(&word, bytes + i, sizeof(word));
+                    hash = (hash ^ word) * 0x100000001b3ULL;
+                }
+                for (; i < size; i++) {
+                    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+                }
+                return hash;
+            }
+
+            // Read-only memory mapping of a whole file.
+            class lookup_table_mapped_file {
+            public:
+                explicit lookup_table_mapped_file(const std::string &path) {
+                    int fd = ::open(path.c_str(), O_RDONLY);
+                    if (fd < 0) {
+                        return;
+                    }
+                    struct stat st;
+                    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+                        void *mapped = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if (mapped != MAP_FAILED) {
+                            _data = static_cast<const std::uint8_t *>(mapped);
+                            _size = st.st_size;
+                        }
+                    }
+                    ::close(fd);
+                }
+
+                lookup_table_mapped_file(const lookup_table_mapped_file &) = delete;
+                lookup_table_mapped_file &operator=(const lookup_table_mapped_file &) = delete;
+
+                ~lookup_table_mapped_file() {
+                    if (_data != nullptr) {
+                        ::munmap(const_cast<std::uint8_t *>(_data), _size);
+                    }
+                }
+
+                const std::uint8_t *data() const {
+                    return _data;
+                }
+
+                std::size_t size() const {
+                    return _size;
+                }
+
+            private:
+                const std::uint8_t *_data = nullptr;
+                std::size_t _size = 0;
+            };
+
+            /**
+             * Directory of precomputed fixed lookup tables, one binary file per table and field.
+             * The file name contains the table name and a hash of the field modulus. The file is a header with the
+             * key of the table (its dimensions and a hash of its definition) and a checksum of the content, followed
+             * by the columns in the bulk field element encoding. Files are memory-mapped on load and decoded in
+             * parallel; damaged, foreign or stale files are ignored, so the caller falls back to generating the
+             * table.
+             */
+            template<typename BlueprintFieldType>
+            class lookup_table_cache {
+            public:
+                using value_type = typename BlueprintFieldType::value_type;
+                using integral_type = typename BlueprintFieldType::integral_type;
+                using table_type = std::vector<std::vector<value_type>>;
+
+                constexpr static const std::size_t element_bytes =
+                    crypto3::marshalling::types::field_element_block_element_length<value_type>();
+
+                // Bump when a table generator changes the content of an existing table, so old files are not loaded.
+                constexpr static const std::uint64_t generators_version = 1;
+
+                // What a cached table must match to be loaded.
+                struct table_key_type {
+                    std::uint64_t columns;
+                    std::uint64_t rows;
+                    // Hash of the table layout, subtables included, and of generators_version.
+                    std::uint64_t definition;
+                };
+
+                template<typename TableDefinition>
+                static table_key_type table_key(TableDefinition &table) {
+                    std::vector<std::uint64_t> words = {generators_version, table.get_columns_number(),
+                                                        table.get_rows_number(), table.subtables.size()};
+                    std::uint64_t hash = lookup_table_cache_hash(table.table_name.data(), table.table_name.size());
+                    for (const auto &[subtable_name, subtable] : table.subtables) {
+                        hash = lookup_table_cache_hash(subtable_name.data(), subtable_name.size() + 1, hash);
+                        words.push_back(subtable.begin);
+                        words.push_back(subtable.end);
+                        words.push_back(subtable.column_indices.size());
+                        words.insert(words.end(), subtable.column_indices.begin(), subtable.column_indices.end());
+                    }
+                    hash = lookup_table_cache_hash(words.data(), words.size() * sizeof(std::uint64_t), hash);
+                    return {table.get_columns_number(), table.get_rows_number(), hash};
+                }
+
+                explicit lookup_table_cache(const std::string &directory, std::size_t threads = 0) :
+                    _directory(directory),
+                    _threads(threads) {
+                }
+
+                const std::string &directory() const {
+                    return _directory;
+                }
+
+                std::string file_path(const std::string &table_name) const {
+                    std::stringstream modulus;
+                    modulus << std::hex << BlueprintFieldType::modulus;
+                    const std::string modulus_string = modulus.str();
+                    std::stringstream path;
+                    path << _directory << "/" << table_name << "-" << std::hex << std::setw(16) << std::setfill('0')
+                         << lookup_table_cache_hash(modulus_string.data(), modulus_string.size());
+                    path << ".bin";
+                    return path.str();
+                }
+
+                bool load(const std::string &table_name, const table_key_type &key, table_type &result) const {
+                    lookup_table_mapped_file file(file_path(table_name));
+                    header_type header;
+                    if (file.size() < sizeof(header_type)) {
+                        return false;
+                    }
+                    std::memcpy(&header, file.data(), sizeof(header_type));
+                    if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0 ||
+                        header.element_bytes != element_bytes || header.columns != key.columns ||
+                        header.rows != key.rows || header.definition != key.definition ||
+                        file.size() != sizeof(header_type) + header.columns * header.rows * element_bytes) {
+                        return false;
+                    }
+                    const std::uint8_t *content = file.data() + sizeof(header_type);
+                    if (lookup_table_cache_hash(content, file.size() - sizeof(header_type)) != header.checksum) {
+                        return false;
+                    }
+
+                    table_type table(header.columns, std::vector<value_type>(header.rows));
+                    const std::size_t rows = header.rows;
+                    for (std::size_t i = 0; i < table.size(); i++) {
+                        const std::uint8_t *column = content + i * rows * element_bytes;
+                        crypto3::algebra::run_in_chunks<bool>(
+                            rows, _threads, [&table, column, i](std::size_t begin, std::size_t end) {
+                                crypto3::marshalling::types::read_field_elements(
+                                    column + begin * element_bytes, end - begin, table[i].data() + begin);
+                                return true;
+                            });
+                    }
+                    result = std::move(table);
+                    return true;
+                }
+
+                // The file is written next to the target and renamed, so concurrent readers never see a partial table.
+                bool store(const std::string &table_name, const table_key_type &key, const table_type &table) const {
+                    header_type header;
+                    std::memcpy(header.magic, magic, sizeof(header.magic));
+                    header.columns = key.columns;
+                    header.rows = key.rows;
+                    header.element_bytes = element_bytes;
+                    header.definition = key.definition;
+                    if (table.size() != header.columns) {
+                        return false;
+                    }
+                    for (const auto &column : table) {
+                        if (column.size() != header.rows) {
+                            return false;
+                        }
+                    }
+
+                    std::vector<std::uint8_t> content(header.columns * header.rows * element_bytes);
+                    for (std::size_t i = 0; i < table.size(); i++) {
+                        std::uint8_t *column = content.data() + i * header.rows * element_bytes;
+                        crypto3::algebra::run_in_chunks<bool>(
+                            header.rows, _threads, [&table, column, i](std::size_t begin, std::size_t end) {
+                                crypto3::marshalling::types::write_field_elements(
+                                    table[i].data() + begin, end - begin, column + begin * element_bytes);
+                                return true;
+                            });
+                    }
+                    header.checksum = lookup_table_cache_hash(content.data(), content.size());
+
+                    const std::string path = file_path(table_name);
+                    const std::string temporary_path = path + "." + std::to_string(::getpid()) + ".tmp";
+                    {
+                        std::ofstream out(temporary_path, std::ios::binary | std::ios::trunc);
+                        if (!out.is_open()) {
+                            return false;
+                        }
+                        out.write(reinterpret_cast<const char *>(&header), sizeof(header_type));
+                        out.write(reinterpret_cast<const char *>(content.data()), content.size());
+                        if (!out.good()) {
+                            out.close();
+                            std::remove(temporary_path.c_str());
+                            return false;
+                        }
+                    }
+                    if (std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+                        std::remove(temporary_path.c_str());
+                        return false;
+                    }
+                    return true;
+                }
+
+            private:
+                struct header_type {
+                    char magic[8];
+                    std::uint64_t columns;
+                    std::uint64_t rows;
+                    std::uint64_t element_bytes;
+                    std::uint64_t definition;
+                    std::uint64_t checksum;
+                };
+
+                constexpr static const char magic[8] = {'N', 'I', 'L', 'L', 'U', 'T', '0', '2'};
+
+                std::string _directory;
+                std::size_t _threads;
+            };
+        }    // namespace detail
+    }        // namespace blueprint
+}    // namespace nil
+
+#endif    // CRYPTO3_BLUEPRINT_DETAIL_LOOKUP_TABLE_CACHE_HPP
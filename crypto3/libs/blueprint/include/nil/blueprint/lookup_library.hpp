@@ -26,14 +26,18 @@
 #ifndef CRYPTO3_LOOKUP_LIBRARY_HPP
 #define CRYPTO3_LOOKUP_LIBRARY_HPP
 
+#include <array>
 #include <string>
 #include <map>
+#include <memory>
 
 #include <boost/bimap.hpp>
 
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_table_definition.hpp>
 #include <nil/blueprint/components/hashes/sha2/plonk/detail/split_functions.hpp>
 #include <nil/blueprint/detail/lookup_table_loaders.hpp>
+#include <nil/blueprint/detail/lookup_table_cache.hpp>
+#include <nil/crypto3/algebra/algorithms/run_in_chunks.hpp>
 #include <nil/blueprint/manifest.hpp>
 #include <nil/blueprint/assert.hpp>
 
@@ -68,6 +72,46 @@ namespace nil {
             using lookup_table_definition = typename nil::crypto3::zk::snark::lookup_table_definition<BlueprintFieldType>;
             using dynamic_table_definition = typename nil::crypto3::zk::snark::dynamic_table_definition<BlueprintFieldType>;
             using filled_lookup_table_definition = typename nil::crypto3::zk::snark::filled_lookup_table_definition<BlueprintFieldType>;
+            using table_cache_type = detail::lookup_table_cache<BlueprintFieldType>;
+
+            // Fills 'columns' columns of 'rows' rows in parallel chunks, row(i) returns the row values as integers.
+            // The sparse and sha256 function tables fit into 64 bits, so no multiprecision arithmetic is needed.
+            template<std::size_t Columns, typename RowFunc>
+            static void generate_table_in_chunks(
+                std::vector<std::vector<typename BlueprintFieldType::value_type>> &table,
+                std::size_t rows, RowFunc row) {
+                table.assign(Columns, std::vector<typename BlueprintFieldType::value_type>(rows));
+                crypto3::algebra::run_in_chunks<bool>(
+                    rows, 0,
+                    [&table, &row](std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; i++) {
+                            std::array<std::uint64_t, Columns> values = row(i);
+                            for (std::size_t j = 0; j < Columns; j++) {
+                                table[j][i] = values[j];
+                            }
+                        }
+                        return true;
+                    });
+            }
+
+            // Binary value of the bits of i, written as digits of the given base.
+            static std::uint64_t sparse_value(std::uint64_t i, std::uint64_t base) {
+                std::uint64_t result = 0, power = 1;
+                for (; i != 0; i >>= 1, power *= base) {
+                    result += (i & 1) * power;
+                }
+                return result;
+            }
+
+            // Binary value of r_values[d] over the digits d of i in the given base.
+            template<std::size_t Base>
+            static std::uint64_t reversed_sparse_value(std::uint64_t i, const std::array<std::uint64_t, Base> &r_values) {
+                std::uint64_t result = 0;
+                for (std::size_t j = 0; i != 0; i /= Base, j++) {
+                    result |= r_values[i % Base] << j;
+                }
+                return result;
+            }
 
             class byte_range_table_type: public lookup_table_definition{
             public:
@@ -177,23 +221,10 @@ namespace nil {
                     this->subtables["first_column"] = {{0}, 0, 16383};
                 };
                 virtual void generate(){
-                    this->_table.resize(2);
-                    std::vector<std::size_t> value_sizes = {14};
-
                     // lookup table for sparse values with base = 4
-                    for (typename BlueprintFieldType::integral_type i = 0u;
-                        i < typename BlueprintFieldType::integral_type(16384u);
-                        i++
-                    ) {
-                        std::vector<bool> value(14);
-                        for (std::size_t j = 0; j < 14; j++) {
-                            value[14 - j - 1] = boost::multiprecision::bit_test(i, j);
-                        }
-                        std::array<std::vector<typename BlueprintFieldType::integral_type>, 2> value_chunks =
-                            components::detail::split_and_sparse<BlueprintFieldType>(value, value_sizes, 4);
-                        this->_table[0].push_back(value_chunks[0][0]);
-                        this->_table[1].push_back(value_chunks[1][0]);
-                    }
+                    generate_table_in_chunks<2>(this->_table, 16384, [](std::uint64_t i) {
+                        return std::array<std::uint64_t, 2>{i, sparse_value(i, 4)};
+                    });
                 }
 
                 virtual std::size_t get_columns_number(){return 2;}
@@ -228,20 +259,9 @@ namespace nil {
                     this->subtables["second_column"] = {{1}, 0, 16383};
                 };
                 virtual void generate(){
-                    this->_table.resize(2);
-                    std::vector<std::size_t> value_sizes = {14};
-                    for (typename BlueprintFieldType::integral_type i = 0u;
-                        i < typename BlueprintFieldType::integral_type(16384u);
-                        i++) {
-                        std::vector<bool> value(14);
-                        for (std::size_t j = 0; j < 14; j++) {
-                            value[14 - j - 1] = boost::multiprecision::bit_test(i, j);
-                        }
-                        std::array<std::vector<typename BlueprintFieldType::integral_type>, 2> value_chunks =
-                            components::detail::split_and_sparse<BlueprintFieldType>(value, value_sizes, 7);
-                        this->_table[0].push_back(value_chunks[0][0]);
-                        this->_table[1].push_back(value_chunks[1][0]);
-                    }
+                    generate_table_in_chunks<2>(this->_table, 16384, [](std::uint64_t i) {
+                        return std::array<std::uint64_t, 2>{i, sparse_value(i, 7)};
+                    });
                 }
 
                 virtual std::size_t get_columns_number(){return 2;}
@@ -274,17 +294,11 @@ namespace nil {
                     this->subtables["first_column"] = {{0}, 0, 65535};
                 };
                 virtual void generate(){
-                    this->_table.resize(2);
-                    std::vector<std::size_t> value_sizes = {8};
-                    for (typename BlueprintFieldType::integral_type i = 0u;
-                        i < typename BlueprintFieldType::integral_type(65536u);
-                        i++
-                    ) {
-                        std::array<std::vector<typename BlueprintFieldType::integral_type>, 2>
-                            value = components::detail::reversed_sparse_and_split_maj<BlueprintFieldType>(i, value_sizes, 4);
-                        this->_table[0].push_back(value[0][0]);
-                        this->_table[1].push_back(value[1][0]);
-                    }
+                    // Same values as reversed_sparse_and_split_maj with base 4 and a single chunk of 8 digits.
+                    const std::array<std::uint64_t, 4> r_values = {0, 0, 1, 1};
+                    generate_table_in_chunks<2>(this->_table, 65536, [&r_values](std::uint64_t i) {
+                        return std::array<std::uint64_t, 2>{reversed_sparse_value<4>(i, r_values), i};
+                    });
                 }
 
                 virtual std::size_t get_columns_number(){return 2;}
@@ -298,17 +312,11 @@ namespace nil {
                     this->subtables["first_column"] = {{0}, 0, 5764800};
                 };
                 virtual void generate(){
-                    this->_table.resize(2);
-                    std::vector<std::size_t> value_sizes = {8};
-                    for (typename BlueprintFieldType::integral_type i = 0u;
-                        i < typename BlueprintFieldType::integral_type(5764801u);
-                        i++
-                    ) {
-                        std::array<std::vector<typename BlueprintFieldType::integral_type>, 2>
-                            value = components::detail::reversed_sparse_and_split_ch<BlueprintFieldType>(i, value_sizes, 7);
-                        this->_table[0].push_back(value[0][0]);
-                        this->_table[1].push_back(value[1][0]);
-                    }
+                    // Same values as reversed_sparse_and_split_ch with base 7 and a single chunk of 8 digits.
+                    const std::array<std::uint64_t, 7> r_values = {0, 0, 0, 1, 0, 1, 1};
+                    generate_table_in_chunks<2>(this->_table, 5764801, [&r_values](std::uint64_t i) {
+                        return std::array<std::uint64_t, 2>{reversed_sparse_value<7>(i, r_values), i};
+                    });
                 }
 
                 virtual std::size_t get_columns_number(){return 2;}
@@ -321,10 +329,9 @@ namespace nil {
                     this->subtables["full"] = {{0}, 0, 65535};
                 };
                 virtual void generate(){
-                    this->_table.resize(1);
-                    for (std::size_t i = 0; i < 65536; i++) {
-                        this->_table[0].push_back(i);
-                    }
+                    generate_table_in_chunks<1>(this->_table, 65536, [](std::uint64_t i) {
+                        return std::array<std::uint64_t, 1>{i};
+                    });
                 }
 
                 virtual std::size_t get_columns_number(){return 1;}
@@ -355,6 +362,15 @@ namespace nil {
                 tables[table->table_name] = table;
             }
 
+            /**
+             * Fixed tables with at least 'cached_table_min_rows' rows are loaded from the binary cache in
+             * 'directory' instead of being generated, and stored there after they are generated.
+             */
+            void set_table_cache_directory(const std::string &directory){
+                BOOST_ASSERT(!reserved_all);
+                table_cache = std::make_shared<table_cache_type>(directory);
+            }
+
             void register_dynamic_table(std::string table_name){
                 BOOST_ASSERT(tables.find(table_name) == tables.end());
                 dynamic_tables[table_name] = std::shared_ptr<dynamic_table_definition>(new dynamic_table_definition(table_name));
@@ -412,9 +428,7 @@ namespace nil {
                                     table->subtables.end());
 
                         if( reserved_tables_map.find(table_name) == reserved_tables_map.end() ){
-                            filled_lookup_table_definition *filled_definition =
-                                new filled_lookup_table_definition(*(table));
-                            reserved_tables_map[table_name] = std::shared_ptr<lookup_table_definition>(filled_definition);
+                            reserved_tables_map[table_name] = fill_table(table_name, table);
                         }
                         reserved_tables_map[table_name]->subtables[subtable_name] =
                             table->subtables[subtable_name];
@@ -436,6 +450,25 @@ namespace nil {
                 return reserved_dynamic_tables_map;
             }
         protected:
+            constexpr static const std::size_t cached_table_min_rows = 1 << 12;
+
+            std::shared_ptr<lookup_table_definition> fill_table(
+                const std::string &table_name, const std::shared_ptr<lookup_table_definition> &table
+            ) const {
+                if( !table_cache || table->get_rows_number() < cached_table_min_rows ){
+                    return std::shared_ptr<lookup_table_definition>(new filled_lookup_table_definition(*table));
+                }
+                const auto key = table_cache_type::table_key(*table);
+                typename table_cache_type::table_type cached;
+                if( table_cache->load(table_name, key, cached) ){
+                    return std::shared_ptr<lookup_table_definition>(
+                        new filled_lookup_table_definition(table_name, std::move(cached)));
+                }
+                auto filled_definition = std::shared_ptr<lookup_table_definition>(new filled_lookup_table_definition(*table));
+                table_cache->store(table_name, key, filled_definition->get_table());
+                return filled_definition;
+            }
+
             mutable bool reserved_all;
 
             std::set<std::string> reserved_tables;
@@ -444,6 +477,7 @@ namespace nil {
             mutable std::map<std::string, std::shared_ptr<lookup_table_definition>> reserved_tables_map;
             std::map<std::string, std::shared_ptr<dynamic_table_definition>> dynamic_tables;
             mutable std::map<std::string, std::shared_ptr<dynamic_table_definition>> reserved_dynamic_tables_map;
+            std::shared_ptr<table_cache_type> table_cache;
         };
     }        // namespace blueprint
 }    // namespace nil
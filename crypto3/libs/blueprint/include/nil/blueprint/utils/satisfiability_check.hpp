@@ -26,6 +26,20 @@
 #ifndef CRYPTO3_BLUEPRINT_UTILS_PLONK_SATISFIABILITY_CHECK_HPP
 #define CRYPTO3_BLUEPRINT_UTILS_PLONK_SATISFIABILITY_CHECK_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <set>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include <nil/crypto3/algebra/algorithms/run_in_chunks.hpp>
+
 #include <nil/blueprint/blueprint/plonk/assignment.hpp>
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
@@ -40,61 +54,416 @@
 namespace nil {
     namespace blueprint {
 
-        template<typename BlueprintFieldType>
-        bool is_satisfied(
-            const circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
-            const assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignments) {
-            std::set<uint32_t> used_gates;
-            for (std::uint32_t i = 0; i < bp.gates().size(); i++) {
-                used_gates.insert(i);
+        struct satisfiability_check_options {
+            // Number of threads used for the check, 0 to use all the hardware threads.
+            std::size_t threads = 0;
+            // The check stops after this number of failures is found, 0 to find all of them.
+            std::size_t max_failures = 1;
+            // Print the found failures to std::cout.
+            bool verbose = true;
+        };
+
+        struct satisfiability_failure {
+            enum class kind_type { gate, lookup_gate, lookup_table_not_found, copy_constraint };
+
+            kind_type kind;
+            // Index of the gate, lookup gate or copy constraint.
+            std::size_t index;
+            // Index of the constraint in the gate, 0 for copy constraints.
+            std::size_t constraint;
+            // Row of the failure, 0 for copy constraints and missing tables.
+            std::size_t row;
+
+            bool operator<(const satisfiability_failure &other) const {
+                return std::tie(kind, index, row, constraint) <
+                       std::tie(other.kind, other.index, other.row, other.constraint);
             }
+        };
 
-            std::set<uint32_t> used_lookup_gates;
-            for (std::uint32_t i = 0; i < bp.lookup_gates().size(); i++) {
-                used_lookup_gates.insert(i);
+        namespace detail {
+            template<typename BlueprintFieldType>
+            struct lookup_tuple_hash {
+                std::size_t operator()(const std::vector<typename BlueprintFieldType::value_type> &tuple) const {
+                    std::hash<typename BlueprintFieldType::value_type> hasher;
+                    std::size_t result = tuple.size();
+                    for (const auto &value : tuple) {
+                        boost::hash_combine(result, hasher(value));
+                    }
+                    return result;
+                }
+            };
+
+            template<typename BlueprintFieldType>
+            using lookup_tuple_set = std::unordered_set<std::vector<typename BlueprintFieldType::value_type>,
+                                                        lookup_tuple_hash<BlueprintFieldType>>;
+
+            // Value of the variable on the given row, rotations wrap around the table like in constraint evaluation.
+            template<typename BlueprintFieldType>
+            const typename BlueprintFieldType::value_type &variable_value(
+                const crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType> &assignments,
+                const crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type> &var,
+                std::size_t row) {
+                using var_column_type =
+                    typename crypto3::zk::snark::plonk_variable<typename BlueprintFieldType::value_type>::column_type;
+
+                const std::size_t rows_amount = assignments.rows_amount();
+                const std::size_t index = (rows_amount + row + var.rotation) % rows_amount;
+                switch (var.type) {
+                    case var_column_type::witness:
+                        return assignments.witness(var.index)[index];
+                    case var_column_type::public_input:
+                        return assignments.public_input(var.index)[index];
+                    case var_column_type::constant:
+                        return assignments.constant(var.index)[index];
+                    default:
+                        return assignments.selector(var.index)[index];
+                }
             }
 
-            std::set<uint32_t> used_copy_constraints;
-            for (std::uint32_t i = 0; i < bp.copy_constraints().size(); i++) {
-                used_copy_constraints.insert(i);
+            // Loads the tuples of a lookup table defined by the constraint system from the enabled rows of its tag selector.
+            template<typename BlueprintFieldType>
+            lookup_tuple_set<BlueprintFieldType> load_lookup_table(
+                const crypto3::zk::snark::plonk_lookup_table<BlueprintFieldType> &table,
+                const crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType> &assignments) {
+                lookup_tuple_set<BlueprintFieldType> result;
+                const auto &selector = assignments.selector(table.tag_index);
+
+                for (std::size_t selector_row = 0; selector_row < assignments.rows_amount(); selector_row++) {
+                    if (selector_row < selector.size() && !selector[selector_row].is_zero()) {
+                        for (const auto &option : table.lookup_options) {
+                            std::vector<typename BlueprintFieldType::value_type> item;
+                            item.reserve(option.size());
+                            for (const auto &var : option) {
+                                item.emplace_back(variable_value(assignments, var, selector_row));
+                            }
+                            result.insert(std::move(item));
+                        }
+                    }
+                }
+                return result;
             }
 
-            std::set<uint32_t> selector_rows;
-            for (std::uint32_t i = 0; i < assignments.allocated_rows(); i++) {
-                selector_rows.insert(i);
+            // Loads the rows of the given columns of a reserved lookup table.
+            template<typename BlueprintFieldType>
+            lookup_tuple_set<BlueprintFieldType> load_reserved_table(
+                const std::vector<std::vector<typename BlueprintFieldType::value_type>> &table,
+                const std::vector<std::size_t> &column_indices) {
+                lookup_tuple_set<BlueprintFieldType> result;
+                if (table.empty()) {
+                    return result;
+                }
+                result.reserve(table[0].size());
+                for (std::size_t row = 0; row < table[0].size(); row++) {
+                    std::vector<typename BlueprintFieldType::value_type> item;
+                    item.reserve(column_indices.size());
+                    for (std::size_t column : column_indices) {
+                        item.emplace_back(table[column][row]);
+                    }
+                    result.insert(std::move(item));
+                }
+                return result;
             }
 
-            return is_satisfied(bp, assignments, used_gates, used_lookup_gates, used_copy_constraints, selector_rows);
-        }
+            /**
+             * Checks the gates and lookup gates row-parallel and the copy constraints in parallel chunks.
+             * Lookup inputs are searched in 'lookup_tables', which maps table ids to the hashed table tuples.
+             * CopyValue returns the value of a copy constraint variable.
+             */
+            template<typename BlueprintFieldType, typename CopyValue>
+            std::vector<satisfiability_failure> check_satisfiability(
+                const crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType> &cs,
+                const crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType> &assignments,
+                const std::vector<std::uint32_t> &used_gates,
+                const std::vector<std::uint32_t> &used_lookup_gates,
+                const std::vector<std::uint32_t> &used_copy_constraints,
+                const std::vector<std::uint32_t> &selector_rows,
+                const std::map<std::size_t, lookup_tuple_set<BlueprintFieldType>> &lookup_tables,
+                CopyValue copy_value,
+                const satisfiability_check_options &options) {
+
+                using value_type = typename BlueprintFieldType::value_type;
+                using column_type = crypto3::zk::snark::plonk_column<BlueprintFieldType>;
+
+                const auto &gates = cs.gates();
+                const auto &lookup_gates = cs.lookup_gates();
+                const auto &copy_constraints = cs.copy_constraints();
+
+                std::vector<satisfiability_failure> result;
+                std::atomic<std::size_t> failures_found(0);
+                auto should_stop = [&options, &failures_found]() {
+                    return options.max_failures != 0 &&
+                           failures_found.load(std::memory_order_relaxed) >= options.max_failures;
+                };
+                auto add_failure = [&failures_found](std::vector<satisfiability_failure> &failures,
+                                                     satisfiability_failure failure) {
+                    failures.push_back(failure);
+                    failures_found.fetch_add(1, std::memory_order_relaxed);
+                };
+
+                for (std::uint32_t i : used_lookup_gates) {
+                    for (std::size_t j = 0; j < lookup_gates[i].constraints.size(); j++) {
+                        if (lookup_tables.find(lookup_gates[i].constraints[j].table_id) == lookup_tables.end()) {
+                            add_failure(result, {satisfiability_failure::kind_type::lookup_table_not_found, i, j, 0});
+                        }
+                    }
+                }
+
+                std::vector<const column_type *> gate_selectors, lookup_gate_selectors;
+                for (std::uint32_t i : used_gates) {
+                    gate_selectors.push_back(&assignments.selector(gates[i].selector_index));
+                }
+                for (std::uint32_t i : used_lookup_gates) {
+                    lookup_gate_selectors.push_back(&assignments.selector(lookup_gates[i].tag_index));
+                }
+
+                auto row_failures = crypto3::algebra::run_in_chunks<std::vector<satisfiability_failure>>(
+                    selector_rows.size(), options.threads,
+                    [&](std::size_t begin, std::size_t end) {
+                        std::vector<satisfiability_failure> failures;
+                        std::vector<value_type> input_values;
+                        for (std::size_t r = begin; r < end && !should_stop(); r++) {
+                            const std::size_t selector_row = selector_rows[r];
+
+                            for (std::size_t g = 0; g < used_gates.size(); g++) {
+                                const auto &selector = *gate_selectors[g];
+                                if (selector_row >= selector.size() || selector[selector_row].is_zero()) {
+                                    continue;
+                                }
+                                const auto &gate = gates[used_gates[g]];
+                                for (std::size_t j = 0; j < gate.constraints.size(); j++) {
+                                    if (!gate.constraints[j].evaluate(selector_row, assignments).is_zero()) {
+                                        add_failure(failures, {satisfiability_failure::kind_type::gate,
+                                                               used_gates[g], j, selector_row});
+                                    }
+                                }
+                            }
+
+                            for (std::size_t g = 0; g < used_lookup_gates.size(); g++) {
+                                const auto &selector = *lookup_gate_selectors[g];
+                                if (selector_row >= selector.size() || selector[selector_row].is_zero()) {
+                                    continue;
+                                }
+                                const auto &gate = lookup_gates[used_lookup_gates[g]];
+                                for (std::size_t j = 0; j < gate.constraints.size(); j++) {
+                                    auto table = lookup_tables.find(gate.constraints[j].table_id);
+                                    if (table == lookup_tables.end()) {
+                                        continue;
+                                    }
+                                    input_values.clear();
+                                    for (const auto &input : gate.constraints[j].lookup_input) {
+                                        input_values.emplace_back(input.evaluate(selector_row, assignments));
+                                    }
+                                    if (table->second.find(input_values) == table->second.end()) {
+                                        add_failure(failures, {satisfiability_failure::kind_type::lookup_gate,
+                                                               used_lookup_gates[g], j, selector_row});
+                                    }
+                                }
+                            }
+                        }
+                        return failures;
+                    });
+
+                auto copy_failures = crypto3::algebra::run_in_chunks<std::vector<satisfiability_failure>>(
+                    used_copy_constraints.size(), options.threads,
+                    [&](std::size_t begin, std::size_t end) {
+                        std::vector<satisfiability_failure> failures;
+                        for (std::size_t c = begin; c < end && !should_stop(); c++) {
+                            const auto &constraint = copy_constraints[used_copy_constraints[c]];
+                            if (copy_value(constraint.first) != copy_value(constraint.second)) {
+                                add_failure(failures, {satisfiability_failure::kind_type::copy_constraint,
+                                                       used_copy_constraints[c], 0, 0});
+                            }
+                        }
+                        return failures;
+                    });
+
+                for (const auto &failures : row_failures) {
+                    result.insert(result.end(), failures.begin(), failures.end());
+                }
+                for (const auto &failures : copy_failures) {
+                    result.insert(result.end(), failures.begin(), failures.end());
+                }
+                std::sort(result.begin(), result.end());
+                if (options.max_failures != 0 && result.size() > options.max_failures) {
+                    result.resize(options.max_failures);
+                }
+                return result;
+            }
+
+            template<typename BlueprintFieldType, typename CopyValue>
+            void print_failure(
+                const crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType> &cs,
+                const crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType> &assignments,
+                const satisfiability_failure &failure,
+                const std::function<std::string(std::size_t)> &table_name,
+                CopyValue copy_value) {
+
+                switch (failure.kind) {
+                    case satisfiability_failure::kind_type::gate: {
+                        const auto &gate = cs.gates()[failure.index];
+                        std::cout << "Constraint " << failure.constraint << " from gate " << failure.index
+                                  << " on row " << failure.row << " is not satisfied." << std::endl;
+                        std::cout << "Constraint result: "
+                                  << gate.constraints[failure.constraint].evaluate(failure.row, assignments)
+                                  << std::endl;
+                        std::cout << "Offending gate:" << std::endl;
+                        for (const auto &constraint : gate.constraints) {
+                            std::cout << constraint << std::endl;
+                        }
+                        break;
+                    }
+                    case satisfiability_failure::kind_type::lookup_gate: {
+                        const auto &gate = cs.lookup_gates()[failure.index];
+                        const auto &lookup_constraint = gate.constraints[failure.constraint];
+                        std::cout << "Input values:";
+                        for (const auto &input : lookup_constraint.lookup_input) {
+                            std::cout << input.evaluate(failure.row, assignments) << " ";
+                        }
+                        std::cout << std::endl;
+                        std::cout << "Constraint " << failure.constraint << " from lookup gate " << failure.index
+                                  << " from table " << table_name(lookup_constraint.table_id) << " on row "
+                                  << failure.row << " is not satisfied." << std::endl;
+                        std::cout << "Offending Lookup Gate: " << std::endl;
+                        for (const auto &constraint : gate.constraints) {
+                            std::cout << "Table id: " << constraint.table_id << std::endl;
+                            for (const auto &lookup_input : constraint.lookup_input) {
+                                std::cout << lookup_input << std::endl;
+                            }
+                        }
+                        break;
+                    }
+                    case satisfiability_failure::kind_type::lookup_table_not_found: {
+                        const std::size_t table_id =
+                            cs.lookup_gates()[failure.index].constraints[failure.constraint].table_id;
+                        std::cout << "Lookup table " << table_name(table_id) << " not found." << std::endl;
+                        std::cout << "Table_id = " << table_id << " used by constraint " << failure.constraint
+                                  << " from lookup gate " << failure.index << std::endl;
+                        break;
+                    }
+                    case satisfiability_failure::kind_type::copy_constraint: {
+                        const auto &constraint = cs.copy_constraints()[failure.index];
+                        std::cout << "Copy constraint number " << failure.index << " is not satisfied."
+                                  << " First variable: " << constraint.first
+                                  << " second variable: " << constraint.second << std::endl;
+                        std::cout << copy_value(constraint.first) << " != " << copy_value(constraint.second)
+                                  << std::endl;
+                        break;
+                    }
+                }
+            }
+
+            inline std::vector<std::uint32_t> all_indices(std::size_t size) {
+                std::vector<std::uint32_t> result(size);
+                for (std::uint32_t i = 0; i < size; i++) {
+                    result[i] = i;
+                }
+                return result;
+            }
+        }    // namespace detail
 
         template<typename BlueprintFieldType>
-        std::set<std::vector<typename BlueprintFieldType::value_type>>
+        detail::lookup_tuple_set<BlueprintFieldType>
         load_dynamic_lookup(
             const circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
             const assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignments,
             std::size_t table_id
         ){
-            std::set<std::vector<typename BlueprintFieldType::value_type>> result;
-            auto &table = bp.lookup_tables()[table_id-1];
-
-            crypto3::zk::snark::plonk_column<BlueprintFieldType> selector =
-                assignments.crypto3::zk::snark::
-                    template plonk_assignment_table<BlueprintFieldType>::selector(table.tag_index);
-
-            for( std::size_t selector_row = 0; selector_row < assignments.rows_amount(); selector_row++ ){
-                if( selector_row < selector.size() && !selector[selector_row].is_zero() ){
-                    for( std::size_t op = 0; op < table.lookup_options.size(); op++){
-                        std::vector<typename BlueprintFieldType::value_type> item(table.lookup_options[op].size());
-                        for( std::size_t i = 0; i < table.lookup_options[op].size(); i++){
-                            crypto3::zk::snark::plonk_constraint<BlueprintFieldType> expr = table.lookup_options[op][i];;
-                            item[i] = expr.evaluate(selector_row, assignments);
-                        }
-                        result.insert(item);
+            return detail::load_lookup_table<BlueprintFieldType>(bp.lookup_tables()[table_id - 1], assignments);
+        }
+
+        /**
+         * Checks the given gates, lookup gates and copy constraints of a blueprint circuit on the given rows.
+         * Gates are evaluated row-parallel, lookup tables are hashed once before the check.
+         * \returns the found failures sorted by kind, index and row, empty if the circuit is satisfied.
+         */
+        template<typename BlueprintFieldType>
+        std::vector<satisfiability_failure> check_satisfiability(
+            const circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            const assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignments,
+            const std::set<std::uint32_t> &used_gates,
+            const std::set<std::uint32_t> &used_lookup_gates,
+            const std::set<std::uint32_t> &used_copy_constraints,
+            const std::set<std::uint32_t> &selector_rows,
+            const satisfiability_check_options &options = {}) {
+
+            using zk_table_type = crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType>;
+
+            // Collect the tables used by the checked lookup gates, static tables are hashed in parallel.
+            std::map<std::size_t, detail::lookup_tuple_set<BlueprintFieldType>> lookup_tables;
+            std::vector<std::pair<std::size_t, std::string>> static_tables;
+            for (std::uint32_t i : used_lookup_gates) {
+                for (const auto &constraint : bp.lookup_gates()[i].constraints) {
+                    const std::size_t table_id = constraint.table_id;
+                    if (lookup_tables.find(table_id) != lookup_tables.end()) {
+                        continue;
+                    }
+                    const auto name = bp.get_reserved_indices_right().find(table_id);
+                    if (name == bp.get_reserved_indices_right().end()) {
+                        continue;
+                    }
+                    const std::string &table_name = name->second;
+                    if (bp.get_reserved_dynamic_tables().find(table_name) != bp.get_reserved_dynamic_tables().end()) {
+                        lookup_tables[table_id] = load_dynamic_lookup(bp, assignments, table_id);
+                        continue;
+                    }
+                    const std::string main_table_name = table_name.substr(0, table_name.find("/"));
+                    const std::string subtable_name = table_name.substr(table_name.find("/") + 1);
+                    const auto table = bp.get_reserved_tables().find(main_table_name);
+                    if (table == bp.get_reserved_tables().end() ||
+                        table->second->subtables.find(subtable_name) == table->second->subtables.end()) {
+                        continue;
                     }
+                    // Reserved tables are generated lazily, do it before the parallel part.
+                    table->second->get_table();
+                    lookup_tables[table_id];
+                    static_tables.emplace_back(table_id, table_name);
                 }
             }
+            auto loaded_tables =
+                crypto3::algebra::run_in_chunks<std::vector<detail::lookup_tuple_set<BlueprintFieldType>>>(
+                    static_tables.size(), options.threads,
+                    [&bp, &static_tables](std::size_t begin, std::size_t end) {
+                        std::vector<detail::lookup_tuple_set<BlueprintFieldType>> result;
+                        for (std::size_t i = begin; i < end; i++) {
+                            const std::string &table_name = static_tables[i].second;
+                            const auto &table = bp.get_reserved_tables().at(table_name.substr(0, table_name.find("/")));
+                            const auto &subtable = table->subtables.at(table_name.substr(table_name.find("/") + 1));
+                            result.emplace_back(detail::load_reserved_table<BlueprintFieldType>(
+                                table->get_table(), subtable.column_indices));
+                        }
+                        return result;
+                    });
+            std::size_t loaded_index = 0;
+            for (auto &chunk : loaded_tables) {
+                for (auto &table : chunk) {
+                    lookup_tables[static_tables[loaded_index++].first] = std::move(table);
+                }
+            }
+
+            auto copy_value = [&assignments](const crypto3::zk::snark::plonk_variable<
+                                             typename BlueprintFieldType::value_type> &var) {
+                return var_value(assignments, var);
+            };
+
+            auto failures = detail::check_satisfiability<BlueprintFieldType>(
+                bp, static_cast<const zk_table_type &>(assignments),
+                std::vector<std::uint32_t>(used_gates.begin(), used_gates.end()),
+                std::vector<std::uint32_t>(used_lookup_gates.begin(), used_lookup_gates.end()),
+                std::vector<std::uint32_t>(used_copy_constraints.begin(), used_copy_constraints.end()),
+                std::vector<std::uint32_t>(selector_rows.begin(), selector_rows.end()),
+                lookup_tables, copy_value, options);
 
-            return result;
+            if (options.verbose) {
+                auto table_name = [&bp](std::size_t table_id) -> std::string {
+                    const auto name = bp.get_reserved_indices_right().find(table_id);
+                    return name == bp.get_reserved_indices_right().end() ? std::to_string(table_id) : name->second;
+                };
+                for (const auto &failure : failures) {
+                    detail::print_failure<BlueprintFieldType>(
+                        bp, static_cast<const zk_table_type &>(assignments), failure, table_name, copy_value);
+                }
+            }
+            return failures;
         }
 
         template<typename BlueprintFieldType>
@@ -104,151 +473,89 @@ namespace nil {
             const std::set<std::uint32_t> &used_gates,
             const std::set<std::uint32_t> &used_lookup_gates,
             const std::set<std::uint32_t> &used_copy_constraints,
-            const std::set<std::uint32_t> &selector_rows){
+            const std::set<std::uint32_t> &selector_rows,
+            const satisfiability_check_options &options = {}) {
+            return check_satisfiability(bp, assignments, used_gates, used_lookup_gates, used_copy_constraints,
+                                        selector_rows, options).empty();
+        }
+
+        template<typename BlueprintFieldType>
+        bool is_satisfied(
+            const circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            const assignment<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &assignments,
+            const satisfiability_check_options &options = {}) {
+            std::set<uint32_t> used_gates;
+            for (std::uint32_t i = 0; i < bp.gates().size(); i++) {
+                used_gates.insert(i);
+            }
 
-            const auto &gates = bp.gates();
+            std::set<uint32_t> used_lookup_gates;
+            for (std::uint32_t i = 0; i < bp.lookup_gates().size(); i++) {
+                used_lookup_gates.insert(i);
+            }
 
-            const auto &copy_constraints = bp.copy_constraints();
+            std::set<uint32_t> used_copy_constraints;
+            for (std::uint32_t i = 0; i < bp.copy_constraints().size(); i++) {
+                used_copy_constraints.insert(i);
+            }
 
-            const auto &lookup_gates = bp.lookup_gates();
+            std::set<uint32_t> selector_rows;
+            for (std::uint32_t i = 0; i < assignments.allocated_rows(); i++) {
+                selector_rows.insert(i);
+            }
 
-            std::map<std::string, std::set<std::vector<typename BlueprintFieldType::value_type>>> used_dynamic_tables;
+            return is_satisfied(bp, assignments, used_gates, used_lookup_gates, used_copy_constraints, selector_rows,
+                                options);
+        }
 
-            for (const auto& i : used_gates) {
-                crypto3::zk::snark::plonk_column<BlueprintFieldType> selector =
-                    assignments.crypto3::zk::snark::
-                        template plonk_assignment_table<BlueprintFieldType>::selector(
-                            gates[i].selector_index);
+        /**
+         * Checks a constraint system against an assignment table, e.g. the ones read from marshalled files.
+         * All the lookup tables are defined by the constraint system and are read from the table.
+         */
+        template<typename BlueprintFieldType>
+        std::vector<satisfiability_failure> check_table_satisfiability(
+            const crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType> &cs,
+            const crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType> &assignments,
+            const satisfiability_check_options &options = {}) {
 
-                for (const auto& selector_row : selector_rows) {
-                    if (selector_row < selector.size() && !selector[selector_row].is_zero()) {
-                        for (std::size_t j = 0; j < gates[i].constraints.size(); j++) {
-
-                            typename BlueprintFieldType::value_type constraint_result =
-                                gates[i].constraints[j].evaluate(selector_row, assignments);
-
-                            if (!constraint_result.is_zero()) {
-                                std::cout << "Constraint " << j << " from gate " << i << " on row " << selector_row
-                                          << " is not satisfied." << std::endl;
-                                std::cout << "Constraint result: " << constraint_result << std::endl;
-                                std::cout << "Offending gate:" << std::endl;
-                                for (const auto &constraint : gates[i].constraints) {
-                                    std::cout << constraint << std::endl;
-                                }
-                                return false;
-                            }
+            const auto &tables = cs.lookup_tables();
+            auto loaded_tables =
+                crypto3::algebra::run_in_chunks<std::vector<detail::lookup_tuple_set<BlueprintFieldType>>>(
+                    tables.size(), options.threads,
+                    [&tables, &assignments](std::size_t begin, std::size_t end) {
+                        std::vector<detail::lookup_tuple_set<BlueprintFieldType>> result;
+                        for (std::size_t i = begin; i < end; i++) {
+                            result.emplace_back(detail::load_lookup_table<BlueprintFieldType>(tables[i], assignments));
                         }
-                    }
+                        return result;
+                    });
+            // Lookup gates refer to the tables by their 1-based index.
+            std::map<std::size_t, detail::lookup_tuple_set<BlueprintFieldType>> lookup_tables;
+            for (auto &chunk : loaded_tables) {
+                for (auto &table : chunk) {
+                    lookup_tables.emplace(lookup_tables.size() + 1, std::move(table));
                 }
             }
 
-            for (const auto& i : used_lookup_gates) {
-                crypto3::zk::snark::plonk_column<BlueprintFieldType> selector =
-                    assignments.crypto3::zk::snark::
-                        template plonk_assignment_table<BlueprintFieldType>::selector(
-                            lookup_gates[i].tag_index);
+            auto copy_value = [&assignments](const crypto3::zk::snark::plonk_variable<
+                                             typename BlueprintFieldType::value_type> &var) {
+                return detail::variable_value(assignments, var, 0);
+            };
 
-                for (const auto& selector_row : selector_rows) {
-                    if (selector_row < selector.size() && !selector[selector_row].is_zero()) {
-                        for (std::size_t j = 0; j < lookup_gates[i].constraints.size(); j++) {
-                            std::vector<typename BlueprintFieldType::value_type> input_values;
-                            input_values.reserve(lookup_gates[i].constraints[j].lookup_input.size());
-                            for (std::size_t k = 0; k < lookup_gates[i].constraints[j].lookup_input.size(); k++) {
-                                input_values.emplace_back(lookup_gates[i].constraints[j].lookup_input[k].evaluate(
-                                    selector_row, assignments));
-                            }
-                            const auto table_name =
-                                bp.get_reserved_indices_right().at(lookup_gates[i].constraints[j].table_id);
-                            try {
-                                if( bp.get_reserved_dynamic_tables().find(table_name) != bp.get_reserved_dynamic_tables().end() ){
-                                    if( used_dynamic_tables.find(table_name) == used_dynamic_tables.end()){
-                                        used_dynamic_tables[table_name] = load_dynamic_lookup(bp, assignments, lookup_gates[i].constraints[j].table_id);
-                                    }
-                                    if( used_dynamic_tables[table_name].find(input_values) == used_dynamic_tables[table_name].end() ) {
-                                        for (std::size_t k = 0; k < input_values.size(); k++) {
-                                            std::cout << input_values[k] << " ";
-                                        }
-                                        std::cout << std::endl;
-                                        std::cout << "Constraint " << j << " from lookup gate " << i << " from table "
-                                                << table_name << " on row " << selector_row << " is not satisfied."
-                                                << std::endl;
-                                        std::cout << "Offending Lookup Gate: " << std::endl;
-                                        for (const auto &constraint : lookup_gates[i].constraints) {
-                                            std::cout << "Table id: " << constraint.table_id << std::endl;
-                                            for (auto &lookup_input : constraint.lookup_input) {
-                                                std::cout << lookup_input << std::endl;
-                                            }
-                                        }
-                                        return false;
-                                    }
-                                    continue;
-                                }
-                                std::string main_table_name = table_name.substr(0, table_name.find("/"));
-                                std::string subtable_name =
-                                    table_name.substr(table_name.find("/") + 1, table_name.size() - 1);
-
-                                const auto &table = bp.get_reserved_tables().at(main_table_name)->get_table();
-                                const auto &subtable =
-                                    bp.get_reserved_tables().at(main_table_name)->subtables.at(subtable_name);
-
-                                std::size_t columns_number = subtable.column_indices.size();
-
-                                // Search the table for the input values
-                                // We can cache it with sorting, or use KMP, but I need a simple solution first
-                                bool found = false;
-                                BOOST_ASSERT(columns_number == input_values.size());
-                                for (std::size_t k = 0; k < table[0].size(); k++) {
-                                    bool match = true;
-                                    for (std::size_t l = 0; l < columns_number; l++) {
-                                        if (table[subtable.column_indices[l]][k] != input_values[l]) {
-                                            match = false;
-                                            break;
-                                        }
-                                    }
-                                    if (match) {
-                                        found = true;
-                                        break;
-                                    }
-                                }
-                                if (!found) {
-                                    std::cout << "Input values:";
-                                    for (std::size_t k = 0; k < input_values.size(); k++) {
-                                        std::cout << input_values[k] << " ";
-                                    }
-                                    std::cout << std::endl;
-                                    std::cout << "Constraint " << j << " from lookup gate " << i << " from table "
-                                              << table_name << " on row " << selector_row << " is not satisfied."
-                                              << std::endl;
-                                    std::cout << "Offending Lookup Gate: " << std::endl;
-                                    for (const auto &constraint : lookup_gates[i].constraints) {
-                                        std::cout << "Table id: " << constraint.table_id << std::endl;
-                                        for (auto &lookup_input : constraint.lookup_input) {
-                                            std::cout << lookup_input << std::endl;
-                                        }
-                                    }
-                                    return false;
-                                }
-                            } catch (std::out_of_range &e) {
-                                std::cout << "Lookup table " << table_name << " not found." << std::endl;
-                                std::cout << "Table_id = " << lookup_gates[i].constraints[j].table_id << " table_name " << table_name << std::endl;
-                                return false;
-                            }
-                        }
-                    }
-                }
-            }
+            auto failures = detail::check_satisfiability<BlueprintFieldType>(
+                cs, assignments, detail::all_indices(cs.gates().size()), detail::all_indices(cs.lookup_gates().size()),
+                detail::all_indices(cs.copy_constraints().size()), detail::all_indices(assignments.rows_amount()),
+                lookup_tables, copy_value, options);
 
-            for (const auto& i : used_copy_constraints) {
-                if (var_value(assignments, copy_constraints[i].first) !=
-                    var_value(assignments, copy_constraints[i].second)) {
-                    std::cout << "Copy constraint number " << i << " is not satisfied."
-                              << " First variable: " << copy_constraints[i].first
-                              << " second variable: " << copy_constraints[i].second << std::endl;
-                    std::cout << var_value(assignments, copy_constraints[i].first) << " != " << var_value(assignments, copy_constraints[i].second) << std::endl;
-                    return false;
+            if (options.verbose) {
+                auto table_name = [](std::size_t table_id) {
+                    return std::to_string(table_id);
+                };
+                for (const auto &failure : failures) {
+                    detail::print_failure<BlueprintFieldType>(cs, assignments, failure, table_name, copy_value);
                 }
             }
-            return true;
+            return failures;
         }
 
     }    // namespace blueprint
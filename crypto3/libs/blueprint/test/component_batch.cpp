@@ -515,4 +515,49 @@ BOOST_AUTO_TEST_CASE(component_batch_generate_circuit_variant_basic_test) {
     BOOST_ASSERT(var_value(assignment_table, res_2.output) != 0);
 }
 
+BOOST_AUTO_TEST_CASE(component_batch_large_batch_test) {
+    using curve_type = nil::crypto3::algebra::curves::vesta;
+    using field_type = typename curve_type::scalar_field_type;
+
+    using assignment_type = assignment<nil::crypto3::zk::snark::plonk_constraint_system<field_type>>;
+    using circuit_type = circuit<nil::crypto3::zk::snark::plonk_constraint_system<field_type>>;
+    using ArithmetizationType = nil::crypto3::zk::snark::plonk_constraint_system<field_type>;
+    using var = crypto3::zk::snark::plonk_variable<typename field_type::value_type>;
+
+    assignment_type assignment_table(15, 1, 0, 1);
+    circuit_type circuit;
+    public_input_var_maker<field_type> public_input_var_maker(assignment_table);
+
+    using multiplication_type = components::multiplication<
+        ArithmetizationType, field_type, nil::blueprint::basic_non_native_policy<field_type>>;
+    using input_type = typename multiplication_type::input_type;
+
+    // enough rows for finalize_batch to split them between threads
+    constexpr std::size_t inputs_amount = 1000;
+    std::vector<input_type> inputs;
+    std::vector<var> results;
+    for (std::size_t i = 0; i < inputs_amount; i++) {
+        inputs.push_back({public_input_var_maker(), public_input_var_maker()});
+        results.push_back(assignment_table.add_input_to_batch_assignment<multiplication_type>(inputs.back()).output);
+    }
+    // repeated inputs are deduplicated
+    for (std::size_t i = 0; i < inputs_amount; i += 7) {
+        auto result = assignment_table.add_input_to_batch_assignment<multiplication_type>(inputs[i]).output;
+        BOOST_CHECK(result == results[i]);
+    }
+
+    std::size_t row = assignment_table.finalize_component_batches(circuit, 0);
+    BOOST_CHECK_EQUAL(row, inputs_amount / 5);
+    BOOST_CHECK_EQUAL(circuit.gates().size(), 1);
+    BOOST_CHECK_EQUAL(circuit.copy_constraints().size(), 2 * inputs_amount);
+
+    const auto &variable_map = assignment_table.get_batch_variable_map();
+    for (std::size_t i = 0; i < inputs_amount; i++) {
+        const var actual = variable_map.at(results[i]);
+        BOOST_CHECK(actual.type == var::column_type::witness);
+        BOOST_CHECK(var_value(assignment_table, actual) ==
+                    var_value(assignment_table, inputs[i].x) * var_value(assignment_table, inputs[i].y));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,185 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE blueprint_lookup_table_cache_test
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/blueprint/lookup_library.hpp>
+#include <nil/blueprint/components/hashes/sha2/plonk/detail/split_functions.hpp>
+
+using namespace nil::blueprint;
+using namespace nil::crypto3;
+
+using field_type = algebra::curves::pallas::base_field_type;
+using value_type = typename field_type::value_type;
+using integral_type = typename field_type::integral_type;
+using table_type = std::vector<std::vector<value_type>>;
+
+namespace {
+    // Reserves the full tables and returns their content, in the same order.
+    std::vector<table_type> get_tables(lookup_library<field_type> &library, const std::vector<std::string> &table_names) {
+        for (const auto &table_name : table_names) {
+            library.reserve_table(table_name + "/full");
+        }
+        std::vector<table_type> result;
+        for (const auto &table_name : table_names) {
+            result.push_back(library.get_reserved_tables().at(table_name)->get_table());
+        }
+        return result;
+    }
+
+    std::filesystem::path make_cache_directory() {
+        std::filesystem::path directory = std::filesystem::temp_directory_path() /
+                                          ("blueprint_lookup_table_cache_" + std::to_string(std::random_device()()));
+        std::filesystem::create_directories(directory);
+        return directory;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(lookup_table_cache_test_suite)
+
+BOOST_AUTO_TEST_CASE(lookup_library_sparse_tables) {
+    const std::vector<std::size_t> sparse_sizes = {14}, function_sizes = {8};
+
+    for (std::size_t base : {4, 7}) {
+        lookup_library<field_type> library;
+        table_type table = get_tables(library, {"sha256_sparse_base" + std::to_string(base)})[0];
+        BOOST_CHECK_EQUAL(table.size(), 2);
+        BOOST_CHECK_EQUAL(table[0].size(), 16384);
+        for (std::size_t i = 0; i < 16384; i++) {
+            std::vector<bool> value(14);
+            for (std::size_t j = 0; j < 14; j++) {
+                value[14 - j - 1] = (i >> j) & 1;
+            }
+            auto expected = components::detail::split_and_sparse<field_type>(value, sparse_sizes, base);
+            BOOST_CHECK(table[0][i] == value_type(expected[0][0]));
+            BOOST_CHECK(table[1][i] == value_type(expected[1][0]));
+        }
+    }
+
+    lookup_library<field_type> library;
+    auto function_tables = get_tables(library, {"sha256_maj", "sha256_ch"});
+    const table_type &maj = function_tables[0], &ch = function_tables[1];
+    BOOST_CHECK_EQUAL(maj[0].size(), 65536);
+    for (std::size_t i = 0; i < 65536; i += 7) {
+        auto expected = components::detail::reversed_sparse_and_split_maj<field_type>(integral_type(i), function_sizes, 4);
+        BOOST_CHECK(maj[0][i] == value_type(expected[0][0]));
+        BOOST_CHECK(maj[1][i] == value_type(expected[1][0]));
+    }
+
+    BOOST_CHECK_EQUAL(ch[0].size(), 5764801);
+    for (std::size_t i = 0; i < 5764801; i += 1031) {
+        auto expected = components::detail::reversed_sparse_and_split_ch<field_type>(integral_type(i), function_sizes, 7);
+        BOOST_CHECK(ch[0][i] == value_type(expected[0][0]));
+        BOOST_CHECK(ch[1][i] == value_type(expected[1][0]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lookup_table_cache_round_trip) {
+    const std::filesystem::path directory = make_cache_directory();
+    detail::lookup_table_cache<field_type> cache(directory.string());
+
+    table_type table(3, std::vector<value_type>(1000));
+    for (std::size_t i = 0; i < 3; i++) {
+        for (std::size_t j = 0; j < 1000; j++) {
+            table[i][j] = value_type(i * 1000 + j).pow(3) - value_type::one();
+        }
+    }
+    const detail::lookup_table_cache<field_type>::table_key_type key = {3, 1000, 0x1234};
+    table_type loaded;
+    BOOST_CHECK(!cache.load("test_table", key, loaded));
+    BOOST_CHECK(cache.store("test_table", key, table));
+    BOOST_CHECK(cache.load("test_table", key, loaded));
+    BOOST_CHECK(loaded == table);
+
+    // Files of another definition or of other dimensions are stale.
+    BOOST_CHECK(!cache.load("test_table", {3, 1000, 0x1235}, loaded));
+    BOOST_CHECK(!cache.load("test_table", {3, 999, 0x1234}, loaded));
+    BOOST_CHECK(!cache.store("test_table", {2, 1000, 0x1234}, table));
+
+    // A damaged file is not loaded.
+    {
+        std::fstream file(cache.file_path("test_table"), std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put(0x5a);
+    }
+    BOOST_CHECK(!cache.load("test_table", key, loaded));
+
+    std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(lookup_table_cache_key) {
+    using definition_type = zk::snark::filled_lookup_table_definition<field_type>;
+    using cache_type = detail::lookup_table_cache<field_type>;
+
+    definition_type table("test_table", table_type(2, std::vector<value_type>(16)));
+    table.subtables["full"] = {{0, 1}, 0, 15};
+    const auto key = cache_type::table_key(table);
+    BOOST_CHECK_EQUAL(key.columns, 2);
+    BOOST_CHECK_EQUAL(key.rows, 16);
+    BOOST_CHECK_EQUAL(cache_type::table_key(table).definition, key.definition);
+
+    // The definition hash covers the name and the subtables of the table.
+    definition_type renamed("other_table", table_type(2, std::vector<value_type>(16)));
+    renamed.subtables = table.subtables;
+    BOOST_CHECK_NE(cache_type::table_key(renamed).definition, key.definition);
+
+    table.subtables["first"] = {{0}, 0, 15};
+    BOOST_CHECK_NE(cache_type::table_key(table).definition, key.definition);
+    table.subtables["first"] = {{1}, 0, 15};
+    const auto second_column_key = cache_type::table_key(table);
+    table.subtables["first"] = {{0}, 0, 7};
+    BOOST_CHECK_NE(cache_type::table_key(table).definition, second_column_key.definition);
+}
+
+BOOST_AUTO_TEST_CASE(lookup_library_uses_table_cache) {
+    const std::filesystem::path directory = make_cache_directory();
+
+    lookup_library<field_type> generating_library;
+    generating_library.set_table_cache_directory(directory.string());
+    auto generated = get_tables(generating_library, {"sha256_reverse_sparse_base4", "binary_xor_table"});
+
+    detail::lookup_table_cache<field_type> cache(directory.string());
+    BOOST_CHECK(std::filesystem::exists(cache.file_path("sha256_reverse_sparse_base4")));
+    // Small tables are not worth caching.
+    BOOST_CHECK(!std::filesystem::exists(cache.file_path("binary_xor_table")));
+
+    lookup_library<field_type> cached_library;
+    cached_library.set_table_cache_directory(directory.string());
+    BOOST_CHECK(get_tables(cached_library, {"sha256_reverse_sparse_base4", "binary_xor_table"}) == generated);
+
+    std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
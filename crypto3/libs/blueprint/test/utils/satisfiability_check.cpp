@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE blueprint_satisfiability_check_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/blueprint/utils/satisfiability_check.hpp>
+
+using namespace nil::blueprint;
+using namespace nil::crypto3;
+
+using field_type = algebra::curves::pallas::base_field_type;
+using value_type = typename field_type::value_type;
+using var = zk::snark::plonk_variable<value_type>;
+using failure_kind = satisfiability_failure::kind_type;
+
+BOOST_AUTO_TEST_SUITE(satisfiability_check_test_suite)
+
+BOOST_AUTO_TEST_CASE(satisfiability_check_reports_all_failures) {
+    const std::size_t rows = 100;
+
+    assignment<zk::snark::plonk_constraint_system<field_type>> assignment(2, 0, 0, 1);
+    circuit<zk::snark::plonk_constraint_system<field_type>> bp;
+
+    // w_1 == w_0 + 1 on every row, w_0 of the first two rows are copy-constrained.
+    std::size_t selector = bp.add_gate(var(1, 0) - var(0, 0) - 1);
+    bp.add_copy_constraint({var(0, 0, false), var(0, 1, false)});
+    for (std::size_t row = 0; row < rows; row++) {
+        assignment.witness(0, row) = value_type(7);
+        assignment.witness(1, row) = value_type(8);
+        assignment.enable_selector(selector, row);
+    }
+
+    satisfiability_check_options options;
+    options.threads = 4;
+    options.max_failures = 0;
+    options.verbose = false;
+    BOOST_CHECK(check_satisfiability(bp, assignment, {0}, {}, {0}, {0, 1, 2}, options).empty());
+    BOOST_CHECK(is_satisfied(bp, assignment, options));
+
+    assignment.witness(1, 3) = value_type(9);
+    assignment.witness(1, 97) = value_type(0);
+    assignment.witness(0, 1) = value_type(8);
+    assignment.witness(1, 1) = value_type(9);
+
+    std::set<std::uint32_t> all_rows;
+    for (std::uint32_t row = 0; row < rows; row++) {
+        all_rows.insert(row);
+    }
+    auto failures = check_satisfiability(bp, assignment, {0}, {}, {0}, all_rows, options);
+    BOOST_CHECK_EQUAL(failures.size(), 3);
+    BOOST_CHECK(failures[0].kind == failure_kind::gate && failures[0].row == 3);
+    BOOST_CHECK(failures[1].kind == failure_kind::gate && failures[1].row == 97);
+    BOOST_CHECK(failures[2].kind == failure_kind::copy_constraint && failures[2].index == 0);
+
+    options.max_failures = 1;
+    BOOST_CHECK_EQUAL(check_satisfiability(bp, assignment, {0}, {}, {0}, all_rows, options).size(), 1);
+    BOOST_CHECK(!is_satisfied(bp, assignment, options));
+}
+
+BOOST_AUTO_TEST_CASE(satisfiability_check_lookup_tables) {
+    const std::size_t rows = 16;
+
+    // Lookup table of the values 0..7 from the constant column, enabled by selector 0.
+    // Witness column 0 is looked up in it on the rows enabled by selector 1.
+    zk::snark::plonk_lookup_table<field_type> table(1, 0);
+    table.append_option({var(0, 0, true, var::column_type::constant)});
+
+    zk::snark::plonk_lookup_constraint<field_type> lookup_constraint;
+    lookup_constraint.table_id = 1;
+    lookup_constraint.lookup_input = {var(0, 0, true, var::column_type::witness)};
+    zk::snark::plonk_lookup_gate<field_type, zk::snark::plonk_lookup_constraint<field_type>> lookup_gate(
+        1, lookup_constraint);
+
+    zk::snark::plonk_constraint_system<field_type> cs({}, {}, {lookup_gate}, {table});
+
+    std::vector<zk::snark::plonk_column<field_type>> witnesses(1, zk::snark::plonk_column<field_type>(rows));
+    std::vector<zk::snark::plonk_column<field_type>> constants(1, zk::snark::plonk_column<field_type>(rows));
+    std::vector<zk::snark::plonk_column<field_type>> selectors(
+        2, zk::snark::plonk_column<field_type>(rows, value_type::zero()));
+    for (std::size_t row = 0; row < 8; row++) {
+        constants[0][row] = value_type(row);
+        selectors[0][row] = value_type::one();
+    }
+    for (std::size_t row = 8; row < rows; row++) {
+        witnesses[0][row] = value_type(rows - row - 1);
+        selectors[1][row] = value_type::one();
+    }
+    zk::snark::plonk_assignment_table<field_type> table_assignment(
+        zk::snark::plonk_private_assignment_table<field_type>(witnesses),
+        zk::snark::plonk_public_assignment_table<field_type>({}, constants, selectors));
+
+    satisfiability_check_options options;
+    options.max_failures = 0;
+    options.verbose = false;
+    BOOST_CHECK(check_table_satisfiability(cs, table_assignment, options).empty());
+
+    witnesses[0][10] = value_type(8);
+    witnesses[0][12] = value_type(100);
+    table_assignment = zk::snark::plonk_assignment_table<field_type>(
+        zk::snark::plonk_private_assignment_table<field_type>(witnesses),
+        zk::snark::plonk_public_assignment_table<field_type>({}, constants, selectors));
+
+    auto failures = check_table_satisfiability(cs, table_assignment, options);
+    BOOST_CHECK_EQUAL(failures.size(), 2);
+    BOOST_CHECK(failures[0].kind == failure_kind::lookup_gate && failures[0].row == 10);
+    BOOST_CHECK(failures[1].kind == failure_kind::lookup_gate && failures[1].row == 12);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
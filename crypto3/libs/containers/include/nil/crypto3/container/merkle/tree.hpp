@@ -29,6 +29,8 @@
 
 #include <vector>
 #include <cmath>
+#include <climits>
+#include <iterator>
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
@@ -37,6 +39,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 namespace nil {
@@ -483,20 +486,38 @@ namespace nil {
                 merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
                     typedef T node_type;
                     typedef typename node_type::hash_type hash_type;
+                    typedef typename node_type::value_type value_type;
+                    typedef typename std::iterator_traits<LeafIterator>::value_type leaf_value_type;
+
+                    // Hashes with a multi-buffer backend get whole rows at once: leaves stored as byte
+                    // containers and internal nodes, whose children are Arity consecutive digests.
+                    constexpr static const bool batch_rows = hashes::detail::batch_hash_impl<hash_type>::multi_buffer;
 
                     merkle_tree_impl<T, Arity> ret(std::distance(first, last));
                     ret.reserve(ret.complete_size());
 
-                    while (first != last) {
-                        ret.emplace_back(crypto3::hash<hash_type>(*first++));
+                    if constexpr (batch_rows && hashes::detail::is_contiguous_byte_range<leaf_value_type>::value) {
+                        hash_batch<hash_type>(first, last, std::back_inserter(ret));
+                    } else {
+                        while (first != last) {
+                            ret.emplace_back(crypto3::hash<hash_type>(*first++));
+                        }
                     }
 
                     std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
                     typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
 
                     for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        for (size_t i = 0; i < row_size; ++i, it += Arity) {
-                            ret.emplace_back(generate_hash<hash_type>(it, it + Arity));
+                        if constexpr (batch_rows) {
+                            static_assert(sizeof(value_type) * CHAR_BIT == node_type::value_bits,
+                                          "digests must be stored without padding");
+                            hash_batch<hash_type>(it->data(), Arity * sizeof(value_type), row_size,
+                                                  std::back_inserter(ret));
+                            it += row_size * Arity;
+                        } else {
+                            for (size_t i = 0; i < row_size; ++i, it += Arity) {
+                                ret.emplace_back(generate_hash<hash_type>(it, it + Arity));
+                            }
                         }
                     }
                     return ret;
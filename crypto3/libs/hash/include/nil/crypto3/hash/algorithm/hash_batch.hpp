@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_BATCH_HPP
+#define CRYPTO3_HASH_BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                template<typename Range, typename = void>
+                struct is_contiguous_byte_range : std::false_type { };
+
+                template<typename Range>
+                struct is_contiguous_byte_range<Range,
+                                                std::void_t<decltype(std::declval<const Range &>().data()),
+                                                            decltype(std::declval<const Range &>().size())>> {
+                    typedef typename std::remove_cv<typename std::remove_pointer<
+                        decltype(std::declval<const Range &>().data())>::type>::type value_type;
+
+                    constexpr static const bool value = std::is_integral<value_type>::value && sizeof(value_type) == 1;
+                };
+
+                /*!
+                 * @brief Hashes a batch of byte messages one at a time. Specialized for hashes with a
+                 * multi-buffer backend.
+                 */
+                template<typename Hash, typename = void>
+                struct batch_hash_impl {
+                    typedef typename Hash::digest_type digest_type;
+
+                    constexpr static const bool multi_buffer = false;
+
+                    template<typename OutputIterator>
+                    static OutputIterator process(const std::uint8_t *const *messages, const std::size_t *sizes,
+                                                  std::size_t count, OutputIterator out) {
+                        for (std::size_t i = 0; i < count; ++i) {
+                            *out++ = digest_type(crypto3::hash<Hash>(messages[i], messages[i] + sizes[i]));
+                        }
+                        return out;
+                    }
+                };
+
+                template<std::size_t Version>
+                struct batch_hash_impl<sha2<Version>, typename std::enable_if<sha2<Version>::word_bits == 32>::type> {
+                    typedef sha2<Version> hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+                    typedef typename hash_type::policy_type policy_type;
+                    typedef typename sha256_functions::state_type state_type;
+
+                    constexpr static const bool multi_buffer = true;
+
+                    template<typename OutputIterator>
+                    static OutputIterator process(const std::uint8_t *const *messages, const std::size_t *sizes,
+                                                  std::size_t count, OutputIterator out) {
+                        std::vector<state_type> states(count);
+                        sha256_functions::hash_messages(messages, sizes, count,
+                                                        typename policy_type::iv_generator()(), states.data());
+                        for (const state_type &state : states) {
+                            digest_type digest;
+                            for (std::size_t i = 0; i < digest.size(); ++i) {
+                                digest[i] = static_cast<std::uint8_t>(state[i / 4] >> (24 - 8 * (i % 4)));
+                            }
+                            *out++ = digest;
+                        }
+                        return out;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Hashes count messages of message_size bytes each, stored back to back from data, and writes
+         * their digests to out. Equivalent to calling hash<Hash> on every message, but lets SHA-224 and
+         * SHA-256 compress several messages at once with the multi-buffer backends.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @return Iterator past the last written digest.
+         */
+        template<typename Hash, typename OutputIterator>
+        OutputIterator hash_batch(const std::uint8_t *data, std::size_t message_size, std::size_t count,
+                                  OutputIterator out) {
+            std::vector<const std::uint8_t *> messages(count);
+            std::vector<std::size_t> sizes(count, message_size);
+            for (std::size_t i = 0; i < count; ++i) {
+                messages[i] = data + i * message_size;
+            }
+            return hashes::detail::batch_hash_impl<Hash>::process(messages.data(), sizes.data(), count,
+                                                                  std::move(out));
+        }
+
+        /*!
+         * @brief Hashes every message of [first, last) and writes their digests to out. Messages stored as
+         * contiguous byte ranges are hashed as a batch, anything else one at a time with hash<Hash>.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @return Iterator past the last written digest.
+         */
+        template<typename Hash, typename InputIterator, typename OutputIterator>
+        OutputIterator hash_batch(InputIterator first, InputIterator last, OutputIterator out) {
+            typedef typename std::iterator_traits<InputIterator>::value_type message_type;
+            typedef typename Hash::digest_type digest_type;
+
+            if constexpr (hashes::detail::is_contiguous_byte_range<message_type>::value) {
+                std::vector<const std::uint8_t *> messages;
+                std::vector<std::size_t> sizes;
+                for (; first != last; ++first) {
+                    messages.push_back(reinterpret_cast<const std::uint8_t *>(first->data()));
+                    sizes.push_back(first->size());
+                }
+                return hashes::detail::batch_hash_impl<Hash>::process(messages.data(), sizes.data(),
+                                                                      messages.size(), std::move(out));
+            } else {
+                for (; first != last; ++first) {
+                    *out++ = digest_type(crypto3::hash<Hash>(*first));
+                }
+                return out;
+            }
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_BATCH_HPP
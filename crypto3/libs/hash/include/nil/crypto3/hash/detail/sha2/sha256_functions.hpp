@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA256_FUNCTIONS_HPP
+#define CRYPTO3_HASH_DETAIL_SHA256_FUNCTIONS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/block/shacal2.hpp>
+
+#include <nil/crypto3/hash/detail/state_adder.hpp>
+#include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha256_multi_buffer_impl.hpp>
+
+#if BOOST_ARCH_X86_64 && defined(__GNUC__)
+#define CRYPTO3_HASH_SHA256_X86_64_DISPATCH
+#include <nil/crypto3/hash/detail/sha2/sha256_x86_64_impl.hpp>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-256 compression backends with runtime dispatch. The portable backend is the
+                 * Davies-Meyer construction over SHACAL-2 every other backend is checked against; on x86-64
+                 * single blocks go through the SHA extensions and independent blocks through 16-lane AVX-512,
+                 * 8-lane AVX2 or 4-lane SSE2 multi-buffer kernels, whichever the CPU supports.
+                 */
+                struct sha256_functions {
+                    typedef davies_meyer_compressor<block::shacal2<256>, state_adder> portable_compressor_type;
+
+                    typedef typename portable_compressor_type::word_type word_type;
+                    typedef typename portable_compressor_type::state_type state_type;
+                    typedef typename portable_compressor_type::block_type block_type;
+
+                    constexpr static const std::size_t max_lanes = 16;
+
+                    static inline void process_block_portable(state_type &state, const block_type &block) {
+                        portable_compressor_type::process_block(state, block);
+                    }
+
+                    static inline void process_block(state_type &state, const block_type &block) {
+#ifdef CRYPTO3_HASH_SHA256_X86_64_DISPATCH
+                        if (sha256_x86_64_features::get().sha) {
+                            sha256_x86_64_impl::process_block_shani(state, block);
+                            return;
+                        }
+#endif
+                        process_block_portable(state, block);
+                    }
+
+                    /*!
+                     * @brief Number of independent blocks the widest available multi-buffer kernel compresses
+                     * at once, 1 if there is none.
+                     */
+                    static inline std::size_t lanes() {
+#ifdef CRYPTO3_HASH_SHA256_X86_64_DISPATCH
+                        const sha256_x86_64_features &features = sha256_x86_64_features::get();
+                        if (features.avx512f) {
+                            return 16;
+                        }
+                        // The SHA extensions compress one block about as fast as 8 AVX2 lanes do per block.
+                        if (features.sha) {
+                            return 1;
+                        }
+                        if (features.avx2) {
+                            return 8;
+                        }
+#endif
+#if defined(__GNUC__)
+                        return 4;
+#else
+                        return 1;
+#endif
+                    }
+
+                    /*!
+                     * @brief Compresses blocks[i] into states[i] for every i < count.
+                     */
+                    static inline void process_blocks(state_type *states, const block_type *blocks,
+                                                      std::size_t count) {
+                        const std::size_t width = lanes();
+                        std::size_t i = 0;
+#ifdef CRYPTO3_HASH_SHA256_X86_64_DISPATCH
+                        if (width == 16) {
+                            for (; i + 16 <= count; i += 16) {
+                                sha256_x86_64_impl::process_blocks_x16(states + i, blocks + i);
+                            }
+                        }
+                        if (width == 8) {
+                            for (; i + 8 <= count; i += 8) {
+                                sha256_x86_64_impl::process_blocks_x8(states + i, blocks + i);
+                            }
+                        }
+#endif
+#if defined(__GNUC__)
+                        if (width >= 4) {
+                            for (; i + 4 <= count; i += 4) {
+                                sha256_multi_buffer_impl<sha256_lanes_4_type, 4>::process_blocks(states + i,
+                                                                                                  blocks + i);
+                            }
+                        }
+#endif
+                        for (; i < count; ++i) {
+                            process_block(states[i], blocks[i]);
+                        }
+                    }
+
+                    /*!
+                     * @brief Hashes count messages, messages[i] being sizes[i] bytes long, and writes the
+                     * big-endian state words of each digest to digests[i]. Messages are padded as in
+                     * merkle_damgard_padding and compressed block by block across messages, so equal-length
+                     * messages always fill every lane.
+                     */
+                    static void hash_messages(const std::uint8_t *const *messages, const std::size_t *sizes,
+                                              std::size_t count, const state_type &iv, state_type *digests) {
+                        std::array<state_type, max_lanes> states;
+                        std::array<block_type, max_lanes> blocks;
+                        std::array<std::size_t, max_lanes> active;
+
+                        const std::size_t width = lanes() < 4 ? 4 : lanes();
+                        for (std::size_t first = 0; first < count; first += width) {
+                            const std::size_t n = count - first < width ? count - first : width;
+                            std::size_t max_blocks = 0;
+                            for (std::size_t l = 0; l < n; ++l) {
+                                digests[first + l] = iv;
+                                const std::size_t blocks_count = padded_blocks(sizes[first + l]);
+                                max_blocks = blocks_count > max_blocks ? blocks_count : max_blocks;
+                            }
+                            for (std::size_t b = 0; b < max_blocks; ++b) {
+                                std::size_t m = 0;
+                                for (std::size_t l = 0; l < n; ++l) {
+                                    if (b < padded_blocks(sizes[first + l])) {
+                                        states[m] = digests[first + l];
+                                        load_block(messages[first + l], sizes[first + l], b, blocks[m]);
+                                        active[m++] = first + l;
+                                    }
+                                }
+                                process_blocks(states.data(), blocks.data(), m);
+                                for (std::size_t j = 0; j < m; ++j) {
+                                    digests[active[j]] = states[j];
+                                }
+                            }
+                        }
+                    }
+
+                private:
+                    static inline std::size_t padded_blocks(std::size_t size) {
+                        return (size + 8) / 64 + 1;
+                    }
+
+                    static inline word_type load_word(const std::uint8_t *p) {
+                        return (word_type(p[0]) << 24) | (word_type(p[1]) << 16) | (word_type(p[2]) << 8) |
+                               word_type(p[3]);
+                    }
+
+                    static inline void load_block(const std::uint8_t *message, std::size_t size, std::size_t index,
+                                                  block_type &block) {
+                        const std::size_t offset = index * 64;
+                        if (offset + 64 <= size) {
+                            for (std::size_t i = 0; i < 16; ++i) {
+                                block[i] = load_word(message + offset + 4 * i);
+                            }
+                            return;
+                        }
+
+                        std::array<std::uint8_t, 64> bytes;
+                        for (std::size_t i = 0; i < 64; ++i) {
+                            const std::size_t position = offset + i;
+                            bytes[i] = position < size ? message[position] : (position == size ? 0x80 : 0x00);
+                        }
+                        if (index + 1 == padded_blocks(size)) {
+                            const std::uint64_t bits = static_cast<std::uint64_t>(size) * 8;
+                            for (std::size_t i = 0; i < 8; ++i) {
+                                bytes[56 + i] = static_cast<std::uint8_t>(bits >> (56 - 8 * i));
+                            }
+                        }
+                        for (std::size_t i = 0; i < 16; ++i) {
+                            block[i] = load_word(bytes.data() + 4 * i);
+                        }
+                    }
+                };
+
+                /*!
+                 * @brief Compressor with the davies_meyer_compressor interface which routes SHA-256 blocks
+                 * through the fastest backend available at runtime.
+                 */
+                struct sha256_compressor {
+                    typedef sha256_functions::portable_compressor_type portable_compressor_type;
+                    typedef typename portable_compressor_type::block_cipher_type block_cipher_type;
+
+                    constexpr static const std::size_t word_bits = portable_compressor_type::word_bits;
+                    typedef typename portable_compressor_type::word_type word_type;
+
+                    constexpr static const std::size_t state_bits = portable_compressor_type::state_bits;
+                    constexpr static const std::size_t state_words = portable_compressor_type::state_words;
+                    typedef typename portable_compressor_type::state_type state_type;
+
+                    constexpr static const std::size_t block_bits = portable_compressor_type::block_bits;
+                    constexpr static const std::size_t block_words = portable_compressor_type::block_words;
+                    typedef typename portable_compressor_type::block_type block_type;
+
+                    inline static void process_block(state_type &state, const block_type &block) {
+                        sha256_functions::process_block(state, block);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA256_FUNCTIONS_HPP
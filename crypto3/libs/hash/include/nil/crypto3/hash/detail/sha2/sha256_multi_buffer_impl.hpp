@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA256_MULTI_BUFFER_IMPL_HPP
+#define CRYPTO3_HASH_DETAIL_SHA256_MULTI_BUFFER_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/block/detail/shacal/shacal2_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+#if defined(__GNUC__)
+                typedef std::uint32_t sha256_lanes_4_type __attribute__((vector_size(16)));
+                typedef std::uint32_t sha256_lanes_8_type __attribute__((vector_size(32)));
+                typedef std::uint32_t sha256_lanes_16_type __attribute__((vector_size(64)));
+
+                /*!
+                 * @brief Multi-buffer SHA-256 compression: Lanes independent (state, block) pairs are compressed
+                 * at once, lane i of every vector word carrying the i-th pair. The kernel is written with
+                 * generic vector extensions and is always inlined, so the instruction set is picked by the
+                 * caller's target (SSE2 for 4 lanes, AVX2 for 8 lanes, AVX-512 for 16 lanes). Vectors are only
+                 * passed by reference, since passing or returning them by value changes the ABI of functions
+                 * instantiated without the wide target enabled.
+                 *
+                 * @tparam LanesType Vector of std::uint32_t with Lanes elements.
+                 */
+                template<typename LanesType, std::size_t Lanes>
+                struct sha256_multi_buffer_impl {
+                    typedef LanesType lanes_type;
+                    constexpr static const std::size_t lanes = Lanes;
+
+                    typedef block::detail::shacal2_policy<256> cipher_policy_type;
+                    typedef typename cipher_policy_type::word_type word_type;
+                    typedef typename cipher_policy_type::block_type state_type;
+                    typedef typename cipher_policy_type::key_type block_type;
+
+                    static_assert(sizeof(lanes_type) == Lanes * sizeof(word_type), "lanes type width mismatch");
+
+                    // out = rotr(x, R1) ^ rotr(x, R2) ^ rotr(x, R3), the big sigma functions of the rounds.
+                    template<int R1, int R2, int R3>
+                    __attribute__((always_inline)) static inline void big_sigma(lanes_type &out, const lanes_type &x) {
+                        out = ((x >> R1) | (x << (32 - R1))) ^ ((x >> R2) | (x << (32 - R2))) ^
+                              ((x >> R3) | (x << (32 - R3)));
+                    }
+
+                    // out = rotr(x, R1) ^ rotr(x, R2) ^ (x >> S), the small sigma functions of the message schedule.
+                    template<int R1, int R2, int S>
+                    __attribute__((always_inline)) static inline void small_sigma(lanes_type &out,
+                                                                                  const lanes_type &x) {
+                        out = ((x >> R1) | (x << (32 - R1))) ^ ((x >> R2) | (x << (32 - R2))) ^ (x >> S);
+                    }
+
+                    __attribute__((always_inline)) static inline void process_blocks(state_type *states,
+                                                                                     const block_type *blocks) {
+                        lanes_type w[16];
+                        for (std::size_t t = 0; t < 16; ++t) {
+                            for (std::size_t l = 0; l < Lanes; ++l) {
+                                w[t][l] = blocks[l][t];
+                            }
+                        }
+
+                        lanes_type s[8];
+                        for (std::size_t i = 0; i < 8; ++i) {
+                            for (std::size_t l = 0; l < Lanes; ++l) {
+                                s[i][l] = states[l][i];
+                            }
+                        }
+
+                        lanes_type a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+                        lanes_type sigma0, sigma1;
+                        for (std::size_t t = 0; t < cipher_policy_type::rounds; ++t) {
+                            if (t >= 16) {
+                                small_sigma<17, 19, 10>(sigma1, w[(t - 2) & 15]);
+                                small_sigma<7, 18, 3>(sigma0, w[(t - 15) & 15]);
+                                w[t & 15] += sigma1 + w[(t - 7) & 15] + sigma0;
+                            }
+                            big_sigma<6, 11, 25>(sigma1, e);
+                            const lanes_type t1 =
+                                h + sigma1 + ((e & f) ^ (~e & g)) + cipher_policy_type::constants[t] + w[t & 15];
+                            big_sigma<2, 13, 22>(sigma0, a);
+                            const lanes_type t2 = sigma0 + ((a & b) ^ (a & c) ^ (b & c));
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = d + t1;
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = t1 + t2;
+                        }
+
+                        s[0] += a;
+                        s[1] += b;
+                        s[2] += c;
+                        s[3] += d;
+                        s[4] += e;
+                        s[5] += f;
+                        s[6] += g;
+                        s[7] += h;
+
+                        for (std::size_t i = 0; i < 8; ++i) {
+                            for (std::size_t l = 0; l < Lanes; ++l) {
+                                states[l][i] = s[i][l];
+                            }
+                        }
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA256_MULTI_BUFFER_IMPL_HPP
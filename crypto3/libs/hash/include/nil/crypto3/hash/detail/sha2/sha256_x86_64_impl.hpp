@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_DETAIL_SHA256_X86_64_IMPL_HPP
+#define CRYPTO3_HASH_DETAIL_SHA256_X86_64_IMPL_HPP
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#include <nil/crypto3/block/detail/shacal/shacal2_policy.hpp>
+
+#include <nil/crypto3/hash/detail/sha2/sha256_multi_buffer_impl.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Instruction set extensions the SHA-256 backends may use, detected once per process.
+                 */
+                struct sha256_x86_64_features {
+                    bool sha;
+                    bool avx2;
+                    bool avx512f;
+
+                    static const sha256_x86_64_features &get() {
+                        static const sha256_x86_64_features features = detect();
+                        return features;
+                    }
+
+                private:
+                    static sha256_x86_64_features detect() {
+                        sha256_x86_64_features result = {false, false, false};
+                        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                        __builtin_cpu_init();
+                        // SHA extensions are reported in CPUID.(EAX=7,ECX=0):EBX[29] and need SSE4.1 for the
+                        // state shuffles; they only touch XMM registers, so no OS support check is required.
+                        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                            result.sha = ((ebx >> 29) & 1) && __builtin_cpu_supports("sse4.1");
+                        }
+                        // __builtin_cpu_supports also checks that the OS saves the YMM/ZMM state.
+                        result.avx2 = __builtin_cpu_supports("avx2");
+                        result.avx512f = __builtin_cpu_supports("avx512f");
+                        return result;
+                    }
+                };
+
+                struct sha256_x86_64_impl {
+                    typedef block::detail::shacal2_policy<256> cipher_policy_type;
+                    typedef typename cipher_policy_type::word_type word_type;
+                    typedef typename cipher_policy_type::block_type state_type;
+                    typedef typename cipher_policy_type::key_type block_type;
+
+                    /*!
+                     * @brief Single-buffer compression with the SHA extensions. Block words are already
+                     * big-endian decoded, so unlike byte-oriented implementations no shuffle of the
+                     * message is needed.
+                     */
+                    __attribute__((target("sha,sse4.1"))) static void process_block_shani(state_type &state,
+                                                                                          const block_type &block) {
+                        const word_type *k = cipher_policy_type::constants.data();
+
+                        // Rearrange ABCD EFGH into the ABEF CDGH layout sha256rnds2 works on.
+                        __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[0])),
+                                                        0xB1);
+                        __m128i state1 =
+                            _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[4])), 0x1B);
+                        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+                        state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+                        const __m128i abef_save = state0, cdgh_save = state1;
+
+                        __m128i m[4];
+                        for (std::size_t i = 0; i < 4; ++i) {
+                            m[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&block[4 * i]));
+                        }
+
+                        for (std::size_t i = 0; i < 16; ++i) {
+                            if (i >= 4) {
+                                __m128i w = _mm_sha256msg1_epu32(m[i & 3], m[(i + 1) & 3]);
+                                w = _mm_add_epi32(w, _mm_alignr_epi8(m[(i + 3) & 3], m[(i + 2) & 3], 4));
+                                m[i & 3] = _mm_sha256msg2_epu32(w, m[(i + 3) & 3]);
+                            }
+                            __m128i wk = _mm_add_epi32(m[i & 3],
+                                                       _mm_loadu_si128(reinterpret_cast<const __m128i *>(k + 4 * i)));
+                            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+                            wk = _mm_shuffle_epi32(wk, 0x0E);
+                            state0 = _mm_sha256rnds2_epu32(state0, state1, wk);
+                        }
+
+                        state0 = _mm_add_epi32(state0, abef_save);
+                        state1 = _mm_add_epi32(state1, cdgh_save);
+
+                        tmp = _mm_shuffle_epi32(state0, 0x1B);
+                        state1 = _mm_shuffle_epi32(state1, 0xB1);
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[0]), _mm_blend_epi16(tmp, state1, 0xF0));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[4]), _mm_alignr_epi8(state1, tmp, 8));
+                    }
+
+                    __attribute__((target("avx2"))) static void process_blocks_x8(state_type *states,
+                                                                                  const block_type *blocks) {
+                        sha256_multi_buffer_impl<sha256_lanes_8_type, 8>::process_blocks(states, blocks);
+                    }
+
+                    __attribute__((target("avx512f"))) static void process_blocks_x16(state_type *states,
+                                                                                     const block_type *blocks) {
+                        sha256_multi_buffer_impl<sha256_lanes_16_type, 16>::process_blocks(states, blocks);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_DETAIL_SHA256_X86_64_IMPL_HPP
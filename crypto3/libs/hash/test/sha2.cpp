@@ -26,6 +26,7 @@
 #define BOOST_TEST_MODULE sha2_test
 
 #include <iostream>
+#include <random>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -35,6 +36,7 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
 #include <nil/crypto3/hash/adaptor/hashed.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
@@ -687,3 +689,134 @@ BOOST_AUTO_TEST_CASE(sha224_range_hash) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha2_backends_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha256_compression_backends) {
+    typedef hashes::detail::sha256_functions functions_type;
+    std::mt19937 rng(0x5ba256);
+
+    std::vector<functions_type::state_type> states(37);
+    std::vector<functions_type::block_type> blocks(states.size());
+    for (std::size_t iteration = 0; iteration < 16; ++iteration) {
+        for (auto &state : states) {
+            for (auto &word : state) {
+                word = rng();
+            }
+        }
+        for (auto &block : blocks) {
+            for (auto &word : block) {
+                word = rng();
+            }
+        }
+
+        std::vector<functions_type::state_type> expected = states;
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            functions_type::process_block_portable(expected[i], blocks[i]);
+        }
+
+        std::vector<functions_type::state_type> single = states;
+        for (std::size_t i = 0; i < single.size(); ++i) {
+            functions_type::process_block(single[i], blocks[i]);
+        }
+        BOOST_CHECK(single == expected);
+
+        std::vector<functions_type::state_type> lanes = states;
+        functions_type::process_blocks(lanes.data(), blocks.data(), lanes.size());
+        BOOST_CHECK(lanes == expected);
+
+#ifdef __GNUC__
+        std::vector<functions_type::state_type> lanes4 = states;
+        for (std::size_t i = 0; i + 4 <= lanes4.size(); i += 4) {
+            hashes::detail::sha256_multi_buffer_impl<hashes::detail::sha256_lanes_4_type, 4>::process_blocks(
+                lanes4.data() + i, blocks.data() + i);
+        }
+        BOOST_CHECK(std::equal(expected.begin(), expected.begin() + 36, lanes4.begin()));
+#endif
+
+#ifdef CRYPTO3_HASH_SHA256_X86_64_DISPATCH
+        const hashes::detail::sha256_x86_64_features &features = hashes::detail::sha256_x86_64_features::get();
+        if (features.sha) {
+            std::vector<functions_type::state_type> shani = states;
+            for (std::size_t i = 0; i < shani.size(); ++i) {
+                hashes::detail::sha256_x86_64_impl::process_block_shani(shani[i], blocks[i]);
+            }
+            BOOST_CHECK(shani == expected);
+        }
+        if (features.avx2) {
+            std::vector<functions_type::state_type> lanes8 = states;
+            for (std::size_t i = 0; i + 8 <= lanes8.size(); i += 8) {
+                hashes::detail::sha256_x86_64_impl::process_blocks_x8(lanes8.data() + i, blocks.data() + i);
+            }
+            BOOST_CHECK(std::equal(expected.begin(), expected.begin() + 32, lanes8.begin()));
+        }
+        if (features.avx512f) {
+            std::vector<functions_type::state_type> lanes16 = states;
+            for (std::size_t i = 0; i + 16 <= lanes16.size(); i += 16) {
+                hashes::detail::sha256_x86_64_impl::process_blocks_x16(lanes16.data() + i, blocks.data() + i);
+            }
+            BOOST_CHECK(std::equal(expected.begin(), expected.begin() + 32, lanes16.begin()));
+        }
+#endif
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_batch_hash) {
+    std::mt19937 rng(0x5ba257);
+
+    // Lengths around the padding boundaries, counts around the lane widths.
+    for (std::size_t message_size : {0, 1, 32, 55, 56, 63, 64, 65, 96, 119, 120, 128, 200}) {
+        for (std::size_t count : {1, 3, 4, 7, 8, 16, 17, 33}) {
+            std::vector<std::uint8_t> data(message_size * count);
+            for (auto &byte : data) {
+                byte = static_cast<std::uint8_t>(rng());
+            }
+
+            std::vector<hashes::sha2<256>::digest_type> digests;
+            hash_batch<hashes::sha2<256>>(data.data(), message_size, count, std::back_inserter(digests));
+            std::vector<hashes::sha2<224>::digest_type> digests224;
+            hash_batch<hashes::sha2<224>>(data.data(), message_size, count, std::back_inserter(digests224));
+
+            BOOST_REQUIRE_EQUAL(digests.size(), count);
+            BOOST_REQUIRE_EQUAL(digests224.size(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                hashes::sha2<256>::digest_type expected = hash<hashes::sha2<256>>(
+                    data.begin() + i * message_size, data.begin() + (i + 1) * message_size);
+                hashes::sha2<224>::digest_type expected224 = hash<hashes::sha2<224>>(
+                    data.begin() + i * message_size, data.begin() + (i + 1) * message_size);
+                BOOST_CHECK(digests[i] == expected);
+                BOOST_CHECK(digests224[i] == expected224);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_batch_hash_ranges) {
+    std::mt19937 rng(0x5ba258);
+
+    std::vector<std::vector<std::uint8_t>> messages(50);
+    for (auto &message : messages) {
+        message.resize(rng() % 300);
+        for (auto &byte : message) {
+            byte = static_cast<std::uint8_t>(rng());
+        }
+    }
+
+    std::vector<hashes::sha2<256>::digest_type> digests;
+    hash_batch<hashes::sha2<256>>(messages.begin(), messages.end(), std::back_inserter(digests));
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        hashes::sha2<256>::digest_type expected = hash<hashes::sha2<256>>(messages[i]);
+        BOOST_CHECK(digests[i] == expected);
+    }
+
+    std::vector<std::string> strings = {"abc", ""};
+    std::vector<hashes::sha2<256>::digest_type> string_digests;
+    hash_batch<hashes::sha2<256>>(strings.begin(), strings.end(), std::back_inserter(string_digests));
+    BOOST_CHECK_EQUAL("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+                      std::to_string(string_digests[0]).data());
+    BOOST_CHECK_EQUAL("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+                      std::to_string(string_digests[1]).data());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,376 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_FIELD_ELEMENT_BLOCK_HPP
+#define CRYPTO3_MARSHALLING_FIELD_ELEMENT_BLOCK_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <boost/endian/conversion.hpp>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/detail/common_funcs.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Representation of the elements in a field_element_block.
+                enum class field_element_encoding : std::uint8_t {
+                    /// Little-endian limbs of the canonical value, independent of the arithmetic backend.
+                    canonical = 0,
+                    /// Little-endian limbs of the Montgomery form, copied without conversion. Only readable by
+                    /// a build with the same field arithmetic.
+                    montgomery = 1,
+                };
+
+                namespace detail {
+
+                    // Fixed-width little-endian codec of a single field element.
+                    template<typename FieldValueType, typename Enable = void>
+                    struct field_element_limbs;
+
+                    template<typename FieldValueType>
+                    struct field_element_limbs<
+                            FieldValueType,
+                            typename std::enable_if<!algebra::is_extended_field_element<FieldValueType>::value>::type> {
+
+                        using backend_type = typename std::decay<
+                            decltype(std::declval<FieldValueType &>().data.backend().base_data())>::type;
+                        using limb_type = typename std::remove_cv<typename std::remove_pointer<
+                            decltype(std::declval<backend_type &>().limbs())>::type>::type;
+
+                        constexpr static const std::size_t limbs_amount = backend_type().size();
+                        constexpr static const std::size_t bytes = limbs_amount * sizeof(limb_type);
+
+                        static void write(const FieldValueType &value, std::uint8_t *out, field_element_encoding encoding) {
+                            const auto &modular = value.data.backend();
+                            if (encoding == field_element_encoding::montgomery) {
+                                write_limbs(modular.base_data(), out);
+                            } else {
+                                backend_type canonical;
+                                modular.mod_data().adjust_regular(canonical, modular.base_data());
+                                write_limbs(canonical, out);
+                            }
+                        }
+
+                        static void read(FieldValueType &value, const std::uint8_t *in, field_element_encoding encoding) {
+                            // Start from a valid element, so the modular parameters are set.
+                            value = FieldValueType::zero();
+                            auto &modular = value.data.backend();
+                            read_limbs(modular.base_data(), in);
+                            if (encoding == field_element_encoding::canonical) {
+                                modular.mod_data().adjust_modular(modular.base_data());
+                            }
+                        }
+
+                    private:
+                        static void write_limbs(const backend_type &backend, std::uint8_t *out) {
+                            if (boost::endian::order::native == boost::endian::order::little) {
+                                std::memcpy(out, backend.limbs(), bytes);
+                            } else {
+                                for (std::size_t i = 0; i < limbs_amount; ++i) {
+                                    limb_type limb = backend.limbs()[i];
+                                    for (std::size_t j = 0; j < sizeof(limb_type); ++j, limb >>= 8) {
+                                        *out++ = static_cast<std::uint8_t>(limb);
+                                    }
+                                }
+                            }
+                        }
+
+                        static void read_limbs(backend_type &backend, const std::uint8_t *in) {
+                            if (boost::endian::order::native == boost::endian::order::little) {
+                                std::memcpy(backend.limbs(), in, bytes);
+                            } else {
+                                for (std::size_t i = 0; i < limbs_amount; ++i) {
+                                    limb_type limb = 0;
+                                    for (std::size_t j = 0; j < sizeof(limb_type); ++j) {
+                                        limb |= static_cast<limb_type>(in[i * sizeof(limb_type) + j]) << (8 * j);
+                                    }
+                                    backend.limbs()[i] = limb;
+                                }
+                            }
+                        }
+                    };
+
+                    template<typename FieldValueType>
+                    struct field_element_limbs<
+                            FieldValueType,
+                            typename std::enable_if<algebra::is_extended_field_element<FieldValueType>::value>::type> {
+
+                        using underlying_type = typename FieldValueType::underlying_type;
+                        using underlying_limbs = field_element_limbs<underlying_type>;
+
+                        constexpr static const std::size_t arity =
+                            FieldValueType::field_type::arity / underlying_type::field_type::arity;
+                        constexpr static const std::size_t bytes = arity * underlying_limbs::bytes;
+
+                        static void write(const FieldValueType &value, std::uint8_t *out, field_element_encoding encoding) {
+                            for (std::size_t i = 0; i < arity; ++i) {
+                                underlying_limbs::write(value.data[i], out + i * underlying_limbs::bytes, encoding);
+                            }
+                        }
+
+                        static void read(FieldValueType &value, const std::uint8_t *in, field_element_encoding encoding) {
+                            for (std::size_t i = 0; i < arity; ++i) {
+                                underlying_limbs::read(value.data[i], in + i * underlying_limbs::bytes, encoding);
+                            }
+                        }
+                    };
+
+                    // Iterators over contiguous bytes, read and written with memcpy.
+                    template<typename TIter>
+                    struct is_contiguous_byte_iterator
+                        : std::integral_constant<
+                              bool,
+                              std::is_same<TIter, std::uint8_t *>::value ||
+                              std::is_same<TIter, const std::uint8_t *>::value ||
+                              std::is_same<TIter, typename std::vector<std::uint8_t>::iterator>::value ||
+                              std::is_same<TIter, typename std::vector<std::uint8_t>::const_iterator>::value> { };
+
+                    // Number of elements converted at a time when the iterator is not contiguous.
+                    constexpr static const std::size_t field_element_block_chunk_size = 4096;
+                }    // namespace detail
+
+                /// @brief Size of a field element in a field_element_block, in bytes.
+                template<typename FieldValueType>
+                constexpr std::size_t field_element_block_element_length() {
+                    return detail::field_element_limbs<FieldValueType>::bytes;
+                }
+
+                /// @brief Writes 'count' elements starting at 'first' as fixed-width little-endian limbs.
+                template<typename FieldValueType>
+                void write_field_elements(const FieldValueType *first, std::size_t count, std::uint8_t *out,
+                                          field_element_encoding encoding = field_element_encoding::canonical) {
+                    using limbs = detail::field_element_limbs<FieldValueType>;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        limbs::write(first[i], out + i * limbs::bytes, encoding);
+                    }
+                }
+
+                /// @brief Reads 'count' elements written by write_field_elements into 'first'.
+                template<typename FieldValueType>
+                void read_field_elements(const std::uint8_t *in, std::size_t count, FieldValueType *first,
+                                         field_element_encoding encoding = field_element_encoding::canonical) {
+                    using limbs = detail::field_element_limbs<FieldValueType>;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        limbs::read(first[i], in + i * limbs::bytes, encoding);
+                    }
+                }
+
+                /**
+                 * @brief Marshalling type for a contiguous vector of field elements, encoded in bulk.
+                 *
+                 * Layout: element count (std::size_t, in the endianness of TTypeBase, same as the size prefix of
+                 * field_element_vector), encoding (1 byte), then the elements as fixed-width little-endian limbs.
+                 * Unlike field_element_vector, elements are not wrapped into per-element marshalling objects and
+                 * are not exported through generic multiprecision code, so columns and polynomials are
+                 * (de)serialized at memory bandwidth.
+                 */
+                template<typename TTypeBase, typename FieldValueType>
+                class field_element_block : public TTypeBase {
+                    using size_field_type = nil::marshalling::types::integral<TTypeBase, std::size_t>;
+                    using limbs = detail::field_element_limbs<FieldValueType>;
+
+                public:
+                    using value_type = std::vector<FieldValueType>;
+                    using element_type = FieldValueType;
+                    using version_type = typename TTypeBase::version_type;
+
+                    field_element_block() = default;
+
+                    explicit field_element_block(const value_type &val,
+                                                 field_element_encoding encoding = field_element_encoding::canonical) :
+                        _value(val), _encoding(encoding) {
+                    }
+
+                    explicit field_element_block(value_type &&val,
+                                                 field_element_encoding encoding = field_element_encoding::canonical) :
+                        _value(std::move(val)), _encoding(encoding) {
+                    }
+
+                    const value_type &value() const {
+                        return _value;
+                    }
+
+                    value_type &value() {
+                        return _value;
+                    }
+
+                    /// @brief Encoding used by write(), set by read() to the encoding of the data read.
+                    field_element_encoding encoding() const {
+                        return _encoding;
+                    }
+
+                    void set_encoding(field_element_encoding encoding) {
+                        _encoding = encoding;
+                    }
+
+                    std::size_t length() const {
+                        return min_length() + _value.size() * limbs::bytes;
+                    }
+
+                    static constexpr std::size_t min_length() {
+                        return size_field_type::min_length() + 1;
+                    }
+
+                    static constexpr std::size_t max_length() {
+                        return nil::marshalling::types::detail::common_funcs::max_supported_length();
+                    }
+
+                    static constexpr bool valid() {
+                        return true;
+                    }
+
+                    static constexpr bool refresh() {
+                        return false;
+                    }
+
+                    static constexpr bool is_version_dependent() {
+                        return false;
+                    }
+
+                    static constexpr bool set_version(version_type) {
+                        return false;
+                    }
+
+                    template<typename TIter>
+                    nil::marshalling::status_type read(TIter &iter, std::size_t size) {
+                        if (size < min_length()) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+                        size_field_type count;
+                        auto status = count.read(iter, size);
+                        if (status != nil::marshalling::status_type::success) {
+                            return status;
+                        }
+                        size -= count.length();
+
+                        std::uint8_t encoding = static_cast<std::uint8_t>(*iter);
+                        ++iter;
+                        size -= 1;
+                        if (encoding > static_cast<std::uint8_t>(field_element_encoding::montgomery)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        if (count.value() > size / limbs::bytes) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+
+                        _encoding = static_cast<field_element_encoding>(encoding);
+                        _value.resize(count.value());
+                        read_elements(iter);
+                        return nil::marshalling::status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void read_no_status(TIter &iter) {
+                        read(iter, std::numeric_limits<std::size_t>::max());
+                    }
+
+                    template<typename TIter>
+                    nil::marshalling::status_type write(TIter &iter, std::size_t size) const {
+                        if (size < length()) {
+                            return nil::marshalling::status_type::buffer_overflow;
+                        }
+                        write_no_status(iter);
+                        return nil::marshalling::status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void write_no_status(TIter &iter) const {
+                        size_field_type(_value.size()).write_no_status(iter);
+                        *iter = static_cast<std::uint8_t>(_encoding);
+                        ++iter;
+
+                        if constexpr (detail::is_contiguous_byte_iterator<TIter>::value) {
+                            write_field_elements(_value.data(), _value.size(), &*iter, _encoding);
+                            iter += _value.size() * limbs::bytes;
+                        } else {
+                            std::vector<std::uint8_t> chunk;
+                            for (std::size_t i = 0; i < _value.size(); i += detail::field_element_block_chunk_size) {
+                                std::size_t amount = std::min(detail::field_element_block_chunk_size, _value.size() - i);
+                                chunk.resize(amount * limbs::bytes);
+                                write_field_elements(_value.data() + i, amount, chunk.data(), _encoding);
+                                for (std::uint8_t byte: chunk) {
+                                    *iter = byte;
+                                    ++iter;
+                                }
+                            }
+                        }
+                    }
+
+                private:
+                    template<typename TIter>
+                    void read_elements(TIter &iter) {
+                        if constexpr (detail::is_contiguous_byte_iterator<TIter>::value) {
+                            read_field_elements(&*iter, _value.size(), _value.data(), _encoding);
+                            iter += _value.size() * limbs::bytes;
+                        } else {
+                            std::vector<std::uint8_t> chunk;
+                            for (std::size_t i = 0; i < _value.size(); i += detail::field_element_block_chunk_size) {
+                                std::size_t amount = std::min(detail::field_element_block_chunk_size, _value.size() - i);
+                                chunk.resize(amount * limbs::bytes);
+                                for (auto &byte: chunk) {
+                                    byte = static_cast<std::uint8_t>(*iter);
+                                    ++iter;
+                                }
+                                read_field_elements(chunk.data(), amount, _value.data() + i, _encoding);
+                            }
+                        }
+                    }
+
+                    value_type _value;
+                    field_element_encoding _encoding = field_element_encoding::canonical;
+                };
+
+                template<typename FieldValueType, typename Endianness>
+                field_element_block<nil::marshalling::field_type<Endianness>, FieldValueType>
+                    fill_field_element_block(const std::vector<FieldValueType> &field_elem_vector,
+                                             field_element_encoding encoding = field_element_encoding::canonical) {
+                    return field_element_block<nil::marshalling::field_type<Endianness>, FieldValueType>(
+                        field_elem_vector, encoding);
+                }
+
+                template<typename FieldValueType, typename Endianness>
+                std::vector<FieldValueType> make_field_element_block(
+                    const field_element_block<nil::marshalling::field_type<Endianness>, FieldValueType> &filled_block) {
+                    return filled_block.value();
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_FIELD_ELEMENT_BLOCK_HPP
@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE crypto3_marshalling_field_element_block_test
+
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/field_element_block.hpp>
+
+template<typename FieldType, typename Endianness>
+void test_field_element_block(nil::crypto3::marshalling::types::field_element_encoding encoding) {
+    using namespace nil::crypto3::marshalling;
+
+    using value_type = typename FieldType::value_type;
+    using TTypeBase = nil::marshalling::field_type<Endianness>;
+    using block_type = types::field_element_block<TTypeBase, value_type>;
+    using vector_type = types::field_element_vector<value_type, TTypeBase>;
+
+    std::vector<value_type> val;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        val.push_back(nil::crypto3::algebra::random_element<FieldType>());
+    }
+    val.push_back(value_type::zero());
+    val.push_back(value_type::one());
+
+    block_type filled_val = types::fill_field_element_block<value_type, Endianness>(val, encoding);
+    BOOST_CHECK(types::make_field_element_block<value_type, Endianness>(filled_val) == val);
+
+    std::vector<std::uint8_t> cv(filled_val.length());
+    auto write_iter = cv.begin();
+    BOOST_CHECK(filled_val.write(write_iter, cv.size()) == nil::marshalling::status_type::success);
+    BOOST_CHECK(write_iter == cv.end());
+
+    // Elements of the block are not larger than the ones of a field_element_vector.
+    vector_type filled_vector = types::fill_field_element_vector<value_type, Endianness>(val);
+    BOOST_CHECK(filled_val.length() <= filled_vector.length() + 1);
+
+    block_type test_val_read;
+    auto read_iter = cv.cbegin();
+    BOOST_CHECK(test_val_read.read(read_iter, cv.size()) == nil::marshalling::status_type::success);
+    BOOST_CHECK(read_iter == cv.cend());
+    BOOST_CHECK(test_val_read.encoding() == encoding);
+    BOOST_CHECK(test_val_read.value() == val);
+
+    // Non-contiguous iterators take the slow path, the result must be the same.
+    std::vector<std::uint8_t> slow_cv;
+    auto back_inserter = std::back_inserter(slow_cv);
+    filled_val.write_no_status(back_inserter);
+    BOOST_CHECK(slow_cv == cv);
+
+    read_iter = cv.cbegin();
+    BOOST_CHECK(test_val_read.read(read_iter, cv.size() - 1) == nil::marshalling::status_type::not_enough_data);
+
+    cv[filled_val.length() - val.size() * types::field_element_block_element_length<value_type>() - 1] = 0xFF;
+    read_iter = cv.cbegin();
+    BOOST_CHECK(test_val_read.read(read_iter, cv.size()) == nil::marshalling::status_type::invalid_msg_data);
+}
+
+template<typename FieldType, typename Endianness>
+void test_field_element_block() {
+    using nil::crypto3::marshalling::types::field_element_encoding;
+    test_field_element_block<FieldType, Endianness>(field_element_encoding::canonical);
+    test_field_element_block<FieldType, Endianness>(field_element_encoding::montgomery);
+}
+
+BOOST_AUTO_TEST_SUITE(field_element_block_test_suite)
+
+BOOST_AUTO_TEST_CASE(field_element_block_bls12_381_g1_field_be) {
+    test_field_element_block<nil::crypto3::algebra::curves::bls12<381>::g1_type<>::field_type,
+                             nil::marshalling::option::big_endian>();
+}
+
+BOOST_AUTO_TEST_CASE(field_element_block_bls12_381_g1_field_le) {
+    test_field_element_block<nil::crypto3::algebra::curves::bls12<381>::g1_type<>::field_type,
+                             nil::marshalling::option::little_endian>();
+}
+
+BOOST_AUTO_TEST_CASE(field_element_block_bls12_381_g2_field_be) {
+    test_field_element_block<nil::crypto3::algebra::curves::bls12<381>::g2_type<>::field_type,
+                             nil::marshalling::option::big_endian>();
+}
+
+BOOST_AUTO_TEST_CASE(field_element_block_bls12_381_g2_field_le) {
+    test_field_element_block<nil::crypto3::algebra::curves::bls12<381>::g2_type<>::field_type,
+                             nil::marshalling::option::little_endian>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
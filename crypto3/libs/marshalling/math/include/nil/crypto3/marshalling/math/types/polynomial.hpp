@@ -38,6 +38,7 @@
 #include <nil/marshalling/options.hpp>
 
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/field_element_block.hpp>
 #include <nil/crypto3/math/type_traits.hpp>
 
 namespace nil {
@@ -166,6 +167,94 @@ namespace nil {
                     return result;
                 }
 
+                ///////////////////////////////////////////////
+                // Bulk polynomial marshalling, values are stored as a field_element_block.
+                ///////////////////////////////////////////////
+                template<typename TTypeBase, typename PolynomialType, typename Enable = void>
+                struct polynomial_block;
+
+                template<typename TTypeBase, typename PolynomialType>
+                struct polynomial_block<TTypeBase, PolynomialType, std::enable_if_t<
+                        nil::crypto3::math::is_polynomial<PolynomialType>::value>> {
+                    using type = field_element_block<TTypeBase, typename PolynomialType::value_type>;
+                };
+
+                template<typename TTypeBase, typename PolynomialDFSType>
+                struct polynomial_block<TTypeBase, PolynomialDFSType, std::enable_if_t<
+                        nil::crypto3::math::is_polynomial_dfs<PolynomialDFSType>::value>> {
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // degree
+                            nil::marshalling::types::integral<TTypeBase, std::size_t>,
+                            // values
+                            field_element_block<TTypeBase, typename PolynomialDFSType::value_type>
+                        >
+                    >;
+                };
+
+                template<typename Endianness, typename PolynomialType>
+                typename polynomial_block<nil::marshalling::field_type<Endianness>, PolynomialType>::type
+                fill_polynomial_block(const PolynomialType &f,
+                                      field_element_encoding encoding = field_element_encoding::canonical) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using value_type = typename PolynomialType::value_type;
+
+                    field_element_block<TTypeBase, value_type> values(
+                        std::vector<value_type>(f.begin(), f.end()), encoding);
+                    if constexpr (nil::crypto3::math::is_polynomial_dfs<PolynomialType>::value) {
+                        using result_type = typename polynomial_block<TTypeBase, PolynomialType>::type;
+                        return result_type(std::make_tuple(
+                            nil::marshalling::types::integral<TTypeBase, std::size_t>(f.degree()),
+                            std::move(values)));
+                    } else {
+                        return values;
+                    }
+                }
+
+                template<typename Endianness, typename PolynomialType>
+                PolynomialType make_polynomial_block(
+                        const typename polynomial_block<
+                            nil::marshalling::field_type<Endianness>, PolynomialType>::type &filled_polynomial) {
+                    if constexpr (nil::crypto3::math::is_polynomial_dfs<PolynomialType>::value) {
+                        const auto &val = std::get<1>(filled_polynomial.value()).value();
+                        return PolynomialType(std::get<0>(filled_polynomial.value()).value(), val.begin(), val.end());
+                    } else {
+                        const auto &val = filled_polynomial.value();
+                        return PolynomialType(val.begin(), val.end());
+                    }
+                }
+
+                template<typename TTypeBase, typename PolynomialType>
+                using polynomial_block_vector = nil::marshalling::types::standard_array_list<
+                    TTypeBase,
+                    typename polynomial_block<TTypeBase, PolynomialType>::type
+                >;
+
+                template<typename Endianness, typename PolynomialType>
+                polynomial_block_vector<nil::marshalling::field_type<Endianness>, PolynomialType>
+                fill_polynomial_block_vector(const std::vector<PolynomialType> &f,
+                                             field_element_encoding encoding = field_element_encoding::canonical) {
+                    polynomial_block_vector<nil::marshalling::field_type<Endianness>, PolynomialType> result;
+                    result.value().reserve(f.size());
+                    for (const auto &poly: f) {
+                        result.value().push_back(fill_polynomial_block<Endianness, PolynomialType>(poly, encoding));
+                    }
+                    return result;
+                }
+
+                template<typename Endianness, typename PolynomialType>
+                std::vector<PolynomialType> make_polynomial_block_vector(
+                        const polynomial_block_vector<
+                            nil::marshalling::field_type<Endianness>, PolynomialType> &filled_polynomial_vector) {
+                    std::vector<PolynomialType> result;
+                    result.reserve(filled_polynomial_vector.value().size());
+                    for (const auto &filled_polynomial: filled_polynomial_vector.value()) {
+                        result.push_back(make_polynomial_block<Endianness, PolynomialType>(filled_polynomial));
+                    }
+                    return result;
+                }
+
             }    // namespace types
         }        // namespace marshalling
     }            // namespace crypto3
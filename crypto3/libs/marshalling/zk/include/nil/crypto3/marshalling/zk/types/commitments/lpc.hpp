@@ -29,9 +29,11 @@
 #ifndef CRYPTO3_MARSHALLING_LPC_COMMITMENT_HPP
 #define CRYPTO3_MARSHALLING_LPC_COMMITMENT_HPP
 
+#include <map>
 #include <ratio>
 #include <limits>
 #include <type_traits>
+#include <utility>
 
 #include <boost/assert.hpp>
 
@@ -308,6 +310,38 @@ namespace nil {
                     >;
                 };
 
+                // Shared by fill_commitment_scheme and fill_compact_commitment_scheme, both store
+                // std::map<std::size_t, bool> _batch_fixed as two parallel lists.
+                template<typename Endianness>
+                std::pair<
+                    nil::marshalling::types::array_list<
+                        nil::marshalling::field_type<Endianness>,
+                        nil::marshalling::types::integral<nil::marshalling::field_type<Endianness>, std::size_t>,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<nil::marshalling::field_type<Endianness>, std::size_t>>>,
+                    nil::marshalling::types::array_list<
+                        nil::marshalling::field_type<Endianness>,
+                        nil::marshalling::types::integral<nil::marshalling::field_type<Endianness>, std::size_t>,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<nil::marshalling::field_type<Endianness>, std::size_t>>>>
+                fill_batch_fixed(const std::map<std::size_t, bool> &batch_fixed) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using size_t_marshalling_type = nil::marshalling::types::integral<TTypeBase, std::size_t>;
+                    using list_type = nil::marshalling::types::array_list<
+                        TTypeBase,
+                        size_t_marshalling_type,
+                        nil::marshalling::option::sequence_size_field_prefix<size_t_marshalling_type>>;
+
+                    list_type filled_keys;
+                    list_type filled_values;
+                    for (const auto&[key, value]: batch_fixed) {
+                        filled_keys.value().push_back(size_t_marshalling_type(key));
+                        // Here we convert the value, that is a 'bool' into size_t, which is not good.
+                        filled_values.value().push_back(size_t_marshalling_type(value));
+                    }
+                    return {filled_keys, filled_values};
+                }
+
                 template<typename Endianness, typename LPCScheme>
                 typename commitment_scheme_state<nil::marshalling::field_type<Endianness>, LPCScheme,
                                                  std::enable_if_t<nil::crypto3::zk::is_lpc<LPCScheme>>>::type
@@ -337,25 +371,8 @@ namespace nil {
                     }
 
                     //std::map<std::size_t, bool> _batch_fixed;
-                    nil::marshalling::types::array_list<
-                           TTypeBase,
-                           nil::marshalling::types::integral<TTypeBase, std::size_t>,
-                           nil::marshalling::option::sequence_size_field_prefix<
-                               nil::marshalling::types::integral<TTypeBase, std::size_t>>
-                       > filled_batch_fixed_keys;
-                    nil::marshalling::types::array_list<
-                           TTypeBase,
-                           nil::marshalling::types::integral<TTypeBase, std::size_t>,
-                           nil::marshalling::option::sequence_size_field_prefix<
-                               nil::marshalling::types::integral<TTypeBase, std::size_t>>
-                       > filled_batch_fixed_values;
-                    for (const auto&[key, value]: scheme.get_batch_fixed()) {
-                        filled_batch_fixed_keys.value().push_back(
-                            nil::marshalling::types::integral<TTypeBase, std::size_t>(key));
-                        // Here we convert the value, that is a 'bool' into size_t, which is not good.
-                        filled_batch_fixed_values.value().push_back(
-                            nil::marshalling::types::integral<TTypeBase, std::size_t>(value));
-                    }
+                    auto [filled_batch_fixed_keys, filled_batch_fixed_values] =
+                        fill_batch_fixed<Endianness>(scheme.get_batch_fixed());
 
                     return result_type(std::make_tuple(
                         filled_trees_keys,
@@ -422,6 +439,146 @@ namespace nil {
                     return LPCScheme(evaluator, trees, fri_params, etha, batch_fixed, fixed_polys_values);
                 }
 
+                template <typename TTypeBase, typename CommitmentScheme, typename enable = void>
+                struct compact_commitment_scheme_state;
+
+                // Same as commitment_scheme_state, but only the roots of the merkle trees are stored, the trees
+                // themselves are rebuilt from the polynomials when the state is restored. Trees take more space than
+                // the polynomials they are built from, so this makes state files several times smaller.
+                // The polynomials are stored as field element blocks in Montgomery form, see polys_evaluator.
+                template <typename TTypeBase, typename LPCScheme>
+                struct compact_commitment_scheme_state<TTypeBase, LPCScheme, std::enable_if_t<nil::crypto3::zk::is_lpc<LPCScheme>> > {
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // Keys of std::map<std::size_t, precommitment_type> _trees;
+                            nil::marshalling::types::array_list<
+                                    TTypeBase,
+                                    nil::marshalling::types::integral<TTypeBase, std::size_t>,
+                                    nil::marshalling::option::sequence_size_field_prefix<
+                                        nil::marshalling::types::integral<TTypeBase, std::size_t>>
+                                >,
+                            // Roots of the trees, used to check the rebuilt trees.
+                            nil::marshalling::types::array_list<
+                                    TTypeBase,
+                                    typename commitment<TTypeBase, LPCScheme>::type,
+                                    nil::marshalling::option::sequence_size_field_prefix<
+                                        nil::marshalling::types::integral<TTypeBase, std::size_t>>
+                                >,
+                            // All the remaining fields are the same as in commitment_scheme_state.
+                            typename commitment_params<TTypeBase, LPCScheme>::type,
+                            field_element<TTypeBase, typename LPCScheme::value_type>,
+                            nil::marshalling::types::array_list<
+                                   TTypeBase,
+                                   nil::marshalling::types::integral<TTypeBase, std::size_t>,
+                                   nil::marshalling::option::sequence_size_field_prefix<
+                                       nil::marshalling::types::integral<TTypeBase, std::size_t>>
+                               >,
+                            nil::marshalling::types::array_list<
+                                   TTypeBase,
+                                   nil::marshalling::types::integral<TTypeBase, std::size_t>,
+                                   nil::marshalling::option::sequence_size_field_prefix<
+                                       nil::marshalling::types::integral<TTypeBase, std::size_t>>
+                               >,
+                            typename commitment_preprocessed_data<
+                                TTypeBase, LPCScheme,
+                                std::enable_if_t<nil::crypto3::zk::is_lpc<LPCScheme>>
+                            >::type,
+                            polys_evaluator<TTypeBase, typename LPCScheme::polys_evaluator_type, true>
+                        >
+                    >;
+                };
+
+                template<typename Endianness, typename LPCScheme>
+                typename compact_commitment_scheme_state<nil::marshalling::field_type<Endianness>, LPCScheme,
+                                                         std::enable_if_t<nil::crypto3::zk::is_lpc<LPCScheme>>>::type
+                fill_compact_commitment_scheme(const LPCScheme &scheme) {
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using result_type = typename compact_commitment_scheme_state<TTypeBase, LPCScheme>::type;
+
+                    nil::marshalling::types::array_list<
+                            TTypeBase,
+                            nil::marshalling::types::integral<TTypeBase, std::size_t>,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<TTypeBase, std::size_t>>
+                        > filled_trees_keys;
+                    nil::marshalling::types::array_list<
+                            TTypeBase,
+                            typename commitment<TTypeBase, LPCScheme>::type,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<TTypeBase, std::size_t>>
+                        > filled_roots;
+                    for (const auto&[key, value]: scheme.get_trees()) {
+                        filled_trees_keys.value().push_back(nil::marshalling::types::integral<TTypeBase, std::size_t>(key));
+                        filled_roots.value().push_back(fill_commitment<Endianness, LPCScheme>(value.root()));
+                    }
+
+                    auto [filled_batch_fixed_keys, filled_batch_fixed_values] =
+                        fill_batch_fixed<Endianness>(scheme.get_batch_fixed());
+
+                    return result_type(std::make_tuple(
+                        filled_trees_keys,
+                        filled_roots,
+                        fill_commitment_params<Endianness, LPCScheme>(scheme.get_fri_params()),
+                        field_element<TTypeBase, typename LPCScheme::value_type>(scheme.get_etha()),
+                        filled_batch_fixed_keys,
+                        filled_batch_fixed_values,
+                        fill_commitment_preprocessed_data<Endianness, LPCScheme>(scheme.get_fixed_polys_values()),
+                        fill_polys_evaluator<Endianness, typename LPCScheme::polys_evaluator_type, true>(
+                            static_cast<const typename LPCScheme::polys_evaluator_type&>(scheme))
+                    ));
+                }
+
+                template<typename Endianness, typename LPCScheme>
+                outcome::result<LPCScheme, nil::marshalling::status_type>
+                make_compact_commitment_scheme(
+                    typename compact_commitment_scheme_state<
+                        nil::marshalling::field_type<Endianness>, LPCScheme,
+                        std::enable_if_t<nil::crypto3::zk::is_lpc<LPCScheme>>>::type& filled_commitment_scheme
+                ) {
+                    std::map<std::size_t, typename LPCScheme::commitment_type> roots;
+                    const auto& filled_tree_keys = std::get<0>(filled_commitment_scheme.value()).value();
+                    const auto& filled_tree_roots = std::get<1>(filled_commitment_scheme.value()).value();
+
+                    if (filled_tree_keys.size() != filled_tree_roots.size()) {
+                        return nil::marshalling::status_type::invalid_msg_data;
+                    }
+
+                    for (std::size_t i = 0; i < filled_tree_keys.size(); i++) {
+                        roots[std::size_t(filled_tree_keys[i].value())] =
+                            make_commitment<Endianness, LPCScheme>(filled_tree_roots[i]);
+                    }
+
+                    typename LPCScheme::fri_type::params_type fri_params = make_commitment_params<Endianness, LPCScheme>(
+                        std::get<2>(filled_commitment_scheme.value()));
+                    typename LPCScheme::value_type etha = std::get<3>(filled_commitment_scheme.value()).value();
+
+                    std::map<std::size_t, bool> batch_fixed;
+                    const auto& batch_fixed_keys = std::get<4>(filled_commitment_scheme.value()).value();
+                    const auto& batch_fixed_values = std::get<5>(filled_commitment_scheme.value()).value();
+                    if (batch_fixed_keys.size() != batch_fixed_values.size()) {
+                        return nil::marshalling::status_type::invalid_msg_data;
+                    }
+                    for (std::size_t i = 0; i < batch_fixed_keys.size(); i++) {
+                        batch_fixed[std::size_t(batch_fixed_keys[i].value())] = bool(batch_fixed_values[i].value());
+                    }
+
+                    typename LPCScheme::preprocessed_data_type fixed_polys_values =
+                        make_commitment_preprocessed_data<Endianness, LPCScheme>(
+                            std::get<6>(filled_commitment_scheme.value()));
+
+                    typename LPCScheme::polys_evaluator_type evaluator = make_polys_evaluator<
+                            Endianness, typename LPCScheme::polys_evaluator_type, true>(
+                        std::get<7>(filled_commitment_scheme.value())
+                        );
+
+                    LPCScheme scheme(evaluator, {}, fri_params, etha, batch_fixed, fixed_polys_values);
+                    if (!scheme.rebuild_trees(roots)) {
+                        return nil::marshalling::status_type::invalid_msg_data;
+                    }
+                    return scheme;
+                }
+
                 template <typename TTypeBase, typename LPCScheme>
                 using initial_fri_proof_type = nil::marshalling::types::bundle<
                     TTypeBase,
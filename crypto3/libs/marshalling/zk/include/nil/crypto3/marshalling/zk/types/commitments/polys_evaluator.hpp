@@ -48,8 +48,18 @@ namespace nil {
         namespace marshalling {
             namespace types {
 
+                // Marshalling type of the polynomials of one batch. With BulkPolynomials the values are written as
+                // field_element_blocks in Montgomery form, which is much faster for large batches, but can only be
+                // read back by a build with the same field arithmetic.
+                template <typename TTypeBase, typename PolynomialType, bool BulkPolynomials>
+                using polys_evaluator_polynomial_vector = typename std::conditional<
+                    BulkPolynomials,
+                    polynomial_block_vector<TTypeBase, PolynomialType>,
+                    polynomial_vector<TTypeBase, PolynomialType>
+                >::type;
+
                 // * PolysEvaluator is like lpc_commitment_scheme
-                template <typename TTypeBase, typename PolysEvaluator>
+                template <typename TTypeBase, typename PolysEvaluator, bool BulkPolynomials = false>
                 using polys_evaluator = nil::marshalling::types::bundle<
                     TTypeBase,
                     std::tuple<
@@ -57,7 +67,8 @@ namespace nil {
                         nil::marshalling::types::standard_size_t_array_list<TTypeBase>,
                         nil::marshalling::types::standard_array_list<
                             TTypeBase,
-                            polynomial_vector<TTypeBase, typename PolysEvaluator::polynomial_type>
+                            polys_evaluator_polynomial_vector<
+                                TTypeBase, typename PolysEvaluator::polynomial_type, BulkPolynomials>
                         >,
                         // std::map<std::size_t, bool> _locked;
                         nil::marshalling::types::standard_size_t_array_list<TTypeBase>,
@@ -77,8 +88,8 @@ namespace nil {
                     > // This one closes the tuple
                 >; // this one closes the bundle
 
-                template <typename Endianness, typename PolysEvaluator>
-                polys_evaluator<nil::marshalling::field_type<Endianness>, PolysEvaluator>
+                template <typename Endianness, typename PolysEvaluator, bool BulkPolynomials = false>
+                polys_evaluator<nil::marshalling::field_type<Endianness>, PolysEvaluator, BulkPolynomials>
                 fill_polys_evaluator(const PolysEvaluator& evaluator) {
 
                     using nil::marshalling::types::fill_size_t;
@@ -91,12 +102,13 @@ namespace nil {
                     using value_type = typename polynomial_type::value_type;
 
                     using size_t_marshalling_type = nil::marshalling::types::integral<TTypeBase, std::size_t>;
-                    using polynomial_vector_marshalling_type = polynomial_vector<TTypeBase, polynomial_type>;
+                    using polynomial_vector_marshalling_type =
+                        polys_evaluator_polynomial_vector<TTypeBase, polynomial_type, BulkPolynomials>;
                     
                     using field_element_vector_type = field_element_vector<value_type, nil::marshalling::field_type<Endianness>>;
                     using array_of_field_element_vector_type = standard_array_list<TTypeBase, field_element_vector_type>;
 
-                    using result_type = polys_evaluator<nil::marshalling::field_type<Endianness>, PolysEvaluator>;
+                    using result_type = polys_evaluator<nil::marshalling::field_type<Endianness>, PolysEvaluator, BulkPolynomials>;
 
                     auto [filled_polys_keys, filled_polys_values] = fill_std_map<
                             TTypeBase,
@@ -104,7 +116,16 @@ namespace nil {
                             polynomial_vector_marshalling_type,
                             std::size_t,
                             std::vector<polynomial_type>>(
-                        evaluator._polys, fill_size_t<TTypeBase>, fill_polynomial_vector<Endianness, polynomial_type>);
+                        evaluator._polys,
+                        fill_size_t<TTypeBase>,
+                        [](const std::vector<polynomial_type>& polys) -> polynomial_vector_marshalling_type {
+                            if constexpr (BulkPolynomials) {
+                                return fill_polynomial_block_vector<Endianness, polynomial_type>(
+                                    polys, field_element_encoding::montgomery);
+                            } else {
+                                return fill_polynomial_vector<Endianness, polynomial_type>(polys);
+                            }
+                        });
 
                     // Note that we marshall a bool value as an std::size_t.
                     auto [filled_locked_keys, filled_locked_values] = fill_std_map<
@@ -144,9 +165,10 @@ namespace nil {
                     );
                 }
 
-                template <typename Endianness, typename PolysEvaluator>
+                template <typename Endianness, typename PolysEvaluator, bool BulkPolynomials = false>
                 PolysEvaluator make_polys_evaluator(
-                    const polys_evaluator<nil::marshalling::field_type<Endianness>, PolysEvaluator>& filled_polys_evaluator
+                    const polys_evaluator<
+                        nil::marshalling::field_type<Endianness>, PolysEvaluator, BulkPolynomials>& filled_polys_evaluator
                 ) {
                     using nil::marshalling::types::make_size_t;
                     using nil::marshalling::types::make_std_map;
@@ -158,7 +180,8 @@ namespace nil {
                     using value_type = typename polynomial_type::value_type;
 
                     using size_t_marshalling_type = nil::marshalling::types::integral<TTypeBase, std::size_t>;
-                    using polynomial_vector_marshalling_type = polynomial_vector<TTypeBase, polynomial_type>;
+                    using polynomial_vector_marshalling_type =
+                        polys_evaluator_polynomial_vector<TTypeBase, polynomial_type, BulkPolynomials>;
                     
                     using field_element_vector_type = field_element_vector<value_type, nil::marshalling::field_type<Endianness>>;
                     using array_of_field_element_vector_type = standard_array_list<TTypeBase, field_element_vector_type>;
@@ -173,7 +196,13 @@ namespace nil {
                         std::get<0>(filled_polys_evaluator.value()), 
                         std::get<1>(filled_polys_evaluator.value()), 
                         make_size_t<TTypeBase>,
-                        make_polynomial_vector<Endianness, polynomial_type>);
+                        [](const polynomial_vector_marshalling_type& polys) -> std::vector<polynomial_type> {
+                            if constexpr (BulkPolynomials) {
+                                return make_polynomial_block_vector<Endianness, polynomial_type>(polys);
+                            } else {
+                                return make_polynomial_vector<Endianness, polynomial_type>(polys);
+                            }
+                        });
 
                     result._locked = make_std_map<TTypeBase, std::size_t, bool, size_t_marshalling_type, size_t_marshalling_type>(
                         std::get<2>(filled_polys_evaluator.value()), 
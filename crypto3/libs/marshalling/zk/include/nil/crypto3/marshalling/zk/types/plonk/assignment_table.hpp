@@ -37,6 +37,7 @@
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/options.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/field_element_block.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -98,7 +99,21 @@ namespace nil {
                 /////////   Marshalling the assignment table.
                 /////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                template<typename TTypeBase, typename PlonkTable>
+                // All the columns of one kind, concatenated. With BulkColumns they are stored as a field_element_block,
+                // which is (de)serialized at memory speed instead of element by element.
+                template<typename TTypeBase, typename FieldValueType, bool BulkColumns>
+                using plonk_assignment_table_columns = typename std::conditional<
+                    BulkColumns,
+                    field_element_block<TTypeBase, FieldValueType>,
+                    nil::marshalling::types::array_list<
+                        TTypeBase,
+                        field_element<TTypeBase, FieldValueType>,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<TTypeBase, std::size_t>>
+                    >
+                >::type;
+
+                template<typename TTypeBase, typename PlonkTable, bool BulkColumns = false>
                 using plonk_assignment_table = nil::marshalling::types::bundle<
                     TTypeBase, std::tuple<
                         nil::marshalling::types::integral<TTypeBase, std::size_t>, // witness_amount
@@ -109,33 +124,17 @@ namespace nil {
                         nil::marshalling::types::integral<TTypeBase, std::size_t>, // usable_rows
                         nil::marshalling::types::integral<TTypeBase, std::size_t>, // rows_amount
                         // witnesses
-                        nil::marshalling::types::array_list<
-                            TTypeBase,
-                            field_element<TTypeBase, typename PlonkTable::field_type::value_type>,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<TTypeBase, std::size_t>>
-                        >,
+                        plonk_assignment_table_columns<
+                            TTypeBase, typename PlonkTable::field_type::value_type, BulkColumns>,
                         // public_inputs
-                        nil::marshalling::types::array_list<
-                            TTypeBase,
-                            field_element<TTypeBase, typename PlonkTable::field_type::value_type>,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<TTypeBase, std::size_t>>
-                        >,
+                        plonk_assignment_table_columns<
+                            TTypeBase, typename PlonkTable::field_type::value_type, BulkColumns>,
                         // constants
-                        nil::marshalling::types::array_list<
-                            TTypeBase,
-                            field_element<TTypeBase, typename PlonkTable::field_type::value_type>,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<TTypeBase, std::size_t>>
-                        >,
+                        plonk_assignment_table_columns<
+                            TTypeBase, typename PlonkTable::field_type::value_type, BulkColumns>,
                         // selectors
-                        nil::marshalling::types::array_list<
-                            TTypeBase,
-                            field_element<TTypeBase, typename PlonkTable::field_type::value_type>,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<TTypeBase, std::size_t>>
-                        >
+                        plonk_assignment_table_columns<
+                            TTypeBase, typename PlonkTable::field_type::value_type, BulkColumns>
                     >
                 >;
 
@@ -194,15 +193,60 @@ namespace nil {
                     return result;
                 }
 
-                template<typename Endianness, typename PlonkTable>
-                plonk_assignment_table<nil::marshalling::field_type<Endianness>, PlonkTable> fill_assignment_table(
+                template<typename FieldValueType, typename Endianness>
+                field_element_block<nil::marshalling::field_type<Endianness>, FieldValueType>
+                    fill_field_element_block_from_columns_with_padding(
+                        const std::vector<std::vector<FieldValueType>> &columns,
+                        const std::size_t size,
+                        const FieldValueType &padding) {
+
+                    std::vector<FieldValueType> result;
+                    result.reserve(size * columns.size());
+                    for (const auto &column: columns) {
+                        result.insert(result.end(), column.begin(), column.end());
+                        if (column.size() < size) {
+                            result.insert(result.end(), size - column.size(), padding);
+                        }
+                    }
+                    return field_element_block<nil::marshalling::field_type<Endianness>, FieldValueType>(
+                        std::move(result));
+                }
+
+                template<typename FieldValueType, typename Endianness>
+                std::vector<std::vector<FieldValueType>> make_field_element_columns_vector(
+                    const field_element_block<nil::marshalling::field_type<Endianness>, FieldValueType> &filled_block,
+                    const std::size_t columns_amount,
+                    const std::size_t rows_amount) {
+
+                    BOOST_ASSERT(filled_block.value().size() == columns_amount * rows_amount);
+                    std::vector<std::vector<FieldValueType>> result;
+                    result.reserve(columns_amount);
+                    auto it = filled_block.value().begin();
+                    for (std::size_t i = 0; i < columns_amount; i++, it += rows_amount) {
+                        result.emplace_back(it, it + rows_amount);
+                    }
+                    return result;
+                }
+
+                template<typename Endianness, typename PlonkTable, bool BulkColumns = false>
+                plonk_assignment_table<nil::marshalling::field_type<Endianness>, PlonkTable, BulkColumns> fill_assignment_table(
                     std::size_t usable_rows,
                     const PlonkTable &assignments
                 ) {
                     using TTypeBase = nil::marshalling::field_type<Endianness>;
-                    using result_type = plonk_assignment_table<nil::marshalling::field_type<Endianness>, PlonkTable>;
+                    using result_type = plonk_assignment_table<nil::marshalling::field_type<Endianness>, PlonkTable, BulkColumns>;
                     using value_type = typename PlonkTable::field_type::value_type;
 
+                    auto fill_columns = [](const std::vector<std::vector<value_type>> &columns, std::size_t size) {
+                        if constexpr (BulkColumns) {
+                            return fill_field_element_block_from_columns_with_padding<value_type, Endianness>(
+                                columns, size, value_type::zero());
+                        } else {
+                            return fill_field_element_vector_from_columns_with_padding<value_type, Endianness>(
+                                columns, size, 0u);
+                        }
+                    };
+
                     return result_type(std::move(std::make_tuple(
                         nil::marshalling::types::integral<TTypeBase, std::size_t>(assignments.witnesses_amount()),
                         nil::marshalling::types::integral<TTypeBase, std::size_t>(assignments.public_inputs_amount()),
@@ -210,31 +254,16 @@ namespace nil {
                         nil::marshalling::types::integral<TTypeBase, std::size_t>(assignments.selectors_amount()),
                         nil::marshalling::types::integral<TTypeBase, std::size_t>(usable_rows),
                         nil::marshalling::types::integral<TTypeBase, std::size_t>(assignments.rows_amount()),
-                        fill_field_element_vector_from_columns_with_padding<value_type, Endianness>(
-                            assignments.witnesses(),
-                            assignments.rows_amount(),
-                            0u
-                        ),
-                        fill_field_element_vector_from_columns_with_padding<value_type, Endianness>(
-                            assignments.public_inputs(),
-                            assignments.rows_amount(),
-                            0u
-                        ),
-                        fill_field_element_vector_from_columns_with_padding<value_type, Endianness>(
-                            assignments.constants(),
-                            assignments.rows_amount(),
-                            0u
-                        ),
-                        fill_field_element_vector_from_columns_with_padding<value_type, Endianness>(
-                            assignments.selectors(),
-                            assignments.rows_amount(),
-                            0u
-                        )
+                        fill_columns(assignments.witnesses(), assignments.rows_amount()),
+                        fill_columns(assignments.public_inputs(), assignments.rows_amount()),
+                        fill_columns(assignments.constants(), assignments.rows_amount()),
+                        fill_columns(assignments.selectors(), assignments.rows_amount())
                     )));
                 }
-                template<typename Endianness, typename PlonkTable>
+                template<typename Endianness, typename PlonkTable, bool BulkColumns = false>
                 std::pair<zk::snark::plonk_table_description<typename PlonkTable::field_type>, PlonkTable> make_assignment_table(
-                        const plonk_assignment_table<nil::marshalling::field_type<Endianness>, PlonkTable> &filled_assignments){
+                        const plonk_assignment_table<
+                            nil::marshalling::field_type<Endianness>, PlonkTable, BulkColumns> &filled_assignments){
 
                     using value_type = typename PlonkTable::field_type::value_type;
 
@@ -279,8 +308,9 @@ namespace nil {
                         );
 
                     return std::make_pair(desc, PlonkTable(
-                        typename PlonkTable::private_table_type(witnesses),
-                        typename PlonkTable::public_table_type(public_inputs, constants, selectors)
+                        typename PlonkTable::private_table_type(std::move(witnesses)),
+                        typename PlonkTable::public_table_type(
+                            std::move(public_inputs), std::move(constants), std::move(selectors))
                     ));
                 }
 
@@ -151,6 +151,31 @@ void test_lpc_state_recovery(const LPC& lpc_commitment_scheme) {
     BOOST_CHECK(lpc_commitment_scheme == constructed_val_read.value());
 }
 
+// Same as above, but for the compact state which stores only the roots of the merkle trees.
+template<typename Endianness, typename LPC>
+void test_lpc_compact_state_recovery(const LPC& lpc_commitment_scheme) {
+    using TTypeBase = nil::marshalling::field_type<Endianness>;
+
+    auto filled_lpc_scheme = nil::crypto3::marshalling::types::fill_compact_commitment_scheme<Endianness, LPC>(lpc_commitment_scheme);
+    BOOST_CHECK(filled_lpc_scheme.length() <
+        nil::crypto3::marshalling::types::fill_commitment_scheme<Endianness, LPC>(lpc_commitment_scheme).length());
+
+    std::vector<std::uint8_t> cv;
+    cv.resize(filled_lpc_scheme.length(), 0x00);
+    auto write_iter = cv.begin();
+    auto status = filled_lpc_scheme.write(write_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    typename nil::crypto3::marshalling::types::compact_commitment_scheme_state<TTypeBase, LPC>::type test_val_read;
+    auto read_iter = cv.begin();
+    status = test_val_read.read(read_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    auto constructed_val_read =
+            nil::crypto3::marshalling::types::make_compact_commitment_scheme<Endianness, LPC>(test_val_read);
+    BOOST_CHECK(constructed_val_read.has_value());
+    BOOST_CHECK(lpc_commitment_scheme == constructed_val_read.value());
+}
+
 BOOST_AUTO_TEST_SUITE(marshalling_random)
     // setup
     static constexpr std::size_t lambda = 40;
@@ -282,6 +307,7 @@ BOOST_FIXTURE_TEST_CASE(batches_num_3_test, test_tools::random_test_initializer<
 
     test_lpc_proof<Endianness, lpc_scheme_type>(proof, fri_params);
     test_lpc_state_recovery<Endianness, lpc_scheme_type>(lpc_scheme_prover);
+    test_lpc_compact_state_recovery<Endianness, lpc_scheme_type>(lpc_scheme_prover);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
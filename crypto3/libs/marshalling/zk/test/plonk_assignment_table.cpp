@@ -106,18 +106,20 @@ struct plonk_assignment_table_test_runner {
         return true;
     }
 
-    template<typename Endianness>
+    template<typename Endianness, bool BulkColumns = false>
     bool test_assignment_table()
     {
         using TTypeBase = nil::marshalling::field_type<Endianness>;
         using plonk_table = plonk_assignment_table<field_type>;
-        using value_marshalling_type = nil::crypto3::marshalling::types::plonk_assignment_table<TTypeBase, plonk_table>;
+        using value_marshalling_type =
+            nil::crypto3::marshalling::types::plonk_assignment_table<TTypeBase, plonk_table, BulkColumns>;
 
         std::size_t usable_rows = desc.usable_rows_amount;
         plonk_table const& val = assignments;
 
-        auto filled_val = nil::crypto3::marshalling::types::fill_assignment_table<Endianness, plonk_table>(usable_rows, val);
-        auto table_desc_pair = types::make_assignment_table<Endianness, plonk_table>(filled_val);
+        auto filled_val = nil::crypto3::marshalling::types::fill_assignment_table<Endianness, plonk_table, BulkColumns>(
+            usable_rows, val);
+        auto table_desc_pair = types::make_assignment_table<Endianness, plonk_table, BulkColumns>(filled_val);
         BOOST_CHECK(val == table_desc_pair.second);
         BOOST_CHECK(usable_rows == table_desc_pair.first.usable_rows_amount);
 
@@ -130,7 +132,7 @@ struct plonk_assignment_table_test_runner {
         auto read_iter = cv.begin();
         status = test_val_read.read(read_iter, cv.size());
         BOOST_CHECK(status == nil::marshalling::status_type::success);
-        table_desc_pair = types::make_assignment_table<Endianness, plonk_table>(test_val_read);
+        table_desc_pair = types::make_assignment_table<Endianness, plonk_table, BulkColumns>(test_val_read);
 
         BOOST_CHECK(val == table_desc_pair.second);
         BOOST_CHECK(usable_rows == table_desc_pair.first.usable_rows_amount);
@@ -143,6 +145,7 @@ struct plonk_assignment_table_test_runner {
         using Endianness = nil::marshalling::option::big_endian;
         BOOST_CHECK(test_assignment_table_description<Endianness>());
         BOOST_CHECK(test_assignment_table<Endianness>());
+        BOOST_CHECK((test_assignment_table<Endianness, true>()));
         return true;
     }
 
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/batch_operations.hpp>
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
@@ -86,6 +87,11 @@ namespace nil {
                     for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
                         // w_m is 2^s-th root of unity now
                         for (std::size_t k = 0; k < n; k += 2 * m) {
+                            if constexpr (algebra::fields::is_goldilocks64_element<value_type>) {
+                                algebra::fields::goldilocks64_batch_operations::butterfly(
+                                    &a[k], &a[k + m], &omega_cache[0], inc, m);
+                                continue;
+                            }
                             for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
                                 t = a[k + j + m];
                                 t *= omega_cache[idx];
@@ -138,7 +138,7 @@ namespace nil {
                                      "DFS optimal polynomial size must be a power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynomial size must be a power of two");
                 }
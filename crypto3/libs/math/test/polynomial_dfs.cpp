@@ -95,6 +95,17 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_from_coefficients_less_degree) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_dfs_adopts_moved_container) {
+    std::vector<typename FieldType::value_type> values = {1u, 3u, 4u, 25u, 6u, 7u, 7u, 2u};
+    const typename FieldType::value_type *storage = values.data();
+
+    polynomial_dfs<typename FieldType::value_type> a(7, std::move(values));
+
+    BOOST_CHECK_EQUAL(a.size(), 8);
+    BOOST_CHECK(&*a.begin() == storage);
+    BOOST_CHECK_EQUAL(a[3].data, typename FieldType::value_type(25u).data);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(polynomial_dfs_coefficients_test_suite)
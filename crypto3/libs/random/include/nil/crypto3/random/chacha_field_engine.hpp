@@ -0,0 +1,224 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_RANDOM_CHACHA_FIELD_ENGINE_HPP
+#define CRYPTO3_RANDOM_CHACHA_FIELD_ENGINE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/random/random_device.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace random {
+            namespace detail {
+                inline std::uint32_t chacha_rotl(std::uint32_t x, int n) {
+                    return (x << n) | (x >> (32 - n));
+                }
+
+                inline void chacha_quarter_round(std::array<std::uint32_t, 16> &x, int a, int b, int c, int d) {
+                    x[a] += x[b]; x[d] = chacha_rotl(x[d] ^ x[a], 16);
+                    x[c] += x[d]; x[b] = chacha_rotl(x[b] ^ x[c], 12);
+                    x[a] += x[b]; x[d] = chacha_rotl(x[d] ^ x[a], 8);
+                    x[c] += x[d]; x[b] = chacha_rotl(x[b] ^ x[c], 7);
+                }
+
+                /**
+                 * ChaCha20 block function with a 64-bit block counter and a 64-bit nonce, as in the original
+                 * construction by D. J. Bernstein. Any block of the key stream can be computed directly.
+                 */
+                inline std::array<std::uint32_t, 16> chacha20_block(const std::array<std::uint32_t, 8> &key,
+                                                                   std::uint64_t counter, std::uint64_t nonce) {
+                    std::array<std::uint32_t, 16> input = {
+                        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+                        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+                        static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32),
+                        static_cast<std::uint32_t>(nonce), static_cast<std::uint32_t>(nonce >> 32)};
+                    std::array<std::uint32_t, 16> x = input;
+                    for (int round = 0; round < 10; ++round) {
+                        chacha_quarter_round(x, 0, 4, 8, 12);
+                        chacha_quarter_round(x, 1, 5, 9, 13);
+                        chacha_quarter_round(x, 2, 6, 10, 14);
+                        chacha_quarter_round(x, 3, 7, 11, 15);
+                        chacha_quarter_round(x, 0, 5, 10, 15);
+                        chacha_quarter_round(x, 1, 6, 11, 12);
+                        chacha_quarter_round(x, 2, 7, 8, 13);
+                        chacha_quarter_round(x, 3, 4, 9, 14);
+                    }
+                    for (std::size_t i = 0; i < 16; ++i) {
+                        x[i] += input[i];
+                    }
+                    return x;
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief
+             * @tparam FieldType prime field of the generated values.
+             *
+             * Counter-based generator of field elements over the ChaCha20 key stream. The element with index i is
+             * computed from its own blocks of the key stream, so the generator can be moved to any position in
+             * constant time and a range of elements can be filled by several threads, each starting at the index of
+             * its chunk. Streams with different ids produce independent sequences for the same key.
+             *
+             * Each element is reduced from at least modulus_bits + 128 random bits, so the distribution is
+             * statistically close to uniform. The output is deterministic for a given key, use from_random_device()
+             * for the values which have to be secret, such as blinding values. It reads the key from the same source
+             * as algebraic_random_device.
+             */
+            template<typename FieldType>
+            class chacha_field_engine {
+                static_assert(algebra::is_field<FieldType>::value && !algebra::is_extended_field<FieldType>::value,
+                              "chacha_field_engine generates elements of prime fields only");
+
+            public:
+                typedef FieldType field_type;
+                typedef typename field_type::value_type result_type;
+                typedef typename field_type::integral_type integral_type;
+                typedef std::array<std::uint32_t, 8> key_type;
+
+                // Elements are built from limbs smaller than the modulus, so each limb is a valid field element.
+                constexpr static const std::size_t limb_bits = field_type::modulus_bits - 1;
+                constexpr static const std::size_t limbs_per_element =
+                    (field_type::modulus_bits + 128 + limb_bits - 1) / limb_bits;
+                constexpr static const std::size_t blocks_per_element = (limbs_per_element * limb_bits + 511) / 512;
+
+                explicit chacha_field_engine(const key_type &key, std::uint64_t stream_id = 0) :
+                    _key(key), _stream_id(stream_id), _position(0) {
+                }
+
+                // Deterministic generator, e.g. for reproducible test proofs. There is no default seed, callers
+                // choose between a fixed seed and from_random_device().
+                explicit chacha_field_engine(std::uint64_t seed, std::uint64_t stream_id = 0) :
+                    _key({static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32), 0, 0, 0, 0, 0, 0}),
+                    _stream_id(stream_id), _position(0) {
+                }
+
+                static chacha_field_engine from_random_device(std::uint64_t stream_id = 0) {
+                    boost::random_device device;
+                    key_type key;
+                    for (auto &word: key) {
+                        word = device();
+                    }
+                    return chacha_field_engine(key, stream_id);
+                }
+
+                /** Returns a generator with the same key and another stream id, its sequence is independent. */
+                chacha_field_engine stream(std::uint64_t stream_id) const {
+                    return chacha_field_engine(_key, stream_id);
+                }
+
+                /** Returns the element with the given index without changing the position. */
+                result_type at(std::uint64_t index) const {
+                    std::array<std::uint32_t, blocks_per_element * 16 + 1> words;
+                    for (std::size_t block = 0; block < blocks_per_element; ++block) {
+                        auto block_words = detail::chacha20_block(_key, index * blocks_per_element + block, _stream_id);
+                        std::copy(block_words.begin(), block_words.end(), words.begin() + block * 16);
+                    }
+                    // Padding word, so the bits are always read from two neighbouring words.
+                    words.back() = 0;
+
+                    // 2^limb_bits is below the modulus, so it is built by a shift and computed once per field.
+                    static const result_type limb_base = result_type(integral_type(1) << limb_bits);
+                    result_type result = result_type::zero();
+                    for (std::size_t limb = limbs_per_element; limb-- > 0;) {
+                        result = result * limb_base + result_type(read_bits(words, limb * limb_bits, limb_bits));
+                    }
+                    return result;
+                }
+
+                result_type operator()() {
+                    return at(_position++);
+                }
+
+                /** Fills the range with the next elements of the sequence. */
+                template<typename OutputIterator>
+                void generate(OutputIterator first, OutputIterator last) {
+                    for (; first != last; ++first) {
+                        *first = (*this)();
+                    }
+                }
+
+                void seek(std::uint64_t position) {
+                    _position = position;
+                }
+
+                std::uint64_t position() const {
+                    return _position;
+                }
+
+                void discard(std::uint64_t z) {
+                    _position += z;
+                }
+
+                const key_type &key() const {
+                    return _key;
+                }
+
+                std::uint64_t stream_id() const {
+                    return _stream_id;
+                }
+
+                friend bool operator==(const chacha_field_engine &x, const chacha_field_engine &y) {
+                    return x._key == y._key && x._stream_id == y._stream_id && x._position == y._position;
+                }
+
+                friend bool operator!=(const chacha_field_engine &x, const chacha_field_engine &y) {
+                    return !(x == y);
+                }
+
+            private:
+                template<typename Words>
+                static integral_type read_bits(const Words &words, std::size_t begin, std::size_t count) {
+                    integral_type result = 0;
+                    std::size_t end = begin + count;
+                    while (end > begin) {
+                        std::size_t chunk = std::min<std::size_t>(32, end - begin);
+                        std::size_t start = end - chunk;
+                        std::uint64_t pair =
+                            words[start / 32] | (static_cast<std::uint64_t>(words[start / 32 + 1]) << 32);
+                        std::uint64_t value = (pair >> (start % 32)) & ((std::uint64_t(1) << chunk) - 1);
+                        result <<= chunk;
+                        result |= integral_type(value);
+                        end = start;
+                    }
+                    return result;
+                }
+
+                key_type _key;
+                std::uint64_t _stream_id;
+                std::uint64_t _position;
+            };
+        }    // namespace random
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_RANDOM_CHACHA_FIELD_ENGINE_HPP
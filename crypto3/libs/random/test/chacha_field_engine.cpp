@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE chacha_field_engine_test
+
+#include <array>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/random/chacha_field_engine.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+
+using namespace nil::crypto3;
+
+template<typename FieldType>
+void check_chacha_field_engine() {
+    using engine_type = random::chacha_field_engine<FieldType>;
+    constexpr std::size_t count = 64;
+
+    engine_type e1(0x0123456789abcdefULL), e2(0x0123456789abcdefULL);
+    std::vector<typename FieldType::value_type> v1(count), v2(count);
+    e1.generate(v1.begin(), v1.end());
+    for (auto &v : v2) {
+        v = e2();
+    }
+    BOOST_CHECK(v1 == v2);
+    BOOST_CHECK(e1 == e2);
+    BOOST_CHECK_EQUAL(e1.position(), count);
+
+    // Random access gives the same sequence.
+    const engine_type e3(0x0123456789abcdefULL);
+    for (std::size_t i = 0; i < count; ++i) {
+        BOOST_CHECK(e3.at(i) == v1[i]);
+    }
+    engine_type e4(0x0123456789abcdefULL);
+    e4.seek(count / 2);
+    BOOST_CHECK(e4() == v1[count / 2]);
+    e4.discard(3);
+    BOOST_CHECK(e4() == v1[count / 2 + 4]);
+
+    // Other seeds and other streams give other values.
+    engine_type other_seed(0x0123456789abcdeeULL);
+    BOOST_CHECK(other_seed() != v1[0]);
+    auto other_stream = e3.stream(1);
+    BOOST_CHECK(other_stream.key() == e3.key());
+    std::set<typename FieldType::integral_type> values;
+    for (std::size_t i = 0; i < count; ++i) {
+        values.insert(typename FieldType::integral_type(v1[i].data));
+        values.insert(typename FieldType::integral_type(other_stream().data));
+    }
+    BOOST_CHECK_EQUAL(values.size(), 2 * count);
+
+    auto device_engine = engine_type::from_random_device();
+    BOOST_CHECK(device_engine() != device_engine());
+}
+
+BOOST_AUTO_TEST_SUITE(chacha_field_engine_tests)
+
+// Key stream blocks from RFC 7539, appendix A.1 (test vector #1) and section 2.3.2. The 32-bit counter and the 96-bit
+// nonce of the RFC map to the 64-bit counter and the 64-bit nonce used here.
+BOOST_AUTO_TEST_CASE(chacha20_block_known_answer) {
+    const std::array<std::uint32_t, 8> zero_key = {};
+    const std::array<std::uint32_t, 16> zero_block = {
+        0xade0b876, 0x903df1a0, 0xe56a5d40, 0x28bd8653, 0xb819d2bd, 0x1aed8da0, 0xccef36a8, 0xc70d778b,
+        0x7c5941da, 0x8d485751, 0x3fe02477, 0x374ad8b8, 0xf4b8436a, 0x1ca11815, 0x69b687c3, 0x8665eeb2};
+    BOOST_CHECK(random::detail::chacha20_block(zero_key, 0, 0) == zero_block);
+
+    // Key 00:01:02:...:1f, block counter 1, nonce 00:00:00:09:00:00:00:4a:00:00:00:00.
+    const std::array<std::uint32_t, 8> key = {
+        0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c, 0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c};
+    const std::array<std::uint32_t, 16> block = {
+        0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3, 0xc7f4d1c7, 0x0368c033, 0x9aaa2204, 0x4e6cd4c3,
+        0x466482d2, 0x09aa9f07, 0x05d7c214, 0xa2028bd9, 0xd19c12b5, 0xb94e16de, 0xe883d0cb, 0x4e3c50a2};
+    BOOST_CHECK(random::detail::chacha20_block(key, 1 | (std::uint64_t(0x09000000) << 32), 0x4a000000) == block);
+}
+
+BOOST_AUTO_TEST_CASE(chacha_field_engine_pallas) {
+    check_chacha_field_engine<algebra::curves::pallas::base_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(chacha_field_engine_bls12_381) {
+    check_chacha_field_engine<algebra::curves::bls12<381>::scalar_field_type>();
+    check_chacha_field_engine<algebra::curves::bls12<381>::base_field_type>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
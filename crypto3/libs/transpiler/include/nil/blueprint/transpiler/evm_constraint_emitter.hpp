@@ -0,0 +1,425 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+// @file Gas-aware emitter of gate constraint series for the EVM verifier.
+//---------------------------------------------------------------------------//
+#ifndef __EVM_CONSTRAINT_EMITTER_HPP__
+#define __EVM_CONSTRAINT_EMITTER_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/zk/math/expression_visitors.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+
+namespace nil {
+    namespace blueprint {
+        /** @brief Emits Solidity code evaluating a series of gate constraints.
+         *
+         * All constraints of a series are lowered into one DAG: column loads and
+         * monomial products are hash-consed, so a value referenced several times
+         * is computed once and kept in a `cached` memory slot. Like terms are
+         * merged, zero terms dropped, coefficients 1 and -1 do not cost a mulmod,
+         * constraints of a gate are combined with Horner's rule in theta and the
+         * powers of theta needed to advance theta_acc are computed once per series.
+         *
+         * The emitted code uses the locals of the gate templates: blob, theta,
+         * theta_acc, F, gate, sum, prod and x.
+         */
+        template<typename FieldType>
+        class evm_constraint_series_emitter {
+        public:
+            using value_type = typename FieldType::value_type;
+            using variable_type = nil::crypto3::zk::snark::plonk_variable<value_type>;
+            using constraint_type = nil::crypto3::zk::snark::plonk_constraint<FieldType>;
+            using variable_indices_type = std::map<variable_type, std::size_t>;
+
+            evm_constraint_series_emitter(
+                const variable_indices_type &var_indices,
+                bool deduce_horner = true,
+                bool optimize_powers = true
+            ) : _var_indices(var_indices), _deduce_horner(deduce_horner), _optimize_powers(optimize_powers) {
+            }
+
+            /** @brief Appends a constraint to the series.
+             * @param[in] gate_index index of the gate, used in comments only
+             * @param[in] constraint_index index of the constraint inside the gate
+             * @param[in] selector_offset blob offset of the gate selector value
+             * @param[in] constraint constraint to evaluate
+             */
+            void add_constraint(std::size_t gate_index, std::size_t constraint_index,
+                    std::size_t selector_offset, const constraint_type &constraint) {
+                nil::crypto3::math::expression_to_non_linear_combination_visitor<variable_type> visitor;
+                auto comb = visitor.convert(constraint);
+
+                constraint_entry entry;
+                entry.gate_index = gate_index;
+                entry.constraint_index = constraint_index;
+                entry.constant = value_type::zero();
+
+                std::vector<std::pair<std::vector<std::size_t>, value_type>> terms;
+                for (auto it = std::cbegin(comb); it != std::cend(comb); ++it) {
+                    if (it->get_coeff() == value_type::zero()) {
+                        continue;
+                    }
+                    std::vector<std::size_t> offsets;
+                    for (const auto &var : it->get_vars()) {
+                        offsets.push_back(_var_indices.at(var) * 0x20);
+                    }
+                    if (offsets.empty()) {
+                        entry.constant += it->get_coeff();
+                        continue;
+                    }
+                    std::sort(offsets.begin(), offsets.end());
+                    terms.emplace_back(std::move(offsets), it->get_coeff());
+                }
+
+                if (_deduce_horner && is_univariate(terms)) {
+                    std::size_t degree = 0;
+                    for (const auto &term : terms) {
+                        degree = std::max(degree, term.first.size());
+                    }
+                    entry.horner_coeffs.assign(degree + 1, value_type::zero());
+                    entry.horner_coeffs[0] = entry.constant;
+                    for (const auto &term : terms) {
+                        entry.horner_coeffs[term.first.size()] += term.second;
+                    }
+                    entry.horner_var = load(terms[0].first[0]);
+                    use(entry.horner_var);
+                } else {
+                    for (const auto &term : terms) {
+                        std::size_t node = monomial(term.first);
+                        use(node);
+                        entry.terms.push_back({node, term.second});
+                    }
+                }
+
+                if (_entries.empty() || _entries.back().selector_offset != selector_offset) {
+                    entry.opens_group = true;
+                    entry.selector = load(selector_offset);
+                    use(entry.selector);
+                } else {
+                    entry.selector = _entries.back().selector;
+                }
+                entry.selector_offset = selector_offset;
+                _entries.push_back(std::move(entry));
+            }
+
+            std::size_t constraints_count() const {
+                return _entries.size();
+            }
+
+            /** @brief Prints the code of the whole series. */
+            void print(std::ostream &out) {
+                if (_entries.empty()) {
+                    return;
+                }
+
+                std::vector<std::pair<std::size_t, std::size_t>> groups;
+                for (std::size_t i = 0; i < _entries.size(); ++i) {
+                    if (_entries[i].opens_group) {
+                        groups.emplace_back(i, i);
+                    }
+                    groups.back().second = i + 1;
+                }
+
+                std::size_t slots = 0;
+                for (auto &node : _nodes) {
+                    if (node.uses > 1 || node.forced) {
+                        node.slot = slots++;
+                    }
+                }
+                _theta_powers.clear();
+                for (const auto &group : groups) {
+                    plan_theta_power(group.second - group.first, slots);
+                }
+
+                if (slots > 0) {
+                    out << "\t\tuint256[" << slots << "] memory cached;" << std::endl;
+                }
+                for (std::size_t i = 0; i < _nodes.size(); ++i) {
+                    if (_nodes[i].slot != npos) {
+                        print_node(out, i, "cached[" + std::to_string(_nodes[i].slot) + "]");
+                    }
+                }
+                for (const auto &power : _theta_powers) {
+                    std::size_t half = power.first / 2;
+                    std::string half_name = theta_power_name(half);
+                    out << "\t\tcached[" << power.second << "] = mulmod(" << half_name << ", " << half_name << ", modulus);" << std::endl;
+                    if (power.first & 1) {
+                        out << "\t\tcached[" << power.second << "] = mulmod(cached[" << power.second << "], theta, modulus);" << std::endl;
+                    }
+                }
+
+                for (const auto &group : groups) {
+                    out << "// gate === " << _entries[group.first].gate_index << " ===" << std::endl;
+                    for (std::size_t i = group.second; i-- > group.first; ) {
+                        const auto &entry = _entries[i];
+                        out << "// constraint " << entry.constraint_index << std::endl;
+                        if (i + 1 == group.second) {
+                            print_constraint(out, entry, "gate");
+                        } else {
+                            print_constraint(out, entry, "sum");
+                            out << "\t\tgate = addmod(mulmod(gate, theta, modulus), sum, modulus);" << std::endl;
+                        }
+                    }
+                    out << "\t\tgate = mulmod(gate, mulmod(theta_acc, " << operand(_entries[group.first].selector) << ", modulus), modulus);" << std::endl;
+                    out << "\t\tF = addmod(F, gate, modulus);" << std::endl;
+                    out << "\t\ttheta_acc = mulmod(theta_acc, " << theta_power_name(group.second - group.first) << ", modulus);" << std::endl;
+                }
+            }
+
+        private:
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+            /* Either a load of a blob word or a product of two nodes.
+             * The right operand of a product is always a load or a cached node,
+             * so uncached products are evaluated as left-deep chains in prod. */
+            struct node_type {
+                bool is_load;
+                std::size_t offset;
+                std::size_t left;
+                std::size_t right;
+                std::size_t uses;
+                bool forced;
+                std::size_t slot;
+            };
+
+            struct term_type {
+                std::size_t node;
+                value_type coeff;
+            };
+
+            struct constraint_entry {
+                std::size_t gate_index;
+                std::size_t constraint_index;
+                std::size_t selector_offset;
+                std::size_t selector;
+                bool opens_group = false;
+                value_type constant;
+                std::vector<term_type> terms;
+                std::size_t horner_var = npos;
+                std::vector<value_type> horner_coeffs;
+            };
+
+            // Univariate constraints with at least two terms are printed with Horner's formula
+            static bool is_univariate(const std::vector<std::pair<std::vector<std::size_t>, value_type>> &terms) {
+                if (terms.size() < 2) {
+                    return false;
+                }
+                std::size_t offset = terms[0].first[0];
+                for (const auto &term : terms) {
+                    for (auto o : term.first) {
+                        if (o != offset) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }
+
+            std::size_t load(std::size_t offset) {
+                auto it = _loads.find(offset);
+                if (it != _loads.end()) {
+                    return it->second;
+                }
+                _nodes.push_back({true, offset, npos, npos, 0, false, npos});
+                _loads[offset] = _nodes.size() - 1;
+                return _nodes.size() - 1;
+            }
+
+            std::size_t product(std::size_t left, std::size_t right) {
+                auto key = std::make_pair(left, right);
+                auto it = _products.find(key);
+                if (it != _products.end()) {
+                    return it->second;
+                }
+                if (!_nodes[right].is_load) {
+                    _nodes[right].forced = true;
+                }
+                _nodes.push_back({false, 0, left, right, 0, false, npos});
+                _products[key] = _nodes.size() - 1;
+                return _nodes.size() - 1;
+            }
+
+            std::size_t power(std::size_t base, std::size_t exponent) {
+                if (exponent == 1) {
+                    return base;
+                }
+                std::size_t half = power(base, exponent / 2);
+                std::size_t result = product(half, half);
+                return (exponent & 1) ? product(result, base) : result;
+            }
+
+            // Sorted offsets are grouped into powers; only powers >= 4 are worth square-and-multiply
+            std::size_t monomial(const std::vector<std::size_t> &offsets) {
+                std::size_t result = npos;
+                for (std::size_t i = 0; i < offsets.size(); ) {
+                    std::size_t j = i;
+                    while (j < offsets.size() && offsets[j] == offsets[i]) {
+                        ++j;
+                    }
+                    std::size_t base = load(offsets[i]);
+                    std::size_t exponent = j - i;
+                    if (_optimize_powers && exponent >= 4) {
+                        std::size_t factor = power(base, exponent);
+                        result = (result == npos) ? factor : product(result, factor);
+                    } else {
+                        for (std::size_t k = 0; k < exponent; ++k) {
+                            result = (result == npos) ? base : product(result, base);
+                        }
+                    }
+                    i = j;
+                }
+                return result;
+            }
+
+            // Children are counted once per node: a node is either evaluated once or cached
+            void use(std::size_t node) {
+                if (_nodes[node].uses++ == 0 && !_nodes[node].is_load) {
+                    use(_nodes[node].left);
+                    use(_nodes[node].right);
+                }
+            }
+
+            bool is_operand(std::size_t node) const {
+                return _nodes[node].is_load || _nodes[node].slot != npos;
+            }
+
+            std::string operand(std::size_t node) const {
+                if (_nodes[node].slot != npos) {
+                    return "cached[" + std::to_string(_nodes[node].slot) + "]";
+                }
+                return "basic_marshalling.get_uint256_be(blob, " + std::to_string(_nodes[node].offset) + ")";
+            }
+
+            void print_node(std::ostream &out, std::size_t node, const std::string &target) const {
+                const auto &n = _nodes[node];
+                if (n.is_load) {
+                    out << "\t\t" << target << " = basic_marshalling.get_uint256_be(blob, " << n.offset << ");" << std::endl;
+                } else if (is_operand(n.left)) {
+                    out << "\t\t" << target << " = mulmod(" << operand(n.left) << ", " << operand(n.right) << ", modulus);" << std::endl;
+                } else {
+                    print_node(out, n.left, "prod");
+                    out << "\t\t" << target << " = mulmod(prod, " << operand(n.right) << ", modulus);" << std::endl;
+                }
+            }
+
+            void plan_theta_power(std::size_t power, std::size_t &slots) {
+                if (power <= 1 || _theta_powers.count(power) > 0) {
+                    return;
+                }
+                plan_theta_power(power / 2, slots);
+                _theta_powers[power] = slots++;
+            }
+
+            std::string theta_power_name(std::size_t power) const {
+                if (power == 1) {
+                    return "theta";
+                }
+                return "cached[" + std::to_string(_theta_powers.at(power)) + "]";
+            }
+
+            static std::string scaled(const std::string &value, const value_type &coeff) {
+                if (coeff == value_type::one()) {
+                    return value;
+                }
+                if (coeff == -value_type::one()) {
+                    return "modulus - " + value;
+                }
+                std::stringstream result;
+                result << "mulmod(" << value << ", " << coeff << ", modulus)";
+                return result.str();
+            }
+
+            void print_constraint(std::ostream &out, const constraint_entry &entry, const std::string &target) const {
+                if (entry.horner_var != npos) {
+                    print_horner(out, entry, target);
+                    return;
+                }
+
+                bool first = true;
+                if (entry.constant != value_type::zero()) {
+                    out << "\t\t" << target << " = " << entry.constant << ";" << std::endl;
+                    first = false;
+                }
+                for (const auto &term : entry.terms) {
+                    std::string value;
+                    if (is_operand(term.node)) {
+                        value = operand(term.node);
+                    } else {
+                        print_node(out, term.node, "prod");
+                        value = "prod";
+                    }
+                    if (first) {
+                        out << "\t\t" << target << " = " << scaled(value, term.coeff) << ";" << std::endl;
+                        first = false;
+                    } else {
+                        out << "\t\t" << target << " = addmod(" << target << ", " << scaled(value, term.coeff) << ", modulus);" << std::endl;
+                    }
+                }
+                if (first) {
+                    out << "\t\t" << target << " = 0;" << std::endl;
+                }
+            }
+
+            void print_horner(std::ostream &out, const constraint_entry &entry, const std::string &target) const {
+                const auto &coeffs = entry.horner_coeffs;
+                std::size_t degree = coeffs.size() - 1;
+
+                out << "\t\t/* Constraint is a polynomial over one variable. Using Horner's formula */" << std::endl;
+                out << "\t\tx = " << operand(entry.horner_var) << ";" << std::endl;
+                out << "\t\t" << target << " = " << scaled("x", coeffs[degree]) << ";" << std::endl;
+                for (std::size_t k = degree; k-- > 0; ) {
+                    if (coeffs[k] != value_type::zero()) {
+                        out << "\t\t" << target << " = addmod(" << target << ", " << coeffs[k] << ", modulus);" << std::endl;
+                    }
+                    if (k > 0) {
+                        out << "\t\t" << target << " = mulmod(" << target << ", x, modulus);" << std::endl;
+                    }
+                }
+            }
+
+            const variable_indices_type &_var_indices;
+            bool _deduce_horner;
+            bool _optimize_powers;
+
+            std::vector<node_type> _nodes;
+            std::map<std::size_t, std::size_t> _loads;
+            std::map<std::pair<std::size_t, std::size_t>, std::size_t> _products;
+            std::vector<constraint_entry> _entries;
+            std::map<std::size_t, std::size_t> _theta_powers;
+        };
+    }    // namespace blueprint
+}    // namespace nil
+
+#endif    //__EVM_CONSTRAINT_EMITTER_HPP__
@@ -44,6 +44,7 @@
 #include <nil/blueprint/transpiler/templates/external_lookup.hpp>
 #include <nil/blueprint/transpiler/templates/utils_template.hpp>
 #include <nil/blueprint/transpiler/lpc_scheme_gen.hpp>
+#include <nil/blueprint/transpiler/evm_constraint_emitter.hpp>
 #include <nil/blueprint/transpiler/util.hpp>
 
 #include <nil/crypto3/hash/keccak.hpp>
@@ -447,53 +448,35 @@ namespace nil {
                 return result.str();
             }
 
+            using constraint_emitter_type = evm_constraint_series_emitter<typename PlaceholderParams::field_type>;
+
             struct constraint_info {
-                std::string code;
+                const constraint_type *constraint;
                 std::size_t cost;
                 std::size_t gate_index;
                 std::size_t constraint_index;
                 std::size_t selector_index;
             };
 
-            std::string print_constraint_series(typename std::vector<constraint_info>::iterator &it,
-                    typename std::vector<constraint_info>::iterator const& last) {
-                std::stringstream result;
+            /** @brief Prints constraints starting from it until the cost threshold is reached.
+             * Constraints of one series share loads, products and powers of theta.
+             * */
+            void print_constraint_series(typename std::vector<constraint_info>::iterator &it,
+                    typename std::vector<constraint_info>::iterator const& last,
+                    std::ostream &out) {
+                constraint_emitter_type emitter(_var_indices, _deduce_horner, _optimize_powers);
                 std::size_t printed_cost = 0;
-                std::size_t prev_sel = 0;
-
-                bool first_constraint = true;
 
                 while ((printed_cost <= _gates_contract_size_threshold) && (it != last) ) {
-
-                    if (first_constraint) {
-                        result << "// gate === " << it->gate_index << " ===" << std::endl;
-                        result << "\t\tgate = 0;" << std::endl;
-                        first_constraint = false;
-                        prev_sel = it->selector_index;
-                    } else if (prev_sel != it->selector_index) {
-                        result << "\t\tgate = mulmod(gate, basic_marshalling.get_uint256_be(blob, "<<prev_sel<<"), modulus);" << std::endl;
-                        result << "\t\tF = addmod(F, gate, modulus);" << std::endl;
-                        result << "// gate === " << it->gate_index << " ===" << std::endl;
-                        result << "\t\tgate = 0;" << std::endl;
-                        prev_sel = it->selector_index;
-                    }
-                    result << "// constraint " << it->constraint_index << std::endl;
-                    result << it->code;
-                    result << "\t\tsum = mulmod(sum, theta_acc, modulus);" << std::endl;
-                    result << "\t\ttheta_acc = mulmod(theta, theta_acc, modulus);" << std::endl;
-                    result << "\t\tgate = addmod(gate, sum, modulus);" << std::endl;
-
+                    emitter.add_constraint(it->gate_index, it->constraint_index, it->selector_index, *it->constraint);
                     printed_cost += it->cost;
                     ++it;
                 }
 
+                emitter.print(out);
                 if (it != last) {
-                    result << "// gate computation code ended prematurely. continue in next library" << std::endl;
+                    out << "// gate computation code ended prematurely. continue in next library" << std::endl;
                 }
-                result << "\t\tgate = mulmod(gate, basic_marshalling.get_uint256_be(blob, "<<prev_sel<<"), modulus);" << std::endl;
-                result << "\t\tF = addmod(F, gate, modulus);" << std::endl;
-
-                return result.str();
             }
 
             std::string print_gate_argument(){
@@ -515,11 +498,14 @@ namespace nil {
                     variable_type sel_var(gate.selector_index, 0, true, variable_type::column_type::selector);
                     std::size_t j = 0;
                     for (const auto& constraint: gate.constraints) {
-                        std::string code = constraint_computation_code_optimized(_var_indices, constraint);
-                        std::size_t cost = estimate_constraint_cost(code);
                         std::size_t selector_index = _var_indices.at(sel_var)*0x20;
+                        std::stringstream code;
+                        constraint_emitter_type emitter(_var_indices, _deduce_horner, _optimize_powers);
+                        emitter.add_constraint(i, j, selector_index, constraint);
+                        emitter.print(code);
+                        std::size_t cost = estimate_constraint_cost(code.str());
 
-                        constraints.push_back( {code, cost, i, j, selector_index} );
+                        constraints.push_back( {&constraint, cost, i, j, selector_index} );
 
                         total_cost += cost;
                         ++j;
@@ -535,23 +521,26 @@ namespace nil {
                     gate_argument_str << "\t\tuint256 prod;" << std::endl;
                     gate_argument_str << "\t\tuint256 sum;" << std::endl;
                     gate_argument_str << "\t\tuint256 gate;" << std::endl;
-                    gate_argument_str << print_constraint_series(it, constraints.end());
+                    print_constraint_series(it, constraints.end(), gate_argument_str);
                 } else {
+                    const std::string &library_template = modular_external_gate_library_template;
+                    std::size_t code_pos = library_template.find("$CONSTRAINT_SERIES_CODE$");
+                    std::string library_head = library_template.substr(0, code_pos);
+                    std::string library_tail = library_template.substr(code_pos + std::string("$CONSTRAINT_SERIES_CODE$").size());
+
                     auto it = constraints.begin();
                     while (it != constraints.end()) {
-                        std::string code = print_constraint_series(it, constraints.end());
-
-                        std::string result = modular_external_gate_library_template;
-                        boost::replace_all(result, "$TEST_NAME$", _test_name);
-                        boost::replace_all(result, "$GATE_LIB_ID$", to_string(gate_modules_count));
-                        boost::replace_all(result, "$CONSTRAINT_SERIES_CODE$", code);
-                        boost::replace_all(result, "$MODULUS$", to_string(PlaceholderParams::field_type::modulus));
-                        boost::replace_all(result, "$UTILS_LIBRARY_IMPORT$", _term_powers.size() >0? "import \"./utils.sol\";" : "");
-
+                        transpiler_replacements library_reps;
+                        library_reps["$TEST_NAME$"] = _test_name;
+                        library_reps["$GATE_LIB_ID$"] = to_string(gate_modules_count);
+                        library_reps["$MODULUS$"] = to_string(PlaceholderParams::field_type::modulus);
+                        library_reps["$UTILS_LIBRARY_IMPORT$"] = _term_powers.size() >0? "import \"./utils.sol\";" : "";
 
                         std::ofstream out;
                         out.open(_folder_name + "/gate_" + to_string(gate_modules_count) + ".sol");
-                        out << result;
+                        print_replaced(out, library_head, library_reps);
+                        print_constraint_series(it, constraints.end(), out);
+                        print_replaced(out, library_tail, library_reps);
                         out.close();
                         _gate_includes += "import \"./gate_" + to_string(gate_modules_count) + ".sol\";\n";
 
@@ -31,6 +31,7 @@
 #include <sstream>
 #include <filesystem>
 #include <iostream>
+#include <map>
 //#include <boost/algorithm/string.hpp>
 
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/profiling.hpp>
@@ -74,18 +75,39 @@ namespace nil {
             return "";
         }
 
-        void replace_and_print(std::string input, transpiler_replacements reps, std::string output_file_name){
-            std::string code = input;
+        /** @brief Streams input to out substituting $KEY$ placeholders in a single pass.
+         * Placeholders inside substituted values are expanded up to depth levels deep,
+         * which matches the two replace_all passes used for templates before.
+         * */
+        static inline void print_replaced(std::ostream &out, const std::string &input, const transpiler_replacements &reps, std::size_t depth = 2){
+            std::size_t pos = 0;
+            while( pos < input.size() ){
+                std::size_t begin = input.find('$', pos);
+                if( begin == std::string::npos ) break;
+                std::size_t end = input.find('$', begin + 1);
+                if( end == std::string::npos ) break;
 
-            for(const auto&[k,v]: reps){
-                boost::replace_all(code, k, v);
-            }
-            for(const auto&[k,v]: reps){
-                boost::replace_all(code, k, v);
+                auto it = reps.find(input.substr(begin, end - begin + 1));
+                if( it == reps.end() ){
+                    out.write(input.data() + pos, begin + 1 - pos);
+                    pos = begin + 1;
+                    continue;
+                }
+                out.write(input.data() + pos, begin - pos);
+                if( depth > 1 ){
+                    print_replaced(out, it->second, reps, depth - 1);
+                } else {
+                    out << it->second;
+                }
+                pos = end + 1;
             }
+            out.write(input.data() + pos, input.size() - pos);
+        }
+
+        void replace_and_print(std::string input, transpiler_replacements reps, std::string output_file_name){
             std::ofstream out;
             out.open(output_file_name);
-            out << code;
+            print_replaced(out, input, reps);
             out.close();
         }
 
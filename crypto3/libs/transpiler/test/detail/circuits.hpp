@@ -182,7 +182,8 @@ namespace nil {
                         plonk_public_assignment_table<FieldType>(
                             public_input_assignment, constant_assignment, selectors_assignment));
 
-                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, alg_rnd);
+                    nil::crypto3::random::chacha_field_engine<FieldType> padding_rnd(rnd());
+                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, padding_rnd);
 
                     plonk_variable<assignment_type> w0(0, 0, true, plonk_variable<assignment_type>::column_type::witness);
                     plonk_variable<assignment_type> w1(1, 0, true, plonk_variable<assignment_type>::column_type::witness);
@@ -320,7 +321,8 @@ namespace nil {
                         plonk_private_assignment_table<FieldType>(private_assignment),
                         plonk_public_assignment_table<FieldType>(
                             public_input_assignment, constant_assignment, selectors_assignment));
-                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, alg_rnd);
+                    nil::crypto3::random::chacha_field_engine<FieldType> padding_rnd(rnd());
+                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, padding_rnd);
 
                     plonk_variable<assignment_type> w0(0, 0, true,
                                                  plonk_variable<assignment_type>::column_type::witness);
@@ -418,7 +420,8 @@ namespace nil {
                         plonk_private_assignment_table<FieldType>(private_assignment),
                         plonk_public_assignment_table<FieldType>(
                             public_input_assignment, constant_assignment, selectors_assignment));
-                    test_circuit.table_rows = zk_padding(test_circuit.table, alg_rnd);
+                    nil::crypto3::random::chacha_field_engine<FieldType> padding_rnd(rnd());
+                    test_circuit.table_rows = zk_padding(test_circuit.table, padding_rnd);
 
                     plonk_variable<assignment_type> w0(0, 0, true,  plonk_variable<assignment_type>::column_type::witness);
                     plonk_variable<assignment_type> w1(1, 0, true,  plonk_variable<assignment_type>::column_type::witness);
@@ -620,7 +623,8 @@ namespace nil {
                         plonk_private_assignment_table<FieldType>(private_assignment),
                         plonk_public_assignment_table<FieldType>(
                             public_input_assignment, constant_assignment, selectors_assignment));
-                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, alg_rnd);
+                    nil::crypto3::random::chacha_field_engine<FieldType> padding_rnd(rnd());
+                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, padding_rnd);
 
                     std::vector<plonk_constraint<FieldType>> mul_gate_constraints;
                     for( std::size_t i = 0; i < witness_columns; i++){
@@ -656,7 +660,8 @@ namespace nil {
                 template<typename FieldType, std::size_t usable_rows>
                 circuit_description<FieldType, placeholder_circuit_params<FieldType>, usable_rows>
                 circuit_test_fib(
-                    typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd = nil::crypto3::random::algebraic_engine<FieldType>()
+                    typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd = nil::crypto3::random::algebraic_engine<FieldType>(),
+                    boost::random::mt11213b rnd = boost::random::mt11213b()
                 ) {
                     using assignment_type = typename FieldType::value_type;
 
@@ -723,7 +728,8 @@ namespace nil {
                         plonk_private_assignment_table<FieldType>(private_assignment),
                         plonk_public_assignment_table<FieldType>(
                             public_input_assignment, constant_assignment, selectors_assignment));
-                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, alg_rnd);
+                    nil::crypto3::random::chacha_field_engine<FieldType> padding_rnd(rnd());
+                    test_circuit.table_rows = zk_padding<FieldType, plonk_column<FieldType>>(test_circuit.table, padding_rnd);
 
                     plonk_variable<assignment_type> w0(0, -1, true, plonk_variable<assignment_type>::column_type::witness);
                     plonk_variable<assignment_type> w1(0, 0, true, plonk_variable<assignment_type>::column_type::witness);
@@ -829,7 +835,8 @@ namespace nil {
                         plonk_private_assignment_table<FieldType>(private_assignment),
                         plonk_public_assignment_table<FieldType>(
                             public_input_assignment, constant_assignment, selectors_assignment));
-                    test_circuit.table_rows = zk_padding(test_circuit.table, alg_rnd);
+                    nil::crypto3::random::chacha_field_engine<FieldType> padding_rnd(rnd());
+                    test_circuit.table_rows = zk_padding(test_circuit.table, padding_rnd);
 
                     plonk_variable<assignment_type> w0(  0, 0, true, plonk_variable<assignment_type>::column_type::witness);
                     plonk_variable<assignment_type> w0_1(0,-1, true, plonk_variable<assignment_type>::column_type::witness);
@@ -980,7 +987,8 @@ namespace nil {
                         plonk_private_assignment_table<FieldType>(private_assignment),
                         plonk_public_assignment_table<FieldType>(
                             public_input_assignment, constant_assignment, selectors_assignment));
-                    test_circuit.table_rows = zk_padding(test_circuit.table, alg_rnd);
+                    nil::crypto3::random::chacha_field_engine<FieldType> padding_rnd(rnd());
+                    test_circuit.table_rows = zk_padding(test_circuit.table, padding_rnd);
 
                     plonk_variable<assignment_type> w0(  0, 0, true, plonk_variable<assignment_type>::column_type::witness);
                     plonk_variable<assignment_type> w0__7(0,-7, true, plonk_variable<assignment_type>::column_type::witness);
@@ -0,0 +1,370 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE evm_constraint_emitter_test
+
+#include <cctype>
+#include <cstddef>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+
+#include <nil/blueprint/transpiler/evm_constraint_emitter.hpp>
+
+// *******************************************************************************
+// * The emitted Solidity is run by a small interpreter which understands exactly
+// * the statements the emitter prints. Gas is estimated with a static schedule,
+// * there is no EVM in the test environment.
+// *******************************************************************************/
+
+using namespace nil;
+using namespace nil::crypto3;
+
+namespace test_tools {
+    struct gas_schedule {
+        static constexpr std::size_t modular_op = 8;          // mulmod, addmod
+        static constexpr std::size_t blob_load = 42;          // internal call + calldataload
+        static constexpr std::size_t memory_access = 9;       // mload/mstore + offset arithmetic
+        static constexpr std::size_t stack_op = 3;            // assignment to a local, sub
+    };
+
+    template<typename FieldType>
+    class evm_code_interpreter {
+    public:
+        using value_type = typename FieldType::value_type;
+        using integral_type = typename FieldType::integral_type;
+
+        std::map<std::string, value_type> locals;
+        std::vector<value_type> cached;
+        std::size_t gas = 0;
+
+        explicit evm_code_interpreter(const std::vector<value_type> &blob) : _blob(blob) {
+        }
+
+        void run(const std::string &code) {
+            std::istringstream lines(code);
+            std::string line;
+            while (std::getline(lines, line)) {
+                _line = line;
+                _pos = 0;
+                skip_spaces();
+                if (_pos == _line.size() || _line.compare(_pos, 2, "//") == 0 || _line.compare(_pos, 2, "/*") == 0) {
+                    continue;
+                }
+                if (_line.compare(_pos, 8, "uint256[") == 0) {
+                    _pos += 8;
+                    cached.assign(std::stoul(_line.substr(_pos)), value_type::zero());
+                    continue;
+                }
+                std::string target = identifier();
+                std::size_t slot = cached.size();
+                if (target == "cached") {
+                    slot = index();
+                }
+                expect('=');
+                value_type value = expression();
+                expect(';');
+                if (slot != cached.size()) {
+                    BOOST_REQUIRE(slot < cached.size());
+                    cached[slot] = value;
+                    gas += gas_schedule::memory_access;
+                } else {
+                    locals[target] = value;
+                    gas += gas_schedule::stack_op;
+                }
+            }
+        }
+
+    private:
+        void skip_spaces() {
+            while (_pos < _line.size() && std::isspace(static_cast<unsigned char>(_line[_pos]))) {
+                ++_pos;
+            }
+        }
+
+        void expect(char c) {
+            skip_spaces();
+            BOOST_REQUIRE_MESSAGE(_pos < _line.size() && _line[_pos] == c, "unexpected statement: " << _line);
+            ++_pos;
+        }
+
+        std::string identifier() {
+            skip_spaces();
+            std::size_t begin = _pos;
+            while (_pos < _line.size() && (std::isalnum(static_cast<unsigned char>(_line[_pos])) || _line[_pos] == '_' || _line[_pos] == '.')) {
+                ++_pos;
+            }
+            BOOST_REQUIRE_MESSAGE(_pos > begin, "identifier expected: " << _line);
+            return _line.substr(begin, _pos - begin);
+        }
+
+        std::size_t index() {
+            expect('[');
+            std::size_t result = std::stoul(identifier());
+            expect(']');
+            return result;
+        }
+
+        value_type expression() {
+            value_type result = primary();
+            skip_spaces();
+            if (_pos < _line.size() && _line[_pos] == '-') {
+                ++_pos;
+                result -= primary();
+                gas += gas_schedule::stack_op;
+            }
+            return result;
+        }
+
+        value_type primary() {
+            std::string name = identifier();
+            if (std::isdigit(static_cast<unsigned char>(name[0]))) {
+                return value_type(integral_type(name));
+            }
+            if (name == "modulus") {
+                return value_type::zero();
+            }
+            if (name == "cached") {
+                std::size_t slot = index();
+                BOOST_REQUIRE(slot < cached.size());
+                gas += gas_schedule::memory_access;
+                return cached[slot];
+            }
+            skip_spaces();
+            if (_pos == _line.size() || _line[_pos] != '(') {
+                BOOST_REQUIRE_MESSAGE(locals.count(name) > 0, "unknown local " << name);
+                return locals.at(name);
+            }
+            expect('(');
+            if (name == "basic_marshalling.get_uint256_be") {
+                BOOST_CHECK_EQUAL(identifier(), "blob");
+                expect(',');
+                std::size_t offset = std::stoul(identifier());
+                expect(')');
+                BOOST_REQUIRE(offset % 0x20 == 0 && offset / 0x20 < _blob.size());
+                gas += gas_schedule::blob_load;
+                return _blob[offset / 0x20];
+            }
+            BOOST_REQUIRE_MESSAGE(name == "mulmod" || name == "addmod", "unknown function " << name);
+            value_type left = expression();
+            expect(',');
+            value_type right = expression();
+            expect(',');
+            BOOST_CHECK_EQUAL(identifier(), "modulus");
+            expect(')');
+            gas += gas_schedule::modular_op;
+            return name == "mulmod" ? left * right : left + right;
+        }
+
+        const std::vector<value_type> &_blob;
+        std::string _line;
+        std::size_t _pos = 0;
+    };
+
+    // Straightforward code in the shape printed before the emitter: every term
+    // is multiplied out from blob loads, theta_acc advances once per constraint.
+    template<typename FieldType>
+    std::string print_naive_series(
+        const std::map<zk::snark::plonk_variable<typename FieldType::value_type>, std::size_t> &var_indices,
+        const std::vector<std::pair<std::size_t, zk::snark::plonk_constraint<FieldType>>> &constraints
+    ) {
+        using variable_type = zk::snark::plonk_variable<typename FieldType::value_type>;
+        std::stringstream out;
+        std::size_t prev_sel = constraints[0].first;
+        out << "gate = 0;" << std::endl;
+        for (const auto &[sel, constraint] : constraints) {
+            if (sel != prev_sel) {
+                out << "gate = mulmod(gate, basic_marshalling.get_uint256_be(blob, " << prev_sel << "), modulus);" << std::endl;
+                out << "F = addmod(F, gate, modulus);" << std::endl;
+                out << "gate = 0;" << std::endl;
+                prev_sel = sel;
+            }
+            math::expression_to_non_linear_combination_visitor<variable_type> visitor;
+            auto comb = visitor.convert(constraint);
+            out << "sum = 0;" << std::endl;
+            for (auto it = std::cbegin(comb); it != std::cend(comb); ++it) {
+                out << "prod = " << it->get_coeff() << ";" << std::endl;
+                for (const auto &var : it->get_vars()) {
+                    out << "prod = mulmod(prod, basic_marshalling.get_uint256_be(blob, " << var_indices.at(var) * 0x20 << "), modulus);" << std::endl;
+                }
+                out << "sum = addmod(sum, prod, modulus);" << std::endl;
+            }
+            out << "sum = mulmod(sum, theta_acc, modulus);" << std::endl;
+            out << "theta_acc = mulmod(theta, theta_acc, modulus);" << std::endl;
+            out << "gate = addmod(gate, sum, modulus);" << std::endl;
+        }
+        out << "gate = mulmod(gate, basic_marshalling.get_uint256_be(blob, " << prev_sel << "), modulus);" << std::endl;
+        out << "F = addmod(F, gate, modulus);" << std::endl;
+        return out.str();
+    }
+}    // namespace test_tools
+
+struct emitter_fixture {
+    using field_type = typename algebra::curves::pallas::base_field_type;
+    using value_type = typename field_type::value_type;
+    using variable_type = zk::snark::plonk_variable<value_type>;
+    using constraint_type = zk::snark::plonk_constraint<field_type>;
+    using emitter_type = blueprint::evm_constraint_series_emitter<field_type>;
+
+    std::map<variable_type, std::size_t> var_indices;
+    std::vector<std::pair<std::size_t, constraint_type>> constraints;
+    std::vector<value_type> blob;
+    value_type theta;
+    value_type theta_acc;
+
+    emitter_fixture() {
+        random::algebraic_engine<field_type> rnd(0x5eed);
+
+        std::vector<variable_type> w;
+        for (std::size_t i = 0; i < 5; i++) {
+            w.emplace_back(i, 0, true, variable_type::column_type::witness);
+            var_indices[w.back()] = i;
+        }
+        variable_type w0_next(0, 1, true, variable_type::column_type::witness);
+        var_indices[w0_next] = 5;
+        variable_type s0(0, 0, true, variable_type::column_type::selector);
+        variable_type s1(1, 0, true, variable_type::column_type::selector);
+        var_indices[s0] = 6;
+        var_indices[s1] = 7;
+        std::size_t s0_offset = 6 * 0x20;
+        std::size_t s1_offset = 7 * 0x20;
+
+        constraints.emplace_back(s0_offset, w[0] * w[1] - w[2]);
+        constraints.emplace_back(s0_offset, w[0] * w[1] * w[3] + 3 * w[2] - 1);
+        constraints.emplace_back(s0_offset, w[0].pow(5) - w[4]);
+        constraints.emplace_back(s0_offset, 2 * w[0] * w[0] + 3 * w[0] + 7);
+        constraints.emplace_back(s0_offset, w[3] - w[3]);
+        constraints.emplace_back(s1_offset, w[0] * w[1] + w[4] * w[4] * w[4] - w0_next);
+        constraints.emplace_back(s1_offset, w[3].pow(6) * w[4] - w[3]);
+        constraints.emplace_back(s0_offset, w[2] * (w[0] * w[1] - w0_next));
+
+        for (std::size_t i = 0; i < var_indices.size(); i++) {
+            blob.push_back(rnd());
+        }
+        theta = rnd();
+        theta_acc = rnd();
+    }
+
+    // F and theta_acc after the series, computed from the constraints directly
+    std::pair<value_type, value_type> expected(std::size_t begin, std::size_t end, value_type acc) const {
+        value_type F = value_type::zero();
+        for (std::size_t i = begin; i < end; i++) {
+            math::expression_evaluator<variable_type> evaluator(
+                constraints[i].second,
+                [this](const variable_type &var) -> const value_type & { return blob[var_indices.at(var)]; });
+            F += evaluator.evaluate() * acc * blob[constraints[i].first / 0x20];
+            acc *= theta;
+        }
+        return {F, acc};
+    }
+
+    std::string emit(std::size_t begin, std::size_t end, bool deduce_horner = true, bool optimize_powers = true) const {
+        emitter_type emitter(var_indices, deduce_horner, optimize_powers);
+        for (std::size_t i = begin; i < end; i++) {
+            emitter.add_constraint(0, i, constraints[i].first, constraints[i].second);
+        }
+        std::stringstream out;
+        emitter.print(out);
+        return out.str();
+    }
+
+    test_tools::evm_code_interpreter<field_type> run(const std::string &code, value_type acc) const {
+        test_tools::evm_code_interpreter<field_type> interpreter(blob);
+        interpreter.locals["theta"] = theta;
+        interpreter.locals["theta_acc"] = acc;
+        interpreter.locals["F"] = value_type::zero();
+        interpreter.run(code);
+        return interpreter;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(evm_constraint_emitter_suite, emitter_fixture)
+
+BOOST_AUTO_TEST_CASE(emitted_code_matches_constraints) {
+    for (bool deduce_horner : {false, true}) {
+        for (bool optimize_powers : {false, true}) {
+            auto interpreter = run(emit(0, constraints.size(), deduce_horner, optimize_powers), theta_acc);
+            auto [F, acc] = expected(0, constraints.size(), theta_acc);
+            BOOST_CHECK(interpreter.locals.at("F") == F);
+            BOOST_CHECK(interpreter.locals.at("theta_acc") == acc);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(split_series_chain_theta_acc) {
+    // Libraries return F and theta_acc, the caller accumulates F
+    value_type F = value_type::zero();
+    value_type acc = theta_acc;
+    for (auto [begin, end] : {std::make_pair(0, 3), std::make_pair(3, 6), std::make_pair(6, 8)}) {
+        auto interpreter = run(emit(begin, end), acc);
+        F += interpreter.locals.at("F");
+        acc = interpreter.locals.at("theta_acc");
+    }
+    auto expected_values = expected(0, constraints.size(), theta_acc);
+    BOOST_CHECK(F == expected_values.first);
+    BOOST_CHECK(acc == expected_values.second);
+}
+
+BOOST_AUTO_TEST_CASE(gas_does_not_regress) {
+    auto naive = run(test_tools::print_naive_series(var_indices, constraints), theta_acc);
+    auto emitted = run(emit(0, constraints.size()), theta_acc);
+
+    BOOST_CHECK(naive.locals.at("F") == emitted.locals.at("F"));
+    BOOST_TEST_MESSAGE("naive series gas: " << naive.gas << ", emitted series gas: " << emitted.gas);
+    BOOST_CHECK_LT(emitted.gas, naive.gas);
+
+    for (std::size_t i = 0; i < constraints.size(); i++) {
+        auto single_naive = run(test_tools::print_naive_series(var_indices, decltype(constraints){constraints[i]}), theta_acc);
+        auto single_emitted = run(emit(i, i + 1), theta_acc);
+        BOOST_CHECK(single_naive.locals.at("F") == single_emitted.locals.at("F"));
+        BOOST_CHECK_LE(single_emitted.gas, single_naive.gas);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(shared_values_are_cached) {
+    std::string code = emit(0, constraints.size());
+
+    // Every blob word is loaded at most once per series
+    for (std::size_t i = 0; i < var_indices.size(); i++) {
+        std::string load = "basic_marshalling.get_uint256_be(blob, " + std::to_string(i * 0x20) + ")";
+        std::size_t first = code.find(load);
+        BOOST_CHECK(first == std::string::npos || code.find(load, first + 1) == std::string::npos);
+    }
+    BOOST_CHECK(code.find("memory cached;") != std::string::npos);
+    // w3 - w3 is the last constraint of the first gate and folds to zero
+    BOOST_CHECK(code.find("// constraint 4\n\t\tgate = 0;") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -40,6 +40,7 @@
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/eval_storage.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/spilled_polynomials.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -77,6 +78,13 @@ namespace nil {
 
                     std::map<std::size_t, std::vector<std::vector<value_type>>> _points;
 
+                    // Committed batches moved out of memory, _polys keeps an empty vector for each of them.
+                    // Copies of the evaluator share the scratch files, batches are read back with get_batch.
+                    std::map<std::size_t, std::shared_ptr<detail::spilled_polynomials<polynomial_type>>> _spilled;
+
+                    // Budget of the prover which owns the evaluator, committed batches are not spilled without it.
+                    std::shared_ptr<detail::memory_budget> _memory_budget;
+
                     bool operator==(const polys_evaluator& other) const {
                         return _z == other._z && _polys == other._polys &&
                             _locked == other._locked && _points == other._points;
@@ -105,7 +113,97 @@ namespace nil {
                     // polynomials.
                     void state_commited(std::size_t index) {
                         _locked[index] = true;
-                        _points[index].resize(_polys[index].size());
+                        _points[index].resize(get_batch_size(index));
+                    }
+
+                    // Number of polynomials in the batch, including the batches moved out of memory.
+                    std::size_t get_batch_size(std::size_t index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return it->second->size();
+                        }
+                        auto polys_it = _polys.find(index);
+                        return polys_it == _polys.end() ? 0 : polys_it->second.size();
+                    }
+
+                    // Number of values of polynomial 'poly_index' of the batch, the batch is not loaded if it was spilled.
+                    std::size_t get_poly_size(std::size_t index, std::size_t poly_index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return it->second->size(poly_index);
+                        }
+                        return _polys.at(index)[poly_index].size();
+                    }
+
+                    // Degree of polynomial 'poly_index' of the batch, the batch is not loaded if it was spilled.
+                    std::size_t get_poly_degree(std::size_t index, std::size_t poly_index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return it->second->degree(poly_index);
+                        }
+                        return _polys.at(index)[poly_index].degree();
+                    }
+
+                    /**
+                     * Returns the polynomials of a batch. A batch in memory is returned without copying, a spilled
+                     * batch is read back from its scratch file and freed when the last pointer to it is released,
+                     * so callers going over the batches one by one hold at most one spilled batch in memory.
+                     */
+                    std::shared_ptr<const std::vector<polynomial_type>> get_batch(std::size_t index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return std::make_shared<const std::vector<polynomial_type>>(it->second->load());
+                        }
+                        return std::shared_ptr<const std::vector<polynomial_type>>(std::shared_ptr<void>(), &_polys.at(index));
+                    }
+
+                    void set_memory_budget(std::shared_ptr<detail::memory_budget> budget) {
+                        _memory_budget = std::move(budget);
+                    }
+
+                    const std::shared_ptr<detail::memory_budget>& get_memory_budget() const {
+                        return _memory_budget;
+                    }
+
+                    // Moves a committed batch to a scratch file of the memory budget. Does nothing without a budget
+                    // or if the file can't be created.
+                    void spill_batch(std::size_t index) {
+                        if (!_memory_budget || _spilled.find(index) != _spilled.end() || _polys.find(index) == _polys.end())
+                            return;
+                        BOOST_ASSERT(_locked[index]);
+
+                        auto spilled = detail::spilled_polynomials<polynomial_type>::spill(
+                            _polys[index], _memory_budget->scratch_directory());
+                        if (spilled) {
+                            _spilled[index] = std::move(spilled);
+                        }
+                    }
+
+                    // Spills all the committed batches still in memory if the process is over the memory budget.
+                    // Batches committed while there was enough memory, e.g. the witness, are spilled as well.
+                    void spill_committed_batches_over_budget() {
+                        if (!_memory_budget || !_memory_budget->exceeded())
+                            return;
+                        for (const auto& [index, locked]: _locked) {
+                            if (locked) {
+                                spill_batch(index);
+                            }
+                        }
+                    }
+
+                    void load_spilled_batch(std::size_t index) {
+                        auto it = _spilled.find(index);
+                        if (it == _spilled.end())
+                            return;
+                        _polys[index] = it->second->load();
+                        _spilled.erase(it);
+                    }
+
+                    // Must be called before _polys is accessed directly, e.g. from marshalling.
+                    void load_spilled_batches() {
+                        while (!_spilled.empty()) {
+                            load_spilled_batch(_spilled.begin()->first);
+                        }
                     }
 
                 protected:
@@ -205,8 +303,11 @@ namespace nil {
                         return eval_map;
                     }
 
+                    // Spilled batches are read back one at a time.
                     void eval_polys() {
-                        for(auto const &[k, poly] : _polys) {
+                        for(auto const &[k, stored_poly] : _polys) {
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = get_batch(k);
+                            const std::vector<polynomial_type>& poly = *batch;
                             _z.set_batch_size(k, poly.size());
                             auto const &point = _points.at(k);
 
@@ -33,6 +33,7 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <map>
@@ -772,131 +773,85 @@ namespace nil {
                     return std::make_tuple(fs, fri_trees, commitments_proof);
                 }
 
-                /** @brief Convert a set of polynomials from DFS form into coefficients form */
-                template<typename FRI, typename PolynomialType>
-                static std::map<
-                    std::size_t,
-                    std::vector<math::polynomial<typename FRI::field_type::value_type>>
-                >  convert_polynomials_to_coefficients(
-                    const typename FRI::params_type &fri_params,
+                /** @brief Returns the committed batch with the given index. Batches are requested one at a time,
+                 *  so a loader can read spilled batches back from disk and release them after use.
+                 */
+                template<typename PolynomialType>
+                using polynomial_batch_loader =
+                    std::function<std::shared_ptr<const std::vector<PolynomialType>>(std::size_t)>;
+
+                // Loader over batches that are all in memory, the returned pointers don't own the batches.
+                template<typename PolynomialType>
+                static polynomial_batch_loader<PolynomialType> make_polynomial_batch_loader(
                     const std::map<std::size_t, std::vector<PolynomialType>> &g)
                 {
-                    std::map<
-                        std::size_t,
-                        std::vector<math::polynomial<typename FRI::field_type::value_type>>
-                    > g_coeffs;
-
-                    if constexpr (std::is_same<
-                        math::polynomial_dfs<typename FRI::field_type::value_type>,
-                        PolynomialType>::value
-                    ) {
-                        std::unordered_map<std::size_t,
-                                           std::shared_ptr<math::evaluation_domain<typename FRI::field_type>>> d_cache;
-                        for (const auto &[key, poly_vector]: g) {
-                            for (const auto& poly: poly_vector) {
-                                if (poly.size() != fri_params.D[0]->size()) {
-                                    if (d_cache.find(poly.size()) == d_cache.end()) {
-                                        d_cache[poly.size()] =
-                                            math::make_evaluation_domain<typename FRI::field_type>(poly.size());
-                                    }
-                                    g_coeffs[key].emplace_back(poly.coefficients(d_cache[poly.size()]));
-                                } else {
-                                    // These polynomials won't be used
-                                    g_coeffs[key].emplace_back(math::polynomial<typename FRI::field_type::value_type>());
-                                }
-                            }
-                        }
-                    }
-
-                    return std::move(g_coeffs);
+                    return [&g](std::size_t index) {
+                        return std::shared_ptr<const std::vector<PolynomialType>>(std::shared_ptr<void>(), &g.at(index));
+                    };
                 }
 
-
+                /** @brief Fills the values of batch 'k' in the initial proofs of all the queries. A DFS polynomial
+                 *  on a smaller domain than D[0] is converted to coefficients form, evaluated in all the queried
+                 *  points and dropped, so only one polynomial of the batch is converted at a time.
+                 */
                 template<typename FRI, typename PolynomialType>
-                static std::map<std::size_t, typename FRI::initial_proof_type>
-                build_initial_proof(
-                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                static void fill_initial_proof_values(
+                    typename FRI::initial_proofs_batch_type &proof,
+                    std::size_t k,
+                    const std::vector<PolynomialType> &g_k,
                     const typename FRI::params_type &fri_params,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
-                    const std::map<
-                        std::size_t,
-                        std::vector<math::polynomial<typename FRI::field_type::value_type>>
-                    > &g_coeffs,
-                    std::uint64_t x_index)
+                    const std::vector<std::vector<std::array<typename FRI::field_type::value_type, FRI::m>>> &s,
+                    const std::vector<std::vector<std::array<std::size_t, FRI::m>>> &s_indices)
                 {
-                    std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
-                    std::vector<std::array<std::size_t, FRI::m>> s_indices;
-                    std::tie(s, s_indices) = calculate_s<FRI>(x_index, fri_params.step_list[0], fri_params.D[0]);
+                    using value_type = typename FRI::field_type::value_type;
+                    const std::size_t coset_size = 1 << fri_params.step_list[0];
 
-                    std::map<std::size_t, typename FRI::initial_proof_type> initial_proof;
+                    for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                        auto &initial_proof = proof.initial_proofs[query_id][k];
+                        initial_proof.values.resize(g_k.size());
+                        for (auto &poly_values: initial_proof.values) {
+                            poly_values.resize(coset_size / FRI::m);
+                        }
+                    }
 
-                    for (const auto &it: g) {
-                        auto k = it.first;
-                        initial_proof[k] = {};
-                        initial_proof[k].values.resize(it.second.size());
-                        std::size_t coset_size = 1 << fri_params.step_list[0];
-                        BOOST_ASSERT(coset_size / FRI::m == s.size());
-                        BOOST_ASSERT(coset_size / FRI::m == s_indices.size());
-
-                        // Fill values
-                        const auto& g_k = it.second; // g[k]
-
-                        for (std::size_t polynomial_index = 0; polynomial_index < g_k.size(); ++polynomial_index) {
-                            initial_proof[k].values[polynomial_index].resize(coset_size / FRI::m);
-                            if constexpr (std::is_same<
-                                    math::polynomial_dfs<typename FRI::field_type::value_type>,
-                                    PolynomialType>::value
-                        ) {
-                                if (g_k[polynomial_index].size() == fri_params.D[0]->size()) {
-                                    for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
-                                        std::size_t ind0 = std::min(s_indices[j][0], s_indices[j][1]);
-                                        std::size_t ind1 = std::max(s_indices[j][0], s_indices[j][1]);
-                                        initial_proof[k].values[polynomial_index][j][0] = g_k[polynomial_index][ind0];
-                                        initial_proof[k].values[polynomial_index][j][1] = g_k[polynomial_index][ind1];
-                                    }
-                                } else {
-                                    // Convert to coefficients form and evaluate. coset_size / FRI::m is usually just 1,
-                                    // It makes no sense to resize in dfs form to then use just 2 values in 2 points.
+                    std::unordered_map<std::size_t, std::shared_ptr<math::evaluation_domain<typename FRI::field_type>>> d_cache;
+
+                    for (std::size_t polynomial_index = 0; polynomial_index < g_k.size(); ++polynomial_index) {
+                        const auto& poly = g_k[polynomial_index];
+
+                        auto fill_evaluations = [&](const auto& poly_coeffs) {
+                            for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                                auto &values = proof.initial_proofs[query_id].at(k).values[polynomial_index];
+                                for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
+                                    bool ordered = s_indices[query_id][j][0] < s_indices[query_id][j][1];
+                                    values[j][0] = poly_coeffs.evaluate(s[query_id][j][ordered ? 0 : 1]);
+                                    values[j][1] = poly_coeffs.evaluate(s[query_id][j][ordered ? 1 : 0]);
+                                }
+                            }
+                        };
+
+                        if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
+                            if (poly.size() == fri_params.D[0]->size()) {
+                                for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                                    auto &values = proof.initial_proofs[query_id].at(k).values[polynomial_index];
                                     for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
-                                        typename FRI::field_type::value_type s0;
-                                        typename FRI::field_type::value_type s1;
-                                        if( s_indices[j][0] < s_indices[j][1]){
-                                            s0 = s[j][0];
-                                            s1 = s[j][1];
-                                        } else {
-                                            s0 = s[j][1];
-                                            s1 = s[j][0];
-                                        }
-                                        initial_proof[k].values[polynomial_index][j][0] = g_coeffs.at(k)[polynomial_index].evaluate(s0);
-                                        initial_proof[k].values[polynomial_index][j][1] = g_coeffs.at(k)[polynomial_index].evaluate(s1);
+                                        std::size_t ind0 = std::min(s_indices[query_id][j][0], s_indices[query_id][j][1]);
+                                        std::size_t ind1 = std::max(s_indices[query_id][j][0], s_indices[query_id][j][1]);
+                                        values[j][0] = poly[ind0];
+                                        values[j][1] = poly[ind1];
                                     }
                                 }
                             } else {
-                                // Same for poly in coefficients form.
-                                for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
-                                    typename FRI::field_type::value_type s0;
-                                    typename FRI::field_type::value_type s1;
-
-                                    if( s_indices[j][0] < s_indices[j][1]){
-                                        s0 = s[j][0];
-                                        s1 = s[j][1];
-                                    } else {
-                                        s0 = s[j][1];
-                                        s1 = s[j][0];
-                                    }
-                                    initial_proof[k].values[polynomial_index][j][0] = g_k[polynomial_index].evaluate(s0);
-                                    initial_proof[k].values[polynomial_index][j][1] = g_k[polynomial_index].evaluate(s1);
+                                // It makes no sense to resize in dfs form to then use just 2 values in 2 points.
+                                if (d_cache.find(poly.size()) == d_cache.end()) {
+                                    d_cache[poly.size()] = math::make_evaluation_domain<typename FRI::field_type>(poly.size());
                                 }
+                                fill_evaluations(poly.coefficients(d_cache[poly.size()]));
                             }
+                        } else {
+                            fill_evaluations(poly);
                         }
-
-                        // Fill merkle proofs
-                        initial_proof[k].p = make_proof_specialized<FRI>(
-                                get_folded_index<FRI>(x_index, fri_params.D[0]->size(), fri_params.step_list[0]),
-                                fri_params.D[0]->size(), precommitments.at(k) );
                     }
-
-                    return std::move(initial_proof);
                 }
 
                 template<typename FRI, typename PolynomialType>
@@ -1007,18 +962,15 @@ namespace nil {
                 static typename FRI::initial_proofs_batch_type query_phase_initial_proofs(
                     const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
                     const typename FRI::params_type &fri_params,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const polynomial_batch_loader<PolynomialType> &load_batch,
                     const std::vector<typename FRI::field_type::value_type>& challenges)
                 {
                     typename FRI::initial_proofs_batch_type proof;
+                    proof.initial_proofs.resize(fri_params.lambda);
 
-                    // If we have DFS polynomials, and we are going to resize them, better convert them to coefficients form,
-                    // and compute their values in those 2 * FRI::lambda points each, which is normally 2 * 20.
-                    // In case lambda becomes much larger than log(2, average polynomial size), then this will not be optimal.
-                    // For lambda = 20 and 2^20 rows in assignment table, it's faster and uses less RAM.
-                    std::map<std::size_t, std::vector<math::polynomial<typename FRI::field_type::value_type>>> g_coeffs =
-                        convert_polynomials_to_coefficients<FRI, PolynomialType>(fri_params, g);
-
+                    std::vector<std::uint64_t> x_indices(fri_params.lambda);
+                    std::vector<std::vector<std::array<typename FRI::field_type::value_type, FRI::m>>> s(fri_params.lambda);
+                    std::vector<std::vector<std::array<std::size_t, FRI::m>>> s_indices(fri_params.lambda);
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
                         std::size_t domain_size = fri_params.D[0]->size();
                         typename FRI::field_type::value_type x = challenges[query_id];
@@ -1029,31 +981,58 @@ namespace nil {
                         while (fri_params.D[0]->get_domain_element(x_index) != x) {
                             ++x_index;
                         }
+                        x_indices[query_id] = x_index;
+
+                        std::tie(s[query_id], s_indices[query_id]) =
+                            calculate_s<FRI>(x_index, fri_params.step_list[0], fri_params.D[0]);
+                        BOOST_ASSERT((1 << fri_params.step_list[0]) / FRI::m == s[query_id].size());
+                    }
 
-                        std::map<std::size_t, typename FRI::initial_proof_type>
-                            initial_proof = build_initial_proof<FRI, PolynomialType>(
-                                    precommitments,
-                                    fri_params, g, g_coeffs, x_index);
+                    // Batches are processed one by one and all the queries are answered from a batch before the next
+                    // one is loaded. If we have DFS polynomials, and we are going to resize them, better convert them
+                    // to coefficients form, and compute their values in those 2 * FRI::lambda points each, which is
+                    // normally 2 * 20. In case lambda becomes much larger than log(2, average polynomial size), then
+                    // this will not be optimal. For lambda = 20 and 2^20 rows in assignment table, it's faster and
+                    // uses less RAM.
+                    for (const auto &[k, precommitment]: precommitments) {
+                        std::shared_ptr<const std::vector<PolynomialType>> g_k = load_batch(k);
+                        fill_initial_proof_values<FRI, PolynomialType>(proof, k, *g_k, fri_params, s, s_indices);
 
-                        proof.initial_proofs.emplace_back(std::move(initial_proof));
+                        // Fill merkle proofs
+                        for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                            proof.initial_proofs[query_id][k].p = make_proof_specialized<FRI>(
+                                get_folded_index<FRI>(x_indices[query_id], fri_params.D[0]->size(), fri_params.step_list[0]),
+                                fri_params.D[0]->size(), precommitment);
+                        }
                     }
                     return proof;
                 }
 
+                template<typename FRI, typename PolynomialType>
+                static typename FRI::initial_proofs_batch_type query_phase_initial_proofs(
+                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const typename FRI::params_type &fri_params,
+                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const std::vector<typename FRI::field_type::value_type>& challenges)
+                {
+                    return query_phase_initial_proofs<FRI, PolynomialType>(
+                        precommitments, fri_params, make_polynomial_batch_loader(g), challenges);
+                }
+
                 template<typename FRI, typename PolynomialType>
                 static std::vector<typename FRI::query_proof_type>
                 query_phase_with_challenges(
                     const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
                     const typename FRI::params_type &fri_params,
                     const std::vector<typename FRI::field_type::value_type>& challenges,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const polynomial_batch_loader<PolynomialType> &load_batch,
                     const std::vector<typename FRI::precommitment_type> &fri_trees,
                     const std::vector<PolynomialType> &fs,
                     const math::polynomial<typename FRI::field_type::value_type> &final_polynomial)
                 {
                     typename FRI::initial_proofs_batch_type initial_proofs =
                         query_phase_initial_proofs<FRI, PolynomialType>(
-                            precommitments, fri_params, g, challenges);
+                            precommitments, fri_params, load_batch, challenges);
 
                     typename FRI::round_proofs_batch_type round_proofs =
                         query_phase_round_proofs<FRI, PolynomialType>(
@@ -1075,7 +1054,7 @@ namespace nil {
                     const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
                     const typename FRI::params_type &fri_params,
                     typename FRI::transcript_type &transcript,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const polynomial_batch_loader<PolynomialType> &load_batch,
                     const std::vector<typename FRI::precommitment_type> &fri_trees,
                     const std::vector<PolynomialType> &fs,
                     const math::polynomial<typename FRI::field_type::value_type> &final_polynomial)
@@ -1085,7 +1064,23 @@ namespace nil {
                         transcript.template challenges<typename FRI::field_type>(fri_params.lambda);
 
                     return query_phase_with_challenges<FRI, PolynomialType>(
-                        precommitments, fri_params, challenges, g, fri_trees, fs, final_polynomial);
+                        precommitments, fri_params, challenges, load_batch, fri_trees, fs, final_polynomial);
+                }
+
+                template<typename FRI, typename PolynomialType>
+                static std::vector<typename FRI::query_proof_type>
+                query_phase(
+                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const typename FRI::params_type &fri_params,
+                    typename FRI::transcript_type &transcript,
+                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const std::vector<typename FRI::precommitment_type> &fri_trees,
+                    const std::vector<PolynomialType> &fs,
+                    const math::polynomial<typename FRI::field_type::value_type> &final_polynomial)
+                {
+                    return query_phase<FRI, PolynomialType>(
+                        precommitments, fri_params, transcript, make_polynomial_batch_loader(g), fri_trees, fs,
+                        final_polynomial);
                 }
 
                 template<typename FRI,
@@ -1118,7 +1113,7 @@ namespace nil {
                             FRI>::value,
                         bool>::type = true>
                 static typename FRI::proof_type proof_eval(
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const polynomial_batch_loader<PolynomialType> &load_batch,
                     const PolynomialType& combined_Q,
                     const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
                     const typename FRI::precommitment_type &combined_Q_precommitment,
@@ -1152,7 +1147,7 @@ namespace nil {
                     // Query phase
                     proof.query_proofs = query_phase<FRI, PolynomialType>(
                         precommitments, fri_params, transcript,
-                        g, fri_trees, fs, commitments_proof.final_polynomial);
+                        load_batch, fri_trees, fs, commitments_proof.final_polynomial);
 
                     proof.fri_roots = std::move(commitments_proof.fri_roots);
                     proof.final_polynomial = std::move(commitments_proof.final_polynomial);
@@ -1160,6 +1155,28 @@ namespace nil {
                     return proof;
                 }
 
+                template<typename FRI, typename PolynomialType,
+                    typename std::enable_if<
+                        std::is_base_of<
+                            commitments::detail::basic_batched_fri<
+                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                typename FRI::transcript_hash_type,
+                                FRI::m, typename FRI::grinding_type>,
+                            FRI>::value,
+                        bool>::type = true>
+                static typename FRI::proof_type proof_eval(
+                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const PolynomialType& combined_Q,
+                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const typename FRI::precommitment_type &combined_Q_precommitment,
+                    const typename FRI::params_type &fri_params,
+                    typename FRI::transcript_type &transcript
+                ) {
+                    return proof_eval<FRI, PolynomialType>(
+                        make_polynomial_batch_loader(g), combined_Q, precommitments, combined_Q_precommitment,
+                        fri_params, transcript);
+                }
+
                 template<typename FRI>
                 static bool verify_eval(
                     const typename FRI::proof_type                                                      &proof,
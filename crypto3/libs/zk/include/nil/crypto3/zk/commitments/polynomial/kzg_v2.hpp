@@ -115,6 +115,8 @@ namespace nil {
                     std::map<std::size_t, commitment_type> _commitments;
                     std::map<std::size_t, std::vector<typename CommitmentSchemeType::single_commitment_type>> _ind_commitments;
                     std::vector<typename CommitmentSchemeType::scalar_value_type> _merged_points;
+                    // Line coefficients of the G2 generator and of [s]_2, computed once on the first verification.
+                    std::vector<typename algebra::pairing::pairing_policy<curve_type>::g2_precomputed_type> _verification_lines;
                 protected:
 
                     // Differs from static one by input parameters
@@ -334,13 +336,19 @@ namespace nil {
                         F -= rsum * CommitmentSchemeType::single_commitment_type::one();
                         F -= this->get_V(_merged_points).evaluate(theta_2) * proof.pi_1;
 
-                        auto left_side_pairing = nil::crypto3::algebra::pair_reduced<typename CommitmentSchemeType::curve_type>
-                                (F + theta_2 * proof.pi_2, verification_key_type::one());
+                        if (_verification_lines.empty()) {
+                            _verification_lines = {
+                                algebra::precompute_g2<curve_type>(verification_key_type::one()),
+                                algebra::precompute_g2<curve_type>(_params.verification_key[1])
+                            };
+                        }
 
-                        auto right_side_pairing = nil::crypto3::algebra::pair_reduced<typename CommitmentSchemeType::curve_type>
-                                (proof.pi_2, _params.verification_key[1]);
+                        // e(F + theta_2 * pi_2, g2) * e(-pi_2, [s]_2) == 1
+                        auto pairing_product = nil::crypto3::algebra::multi_pair_reduced<curve_type>(
+                                std::vector<typename curve_type::template g1_type<>::value_type>{F + theta_2 * proof.pi_2, -proof.pi_2},
+                                _verification_lines);
 
-                        return left_side_pairing == right_side_pairing;
+                        return pairing_product && *pairing_product == CommitmentSchemeType::gt_value_type::one();
                     }
 
                     const params_type &get_commitment_params() const {
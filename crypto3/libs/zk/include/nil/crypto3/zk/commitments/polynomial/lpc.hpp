@@ -81,6 +81,13 @@ namespace nil {
                     std::map<std::size_t, bool> _batch_fixed;
                     preprocessed_data_type _fixed_polys_values;
 
+                    // Gives the committed batches to FRI one at a time, spilled batches are read back on request.
+                    nil::crypto3::zk::algorithms::polynomial_batch_loader<polynomial_type> batch_loader() const {
+                        return [this](std::size_t index) {
+                            return this->get_batch(index);
+                        };
+                    }
+
                 public:
                     // Getters for the upper fields. Used from marshalling only so far.
                     const std::map<std::size_t, precommitment_type>& get_trees() const {return _trees;}
@@ -122,7 +129,10 @@ namespace nil {
                             if (!fixed)
                                 continue;
                             result[index] = {};
-                            for (const auto& poly: this->_polys.at(index)){
+                            // The batch may have been spilled right after the commitment.
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = this->get_batch(index);
+                            const std::vector<polynomial_type>& polys = *batch;
+                            for (const auto& poly: polys){
                                 result[index].push_back(poly.evaluate(etha));
                             }
                         }
@@ -135,13 +145,39 @@ namespace nil {
                     }
 
                     commitment_type commit(std::size_t index) {
+                        TRACE_SCOPE_ARG("LPC commit", "batch", index);
                         this->state_commited(index);
 
                         _trees[index] = nil::crypto3::zk::algorithms::precommit<fri_type>(
                             this->_polys[index], _fri_params.D[0], _fri_params.step_list.front());
+
+                        // Committed batches are not used again until the evaluation proof.
+                        this->spill_committed_batches_over_budget();
                         return _trees[index].root();
                     }
 
+                    /** \brief Recomputes the merkle trees of already committed batches from the stored polynomials.
+                     *  Used when the commitment scheme state was saved without the trees.
+                     *  \param roots Expected roots of the trees, one per batch index.
+                     *  \returns false if any of the rebuilt roots does not match the expected one.
+                     */
+                    bool rebuild_trees(const std::map<std::size_t, commitment_type>& roots) {
+                        for (auto const& [index, root]: roots) {
+                            if (this->_polys.find(index) == this->_polys.end()) {
+                                return false;
+                            }
+                            // The batch may have been spilled, it is read back for the duration of the rebuild.
+                            auto tree = nil::crypto3::zk::algorithms::precommit<fri_type>(
+                                *this->get_batch(index), _fri_params.D[0], _fri_params.step_list.front());
+                            if (tree.root() != root) {
+                                return false;
+                            }
+                            _trees[index] = std::move(tree);
+                        }
+                        this->spill_committed_batches_over_budget();
+                        return true;
+                    }
+
                     // Should be done after commitment.
                     void mark_batch_as_fixed(std::size_t index) {
                         _batch_fixed[index] = true;
@@ -182,10 +218,9 @@ namespace nil {
                     lpc_proof_type proof_eval_lpc_proof(
                             const polynomial_type& combined_Q,
                             const std::vector<typename fri_type::field_type::value_type>& challenges) {
-
                         typename fri_type::initial_proofs_batch_type initial_proofs =
                             nil::crypto3::zk::algorithms::query_phase_initial_proofs<fri_type, polynomial_type>(
-                            this->_trees, this->_fri_params, this->_polys, challenges);
+                            this->_trees, this->_fri_params, batch_loader(), challenges);
                         return {this->_z, initial_proofs};
                     }
 
@@ -254,7 +289,7 @@ namespace nil {
 
                         typename fri_type::proof_type fri_proof = nil::crypto3::zk::algorithms::proof_eval<
                                 fri_type, polynomial_type>(
-                            this->_polys,
+                            batch_loader(),
                             combined_Q,
                             this->_trees,
                             combined_Q_precommitment,
@@ -283,35 +318,61 @@ namespace nil {
                         auto points = this->get_unique_points();
                         math::polynomial<value_type> combined_Q_normal;
 
-                        for (auto const &point: points) {
-                            V = {-point, 1u};
-                            math::polynomial<value_type> Q_normal;
+                        // Starting power of theta for each pair of point and batch, the batches are loaded and
+                        // converted to coefficients form one at a time in the loop below.
+                        std::vector<std::map<std::size_t, value_type>> theta_accs(points.size());
+                        for (std::size_t point_index = 0; point_index < points.size(); ++point_index) {
                             for (std::size_t i: this->_z.get_batches()) {
+                                theta_accs[point_index][i] = theta_acc;
                                 for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
-                                    auto iter = this->_points_map[i][j].find(point);
+                                    if (this->_points_map[i][j].find(points[point_index]) != this->_points_map[i][j].end())
+                                        theta_acc *= theta;
+                                }
+                            }
+                        }
+                        std::map<std::size_t, value_type> etha_theta_accs;
+                        for (std::size_t i: this->_z.get_batches()) {
+                            if (!_batch_fixed[i])
+                                continue;
+                            etha_theta_accs[i] = theta_acc;
+                            theta_acc = theta_acc * theta.pow(this->_z.get_batch_size(i));
+                        }
+
+                        std::vector<math::polynomial<value_type>> Q_normals(points.size());
+                        for (std::size_t i: this->_z.get_batches()) {
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = this->get_batch(i);
+
+                            for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
+                                math::polynomial<value_type> g_normal_base;
+                                if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
+                                    g_normal_base = math::polynomial<value_type>((*batch)[j].coefficients());
+                                } else {
+                                    g_normal_base = (*batch)[j];
+                                }
+
+                                for (std::size_t point_index = 0; point_index < points.size(); ++point_index) {
+                                    auto iter = this->_points_map[i][j].find(points[point_index]);
                                     if (iter == this->_points_map[i][j].end())
                                         continue;
 
-                                    math::polynomial<value_type> g_normal;
-                                    if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
-                                        g_normal = math::polynomial<value_type>(this->_polys[i][j].coefficients());
-                                    } else {
-                                        g_normal = this->_polys[i][j];
-                                    }
-                                    g_normal *= theta_acc;
-                                    Q_normal += g_normal;
-                                    Q_normal -= this->_z.get(i, j, iter->second) * theta_acc;
-                                    theta_acc *= theta;
+                                    value_type& point_theta_acc = theta_accs[point_index][i];
+                                    math::polynomial<value_type> g_normal = g_normal_base;
+                                    g_normal *= point_theta_acc;
+                                    Q_normals[point_index] += g_normal;
+                                    Q_normals[point_index] -= this->_z.get(i, j, iter->second) * point_theta_acc;
+                                    point_theta_acc *= theta;
                                 }
                             }
-                            Q_normal = Q_normal / V;
-                            combined_Q_normal += Q_normal;
+                        }
+
+                        for (std::size_t point_index = 0; point_index < points.size(); ++point_index) {
+                            V = {-points[point_index], 1u};
+                            combined_Q_normal += Q_normals[point_index] / V;
                         }
 
                         // TODO(martun): the following code is the same as above with point = _etha, de-duplicate it.
-                        for (std::size_t i: this->_z.get_batches()) {
-                            if (!_batch_fixed[i])
-                                continue;
+                        for (auto& [i, etha_theta_acc]: etha_theta_accs) {
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = this->get_batch(i);
 
                             math::polynomial<value_type> Q_normal;
                             auto point = _etha;
@@ -319,15 +380,15 @@ namespace nil {
                             for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
                                 math::polynomial<value_type> g_normal;
                                 if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
-                                    g_normal = math::polynomial<value_type>(this->_polys[i][j].coefficients());
+                                    g_normal = math::polynomial<value_type>((*batch)[j].coefficients());
                                 } else {
-                                    g_normal = this->_polys[i][j];
+                                    g_normal = (*batch)[j];
                                 }
 
-                                g_normal *= theta_acc;
+                                g_normal *= etha_theta_acc;
                                 Q_normal += g_normal;
-                                Q_normal -= _fixed_polys_values[i][j] * theta_acc;
-                                theta_acc *= theta;
+                                Q_normal -= _fixed_polys_values[i][j] * etha_theta_acc;
+                                etha_theta_acc *= theta;
                             }
 
                             Q_normal = Q_normal / V;
@@ -25,6 +25,7 @@
 #ifndef CRYPTO3_ZK_PLONK_DETAIL_LOOKUP_TABLE_DEFINITION_HPP
 #define CRYPTO3_ZK_PLONK_DETAIL_LOOKUP_TABLE_DEFINITION_HPP
 
+#include <algorithm>
 #include <string>
 #include <map>
 
@@ -112,6 +113,9 @@ namespace nil {
                     filled_lookup_table_definition(lookup_table_definition<FieldType> &other):lookup_table_definition<FieldType>(other.table_name){
                         this->_table = other.get_table();
                     }
+                    filled_lookup_table_definition(const std::string &table_name, std::vector<std::vector<typename FieldType::value_type>> &&table):lookup_table_definition<FieldType>(table_name){
+                        this->_table = std::move(table);
+                    }
                     virtual void generate() {};
                     virtual ~filled_lookup_table_definition() {};
                     virtual std::size_t get_columns_number(){
@@ -122,6 +126,17 @@ namespace nil {
                     }
                 };
 
+                namespace detail {
+                    // Copies rows [from_begin, from_end) of a lookup table column into a constant column starting from 'start_row'.
+                    template<typename FieldType>
+                    void copy_lookup_table_column(
+                        const std::vector<typename FieldType::value_type> &from, std::size_t from_begin, std::size_t from_end,
+                        plonk_column<FieldType> &to, std::size_t start_row
+                    ){
+                        std::copy(from.begin() + from_begin, from.begin() + from_end, to.begin() + start_row);
+                    }
+                }    // namespace detail
+
                 // Returned value -- new usable_rows.
                 // All tables are necessary for circuit generation.
                 template<typename FieldType, typename TableIdsMapType>
@@ -156,10 +171,25 @@ namespace nil {
                         constant_columns_ids.push_back(i);
                     }
 
+                    // Compute the final size of every constant column, so each one is allocated once.
+                    std::vector<std::size_t> constant_columns_sizes(constant_columns_ids.size(), usable_rows);
+                    {
+                        std::size_t start_row = 1;
+                        for( const auto&[k, table]:lookup_tables ){
+                            const auto &table_columns = table->get_table();
+                            for( std::size_t i = 0; i < table_columns.size(); i++ ){
+                                constant_columns_sizes[i] = std::max(constant_columns_sizes[i], start_row + table_columns[i].size());
+                            }
+                            start_row += table->get_rows_number();
+                        }
+                    }
+
                     // Allocate constant columns
-                    std::vector<plonk_column<FieldType>> constant_columns(
-                        constant_columns_ids.size(), plonk_column<FieldType>(usable_rows, FieldType::value_type::zero())
-                    );
+                    std::vector<plonk_column<FieldType>> constant_columns;
+                    constant_columns.reserve(constant_columns_ids.size());
+                    for( std::size_t i = 0; i < constant_columns_ids.size(); i++ ){
+                        constant_columns.emplace_back(constant_columns_sizes[i], FieldType::value_type::zero());
+                    }
                     std::vector<plonk_column<FieldType>> selector_columns;
 
                     std::size_t start_row = 1;
@@ -167,17 +197,10 @@ namespace nil {
                     for( const auto&[k, table]:lookup_tables ){
                         // std::cout << "Packing table " << table->table_name << std::endl;
                         // Place table into constant_columns.
-                        for( std::size_t i = 0; i < table->get_table().size(); i++ ){
-                            auto end = start_row + table->get_table()[i].size();
-                            if(constant_columns[i].size() < end){
-                                constant_columns[i].resize(end);
-                                if( usable_rows_after < end ){
-                                    usable_rows_after = end;
-                                }
-                            }
-                            for( std::size_t j = 0; j < table->get_table()[i].size(); j++ ){
-                                constant_columns[i][start_row + j] = table->get_table()[i][j];
-                            }
+                        const auto &table_columns = table->get_table();
+                        for( std::size_t i = 0; i < table_columns.size(); i++ ){
+                            usable_rows_after = std::max(usable_rows_after, start_row + table_columns[i].size());
+                            detail::copy_lookup_table_column<FieldType>(table_columns[i], 0, table_columns[i].size(), constant_columns[i], start_row);
                         }
 
                         for( const auto &[subtable_name, subtable]:table->subtables ){
@@ -290,15 +313,17 @@ namespace nil {
                             }
 
                             if( table-> get_rows_number() % max_usable_rows == 0 ) options_number--;
-                            std::size_t cur = 0;
+                            // Option i holds rows [i * (max_usable_rows - 1), (i + 1) * (max_usable_rows - 1)) of the table,
+                            // the rows after the end of the table repeat its last row.
+                            const auto &table_columns = table->get_table();
+                            const std::size_t rows_number = table->get_rows_number();
                             for(std::size_t i = 0; i < options_number; i++){
-                                for(std::size_t start_row = 1; start_row < max_usable_rows; start_row++, cur++){
-                                    for(std::size_t k = 0; k < table->get_columns_number(); k++){
-                                        if(cur < table->get_rows_number())
-                                            constant_columns[cur_constant_column + k][start_row] = table->get_table()[k][cur];
-                                        else
-                                            constant_columns[cur_constant_column + k][start_row] = table->get_table()[k][table->get_rows_number()-1];
-                                    }
+                                std::size_t begin = std::min(i * (max_usable_rows - 1), rows_number);
+                                std::size_t end = std::min(begin + max_usable_rows - 1, rows_number);
+                                for(std::size_t k = 0; k < table->get_columns_number(); k++){
+                                    auto &column = constant_columns[cur_constant_column + k];
+                                    detail::copy_lookup_table_column<FieldType>(table_columns[k], begin, end, column, 1);
+                                    std::fill(column.begin() + 1 + end - begin, column.begin() + max_usable_rows, table_columns[k][rows_number - 1]);
                                 }
                                 cur_constant_column += table->get_columns_number();
                             }
@@ -329,16 +354,15 @@ namespace nil {
                         }
 
                         // Place table into constant_columns.
-                        for( std::size_t i = 0; i < table->get_table().size(); i++ ){
-                            if(constant_columns[start_constant_column + i].size() < start_row + table->get_table()[i].size()){
-                                constant_columns[start_constant_column + i].resize(start_row + table->get_table()[i].size());
-                                if( usable_rows_after < start_row + table->get_table()[i].size() ){
-                                    usable_rows_after = start_row + table->get_table()[i].size();
+                        const auto &table_columns = table->get_table();
+                        for( std::size_t i = 0; i < table_columns.size(); i++ ){
+                            if(constant_columns[start_constant_column + i].size() < start_row + table_columns[i].size()){
+                                constant_columns[start_constant_column + i].resize(start_row + table_columns[i].size());
+                                if( usable_rows_after < start_row + table_columns[i].size() ){
+                                    usable_rows_after = start_row + table_columns[i].size();
                                 }
                             }
-                            for( std::size_t j = 0; j < table->get_table()[i].size(); j++ ){
-                                constant_columns[start_constant_column + i][start_row + j] = table->get_table()[i][j];
-                            }
+                            detail::copy_lookup_table_column<FieldType>(table_columns[i], 0, table_columns[i].size(), constant_columns[start_constant_column + i], start_row);
                         }
 
                         std::map<std::pair<std::size_t, std::size_t>, std::size_t> selector_ids;
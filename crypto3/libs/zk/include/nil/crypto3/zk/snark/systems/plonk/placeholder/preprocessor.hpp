@@ -33,6 +33,7 @@
 #include <sstream>
 #include <string>
 #include <map>
+#include <optional>
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
@@ -539,7 +540,11 @@ namespace nil {
                         //    if 0 -- any degree
                         //    else -- we have a bound for permutations and lookups F-s degree rows_amount * (2 ^ max_quotient_poly_expand)
                         const std::size_t max_quotient_poly_chunks = 0,
-                        const typename FieldType::value_type& delta=algebra::fields::arithmetic_params<FieldType>::multiplicative_generator
+                        const typename FieldType::value_type& delta=algebra::fields::arithmetic_params<FieldType>::multiplicative_generator,
+                        // Hash of the constraint system with the parameters above, computed by an earlier preprocessing
+                        // of the same circuit. It's computed from scratch if not set.
+                        const std::optional<typename transcript_hash_type::digest_type>& cached_constraint_system_with_params_hash =
+                            std::nullopt
                     ) {
                         PROFILE_SCOPE("Placeholder public preprocessor");
 
@@ -606,6 +611,8 @@ namespace nil {
                             columns_rotations(constraint_system, table_description);
 
                         typename transcript_hash_type::digest_type constraint_system_with_params_hash =
+                            cached_constraint_system_with_params_hash.has_value() ?
+                            *cached_constraint_system_with_params_hash :
                             nil::crypto3::zk::snark::detail::compute_constraint_system_with_params_hash<ParamsType, transcript_hash_type>(
                                 constraint_system,
                                 table_description,
@@ -44,6 +44,10 @@
 #include <nil/crypto3/hash/keccak.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
 
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/transcript_initialization_context.hpp>
+
 #include <nil/crypto3/test_tools/random_test_initializer.hpp>
 
 #include "circuits.hpp"
@@ -53,6 +57,75 @@ using namespace nil::crypto3;
 using namespace nil::crypto3::zk;
 using namespace nil::crypto3::zk::snark;
 
+// Hash of the constraint system and its parameters, computed from the whole marshalled data as it was done before
+// the hash was streamed. Copy constraints are replaced by the digests of their chunks if there are many of them.
+template<typename TestRunner>
+typename TestRunner::lpc_placeholder_params_type::transcript_hash_type::digest_type
+reference_constraint_system_hash(const TestRunner &test_runner,
+                                 const typename TestRunner::lpc_scheme_type::params_type &commitment_params) {
+    using params_type = typename TestRunner::lpc_placeholder_params_type;
+    using hash_type = typename params_type::transcript_hash_type;
+    using field_type = typename TestRunner::field_type;
+    using constraint_system_type = plonk_constraint_system<field_type>;
+    using Endianness = nil::marshalling::option::big_endian;
+    using TTypeBase = nil::marshalling::field_type<Endianness>;
+    const std::size_t chunk_size = zk::snark::detail::copy_constraints_hash_chunk_size;
+
+    auto hash_bytes = [](const std::vector<std::uint8_t> &bytes) {
+        return hash<hash_type>(
+            hashes::conditional_block_to_field_elements_wrapper<typename hash_type::word_type, std::vector<std::uint8_t>>(
+                bytes));
+    };
+    auto append = [](std::vector<std::uint8_t> &bytes, const auto &filled_value) {
+        std::size_t offset = bytes.size();
+        bytes.resize(offset + filled_value.length());
+        auto write_iter = bytes.begin() + offset;
+        BOOST_CHECK(filled_value.write(write_iter, filled_value.length()) == nil::marshalling::status_type::success);
+    };
+
+    zk::snark::detail::transcript_initialization_context<params_type> context(
+        test_runner.desc.rows_amount, test_runner.desc.usable_rows_amount, commitment_params, test_runner.desc,
+        "Default application dependent transcript initialization string",
+        algebra::fields::arithmetic_params<field_type>::multiplicative_generator);
+
+    std::vector<std::uint8_t> cv;
+    append(cv, marshalling::types::fill_transcript_initialization_context<
+        Endianness, zk::snark::detail::transcript_initialization_context<params_type>>(context));
+
+    const auto &copy_constraints = test_runner.constraint_system.copy_constraints();
+    if (copy_constraints.size() <= chunk_size) {
+        append(cv, marshalling::types::fill_plonk_constraint_system<Endianness, constraint_system_type>(
+            test_runner.constraint_system));
+        return hash_bytes(cv);
+    }
+
+    const auto &cs = test_runner.constraint_system;
+    append(cv, marshalling::types::fill_plonk_gates<
+        Endianness, typename constraint_system_type::gates_container_type::value_type>(cs.gates()));
+    append(cv, nil::marshalling::types::integral<TTypeBase, std::size_t>(copy_constraints.size()));
+    for (std::size_t begin = 0; begin < copy_constraints.size(); begin += chunk_size) {
+        std::vector<plonk_copy_constraint<field_type>> chunk(
+            copy_constraints.begin() + begin,
+            copy_constraints.begin() + std::min(copy_constraints.size(), begin + chunk_size));
+        std::vector<std::uint8_t> chunk_bytes;
+        append(chunk_bytes, marshalling::types::fill_plonk_copy_constraints<Endianness, field_type>(chunk));
+        // Drop the size prefix of the list.
+        chunk_bytes.erase(chunk_bytes.begin(), chunk_bytes.begin() + sizeof(std::size_t));
+        auto digest = hash_bytes(chunk_bytes);
+        if constexpr (algebra::is_field_element<decltype(digest)>::value) {
+            append(cv, marshalling::types::field_element<TTypeBase, decltype(digest)>(digest));
+        } else {
+            cv.insert(cv.end(), digest.begin(), digest.end());
+        }
+    }
+    append(cv, marshalling::types::fill_plonk_lookup_gates<
+        Endianness, typename constraint_system_type::lookup_gates_container_type::value_type>(cs.lookup_gates()));
+    append(cv, marshalling::types::fill_plonk_lookup_tables<
+        Endianness, typename constraint_system_type::lookup_tables_type::value_type>(cs.lookup_tables()));
+    append(cv, marshalling::types::public_input_sizes_type<TTypeBase>());
+    return hash_bytes(cv);
+}
+
 
 BOOST_AUTO_TEST_SUITE(placeholder_hashes_test)
 
@@ -80,5 +153,34 @@ BOOST_AUTO_TEST_SUITE(placeholder_hashes_test)
         BOOST_CHECK(test_runner.run_test());
     }
 
+    BOOST_AUTO_TEST_CASE_TEMPLATE(constraint_system_hash_test, TestRunner, TestRunners) {
+        using params_type = typename TestRunner::lpc_placeholder_params_type;
+        using hash_type = typename params_type::transcript_hash_type;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_1<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        // Enough copy constraints to be hashed in chunks, the last one incomplete.
+        auto large_circuit = circuit;
+        while (large_circuit.copy_constraints.size() <= 2 * zk::snark::detail::copy_constraints_hash_chunk_size + 5) {
+            large_circuit.copy_constraints.insert(
+                large_circuit.copy_constraints.end(), circuit.copy_constraints.begin(), circuit.copy_constraints.end());
+        }
+
+        for (const auto &c: {circuit, large_circuit}) {
+            TestRunner test_runner(c);
+            typename TestRunner::lpc_scheme_type lpc_scheme(test_runner.fri_params);
+
+            auto streamed_hash = zk::snark::detail::compute_constraint_system_with_params_hash<params_type, hash_type>(
+                test_runner.constraint_system, test_runner.desc, test_runner.desc.rows_amount,
+                test_runner.desc.usable_rows_amount, lpc_scheme.get_commitment_params(),
+                "Default application dependent transcript initialization string",
+                algebra::fields::arithmetic_params<field_type>::multiplicative_generator);
+            BOOST_CHECK(streamed_hash == reference_constraint_system_hash(test_runner, lpc_scheme.get_commitment_params()));
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
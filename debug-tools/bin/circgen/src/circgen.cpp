@@ -101,8 +101,6 @@ generate_circuit(
     using assignment_type  = typename FieldType::value_type;
     using gate_type = plonk_gate<FieldType, plonk_constraint<FieldType>>;
 
-    auto alg_rnd = nil::crypto3::random::algebraic_engine<FieldType>();
-
     constexpr std::size_t witness_columns = 1;
     constexpr std::size_t selector_columns = 1;
     constexpr std::size_t lookup_columns = 0;
@@ -164,7 +162,8 @@ generate_circuit(
             plonk_private_assignment_table<FieldType>(private_assignment),
     plonk_public_assignment_table<FieldType>(
                 public_input_assignment, constant_assignment, selectors_assignment));
-    auto padded_rows = zk_padding<FieldType, plonk_column<FieldType>>(circuit_table, alg_rnd);
+    auto padded_rows = zk_padding<FieldType, plonk_column<FieldType>>(
+        circuit_table, nil::crypto3::random::chacha_field_engine<FieldType>::from_random_device());
     BOOST_LOG_TRIVIAL(info) << "Rows after padding: " << padded_rows;
 
     /* Gates (one pcs) */
@@ -0,0 +1,257 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <boost/log/trivial.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <ios>
+#include <optional>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/mnt6.hpp>
+
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
+
+#include <nil/blueprint/utils/satisfiability_check.hpp>
+
+namespace po = boost::program_options;
+
+void usage(po::options_description const& desc)
+{
+    std::cout << "satcheck - Check that an assignment table satisfies a circuit" << std::endl;
+    std::cout << R"#(Reads the marshalled circuit and assignment table, as written by the assigner
+or circgen, and checks all the gates, lookup gates and copy constraints.
+Rows are checked in parallel, lookup tables are read from the assignment table
+and hashed once. Every failing (gate, constraint, row) is printed, unless
+--max-failures limits the number of reported failures.
+
+Exit code is 0 if the table satisfies the circuit, 1 if it does not and 2 on errors.
+)#" << std::endl;
+
+    std::cout << desc << std::endl;
+}
+
+using namespace nil::crypto3::zk::snark;
+
+template<typename MarshallingType>
+std::optional<MarshallingType> decode_marshalling_from_file(const boost::filesystem::path& path)
+{
+    std::ifstream stream(path.string(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (!stream.is_open()) {
+        BOOST_LOG_TRIVIAL(error) << "Unable to open file " << path;
+        return std::nullopt;
+    }
+
+    std::vector<std::uint8_t> v(stream.tellg());
+    stream.seekg(0, std::ios::beg);
+    stream.read(reinterpret_cast<char*>(v.data()), v.size());
+    if (!stream) {
+        BOOST_LOG_TRIVIAL(error) << "Unable to read file " << path;
+        return std::nullopt;
+    }
+
+    MarshallingType marshalled_data;
+    auto read_iter = v.begin();
+    nil::marshalling::status_type status = marshalled_data.read(read_iter, v.size());
+    if (status != nil::marshalling::status_type::success) {
+        BOOST_LOG_TRIVIAL(error) << "Marshalled structure decoding failed for " << path;
+        return std::nullopt;
+    }
+    return marshalled_data;
+}
+
+struct satcheck_options {
+    std::string field;
+    boost::filesystem::path circuit, assignment_table;
+    std::size_t threads;
+    std::size_t max_failures;
+    bool quiet;
+};
+
+
+template<typename circuit_field>
+int run_main(satcheck_options const& opts)
+{
+    using endianness = nil::marshalling::option::big_endian;
+
+    using constraint_system = plonk_constraint_system<circuit_field>;
+    using assignment_table = plonk_assignment_table<circuit_field>;
+
+    using marshalling_field_type = nil::marshalling::field_type<endianness>;
+    using mcs = nil::crypto3::marshalling::types::plonk_constraint_system<marshalling_field_type, constraint_system>;
+    using mat = nil::crypto3::marshalling::types::plonk_assignment_table<marshalling_field_type, assignment_table>;
+
+    BOOST_LOG_TRIVIAL(info) << "Read circuit from " << opts.circuit;
+    auto marshalled_cs = decode_marshalling_from_file<mcs>(opts.circuit);
+    if (!marshalled_cs) {
+        return 2;
+    }
+    constraint_system cs =
+        nil::crypto3::marshalling::types::make_plonk_constraint_system<endianness, constraint_system>(*marshalled_cs);
+
+    BOOST_LOG_TRIVIAL(info) << "Read assignment table from " << opts.assignment_table;
+    auto marshalled_table = decode_marshalling_from_file<mat>(opts.assignment_table);
+    if (!marshalled_table) {
+        return 2;
+    }
+    auto [table_description, table] =
+        nil::crypto3::marshalling::types::make_assignment_table<endianness, assignment_table>(*marshalled_table);
+
+    BOOST_LOG_TRIVIAL(info) << "Checking " << cs.gates().size() << " gates, " << cs.lookup_gates().size()
+                            << " lookup gates and " << cs.copy_constraints().size() << " copy constraints on "
+                            << table.rows_amount() << " rows";
+
+    nil::blueprint::satisfiability_check_options check_options;
+    check_options.threads = opts.threads;
+    check_options.max_failures = opts.max_failures;
+    check_options.verbose = !opts.quiet;
+
+    auto failures = nil::blueprint::check_table_satisfiability(cs, table, check_options);
+    if (!failures.empty()) {
+        BOOST_LOG_TRIVIAL(error) << "Circuit is not satisfied, " << failures.size() << " failures reported";
+        return 1;
+    }
+
+    BOOST_LOG_TRIVIAL(info) << "Circuit is satisfied";
+    return 0;
+}
+
+template<typename T>
+po::typed_value<T>* make_defaulted_option(T& variable) {
+    return po::value(&variable)->default_value(variable);
+}
+
+
+po::options_description define_options(satcheck_options &opts)
+{
+    po::options_description desc("satcheck options");
+
+    desc.add_options()
+        ("help", "Print help")
+        ("field", make_defaulted_option(opts.field),
+            "Circuit field: bn_base, bn_scalar, bls12_381_base, bls12_381_scalar, bls12_377_base, "
+            "bls12_377_scalar, mnt4, mnt6, pallas, vesta or goldilocks")
+        ("circuit", make_defaulted_option(opts.circuit), "Circuit filename")
+        ("assignment", make_defaulted_option(opts.assignment_table), "Assignment table filename")
+        ("threads", make_defaulted_option(opts.threads), "Number of threads, 0 to use all the hardware threads")
+        ("max-failures", make_defaulted_option(opts.max_failures),
+            "Stop after this number of failures, 0 to report all of them")
+        ("quiet", po::bool_switch(&opts.quiet), "Do not print the failures")
+        ;
+
+    return desc;
+}
+
+
+int main(int argc, char *argv[])
+{
+
+    satcheck_options opts {
+        .field = "pallas",
+        .circuit = "circuit.crct",
+        .assignment_table = "assignment.tbl",
+        .threads = 0,
+        .max_failures = 0,
+        .quiet = false
+    };
+
+    po::options_description desc = define_options(opts);
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        usage(desc);
+        return 0;
+    }
+
+    if (opts.field == "bn_base") {
+        using curve_type = nil::crypto3::algebra::curves::alt_bn128_254;
+        using circuit_field = typename curve_type::base_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "bn_scalar") {
+        using curve_type = nil::crypto3::algebra::curves::alt_bn128_254;
+        using circuit_field = typename curve_type::scalar_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "bls12_381_base") {
+        using curve_type = nil::crypto3::algebra::curves::bls12_381;
+        using circuit_field = typename curve_type::base_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "bls12_381_scalar") {
+        using curve_type = nil::crypto3::algebra::curves::bls12_381;
+        using circuit_field = typename curve_type::scalar_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "bls12_377_base") {
+        using curve_type = nil::crypto3::algebra::curves::bls12_377;
+        using circuit_field = typename curve_type::base_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "bls12_377_scalar") {
+        using curve_type = nil::crypto3::algebra::curves::bls12_377;
+        using circuit_field = typename curve_type::scalar_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "mnt4") {
+        using curve_type = nil::crypto3::algebra::curves::mnt4_298;
+        using circuit_field = typename curve_type::base_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "mnt6") {
+        using curve_type = nil::crypto3::algebra::curves::mnt6_298;
+        using circuit_field = typename curve_type::base_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "pallas") {
+        using curve_type = nil::crypto3::algebra::curves::pallas;
+        using circuit_field = typename curve_type::base_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "vesta") {
+        using curve_type = nil::crypto3::algebra::curves::vesta;
+        using circuit_field = typename curve_type::base_field_type;
+        return run_main<circuit_field>(opts);
+    } else if (opts.field == "goldilocks") {
+        using circuit_field = nil::crypto3::algebra::fields::goldilocks64_base_field;
+        return run_main<circuit_field>(opts);
+    } else {
+        std::cout << "Unknown field: '" << opts.field << "'. Use --help to get list of fields." << std::endl;
+        return 2;
+    }
+
+    /* unreachable */
+    return 0;
+}
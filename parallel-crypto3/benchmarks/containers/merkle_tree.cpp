@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_merkle_tree_benchmark
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/crypto3/bench/parallel/harness.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::bench;
+
+BOOST_TEST_GLOBAL_FIXTURE(benchmark_fixture);
+
+// Leaves have the size of two field elements, as in the FRI trees of arity 2.
+using leaf_type = std::array<std::uint8_t, 64>;
+
+std::vector<leaf_type> generate_leaves(std::size_t count) {
+    boost::random::mt19937 rnd;
+    std::vector<leaf_type> leaves(count);
+    for (auto& leaf: leaves) {
+        for (auto& byte: leaf) {
+            byte = rnd() & 0xFF;
+        }
+    }
+    return leaves;
+}
+
+template<typename HashType>
+void merkle_tree_benchmark(benchmark_suite& suite, const std::string& name) {
+    for (std::size_t log_size: suite.config.log_sizes(14, 22)) {
+        std::vector<leaf_type> leaves = generate_leaves(std::size_t(1) << log_size);
+        suite.measure(name, log_size, [&leaves]() {
+            auto tree = containers::make_merkle_tree<HashType, 2>(leaves.begin(), leaves.end());
+            BOOST_CHECK(tree.leaves() == leaves.size());
+        });
+    }
+}
+
+BOOST_FIXTURE_TEST_SUITE(parallel_merkle_tree_benchmark_suite, benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(merkle_tree_keccak) {
+    merkle_tree_benchmark<hashes::keccak_1600<256>>(*this, "make_merkle_tree/keccak_256");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree_sha2) {
+    merkle_tree_benchmark<hashes::sha2<256>>(*this, "make_merkle_tree/sha2_256");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
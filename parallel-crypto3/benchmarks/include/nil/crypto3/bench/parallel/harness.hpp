@@ -0,0 +1,210 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef PARALLEL_CRYPTO3_BENCH_HARNESS_HPP
+#define PARALLEL_CRYPTO3_BENCH_HARNESS_HPP
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+
+#include <nil/crypto3/bench/benchmark_report.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace bench {
+
+            /**
+             * Settings of a benchmark run, taken from the environment so the same binaries can be driven by
+             * the scaling script:
+             *   PARALLEL_BENCH_THREADS               size of each thread pool, all hardware threads by default;
+             *   PARALLEL_BENCH_MIN_LOG_SIZE,
+             *   PARALLEL_BENCH_MAX_LOG_SIZE          override the range of input sizes (log2) of all benchmarks;
+             *   PARALLEL_BENCH_ITERATIONS            measured runs per size, 3 by default;
+             *   PARALLEL_BENCH_WARMUP                unmeasured runs per size, 1 by default;
+             *   PARALLEL_BENCH_OUTPUT                JSON file to write the results to;
+             *   PARALLEL_BENCH_BASELINE              JSON file with earlier results to compare with;
+             *   PARALLEL_BENCH_REGRESSION_THRESHOLD  allowed slowdown against the baseline, 0.1 by default.
+             */
+            struct benchmark_config {
+                std::size_t threads;
+                std::size_t min_log_size;
+                std::size_t max_log_size;
+                std::size_t iterations;
+                std::size_t warmup;
+                std::string output;
+                std::string baseline;
+                double regression_threshold;
+
+                static const benchmark_config& get() {
+                    static benchmark_config config = from_environment();
+                    return config;
+                }
+
+                // Log sizes between the defaults of the benchmark, unless they are overridden by the environment.
+                std::vector<std::size_t> log_sizes(std::size_t default_min, std::size_t default_max) const {
+                    std::size_t from = min_log_size != 0 ? min_log_size : default_min;
+                    std::size_t to = max_log_size != 0 ? max_log_size : default_max;
+                    std::vector<std::size_t> sizes;
+                    for (std::size_t log_size = from; log_size <= to; ++log_size) {
+                        sizes.push_back(log_size);
+                    }
+                    return sizes;
+                }
+
+            private:
+                static std::size_t read_size(const char* name, std::size_t default_value) {
+                    const char* value = std::getenv(name);
+                    return value != nullptr && *value != '\0' ? std::stoul(value) : default_value;
+                }
+
+                static std::string read_string(const char* name) {
+                    const char* value = std::getenv(name);
+                    return value != nullptr ? value : "";
+                }
+
+                static benchmark_config from_environment() {
+                    benchmark_config config;
+                    config.threads = read_size("PARALLEL_BENCH_THREADS", std::thread::hardware_concurrency());
+                    config.min_log_size = read_size("PARALLEL_BENCH_MIN_LOG_SIZE", 0);
+                    config.max_log_size = read_size("PARALLEL_BENCH_MAX_LOG_SIZE", 0);
+                    config.iterations = read_size("PARALLEL_BENCH_ITERATIONS", 3);
+                    config.warmup = read_size("PARALLEL_BENCH_WARMUP", 1);
+                    config.output = read_string("PARALLEL_BENCH_OUTPUT");
+                    config.baseline = read_string("PARALLEL_BENCH_BASELINE");
+                    std::string threshold = read_string("PARALLEL_BENCH_REGRESSION_THRESHOLD");
+                    config.regression_threshold = threshold.empty() ? 0.1 : std::stod(threshold);
+                    return config;
+                }
+            };
+
+            /**
+             * Global fixture of every benchmark module, it owns the report of the module. The thread pools keep
+             * the size they were created with, so they are created here before any parallel code runs. On teardown
+             * the results are written and compared with the baseline, each regression fails the module.
+             * Registered in every benchmark with
+             *   BOOST_TEST_GLOBAL_FIXTURE(benchmark_fixture);
+             * Test cases get the report through the benchmark_suite fixture.
+             */
+            struct benchmark_fixture {
+                // Boost.Test gives test cases no access to global fixtures, so the report lives with the class.
+                static benchmark_report& module_report() {
+                    static benchmark_report report;
+                    return report;
+                }
+
+                void setup() {
+                    const auto& config = benchmark_config::get();
+                    ThreadPool::get_instance(ThreadPool::PoolLevel::LOW, config.threads);
+                    ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH, config.threads);
+                    ThreadPool::get_instance(ThreadPool::PoolLevel::LASTPOOL, config.threads);
+
+                    auto& report = module_report();
+                    report.add_metadata("module", boost::unit_test::framework::master_test_suite().p_name.get());
+                    report.add_metadata("threads", std::to_string(config.threads));
+                    report.add_metadata("hardware_concurrency", std::to_string(std::thread::hardware_concurrency()));
+                    report.add_metadata("iterations", std::to_string(config.iterations));
+                    std::cout << "Running benchmarks with " << config.threads << " threads" << std::endl;
+                }
+
+                void teardown() {
+                    const auto& config = benchmark_config::get();
+                    const auto& report = module_report();
+                    if (!config.output.empty()) {
+                        BOOST_CHECK_MESSAGE(report.write_json(config.output),
+                                            "Failed to write benchmark results to " << config.output);
+                    }
+                    if (!config.baseline.empty()) {
+                        for (const auto& regression: report.compare(config.baseline, config.regression_threshold)) {
+                            BOOST_ERROR(regression.name << " 2^" << regression.size << " with " << regression.threads
+                                        << " threads: " << regression.current_ms << " ms, baseline "
+                                        << regression.baseline_ms << " ms");
+                        }
+                    }
+                }
+            };
+
+            /**
+             * Runs 'run(state)' on fresh states returned by 'setup()', only 'run' is timed. The first
+             * 'warmup' runs are discarded, the rest are added to 'report' under 'name' and 'log_size'.
+             */
+            template<typename SetupFunction, typename RunFunction>
+            benchmark_result measure(benchmark_report& report, const benchmark_config& config, const std::string& name,
+                                     std::size_t log_size, SetupFunction&& setup, RunFunction&& run) {
+                benchmark_result result{name, log_size, config.threads, {}};
+
+                for (std::size_t i = 0; i < config.warmup + config.iterations; ++i) {
+                    auto state = setup();
+                    auto start = std::chrono::steady_clock::now();
+                    run(state);
+                    auto finish = std::chrono::steady_clock::now();
+                    if (i >= config.warmup) {
+                        result.samples_ms.push_back(std::chrono::duration<double, std::milli>(finish - start).count());
+                    }
+                }
+
+                std::cout << std::left << std::setw(40) << name << " 2^" << std::setw(3) << log_size << std::right
+                          << std::fixed << std::setprecision(3) << std::setw(14) << result.median_ms() << " ms"
+                          << std::endl;
+                report.add(result);
+                return result;
+            }
+
+            // Same as above for benchmarks that need no fresh state per run.
+            template<typename RunFunction>
+            benchmark_result measure(benchmark_report& report, const benchmark_config& config, const std::string& name,
+                                     std::size_t log_size, RunFunction&& run) {
+                return measure(report, config, name, log_size, []() { return 0; }, [&run](int) { run(); });
+            }
+
+            /**
+             * Fixture of the benchmark test suites, it passes the report and the settings of the module to the
+             * test cases:
+             *   BOOST_FIXTURE_TEST_SUITE(suite_name, benchmark_suite)
+             */
+            struct benchmark_suite {
+                benchmark_report& report = benchmark_fixture::module_report();
+                const benchmark_config& config = benchmark_config::get();
+
+                template<typename... Args>
+                benchmark_result measure(const std::string& name, std::size_t log_size, Args&&... args) {
+                    return bench::measure(report, config, name, log_size, std::forward<Args>(args)...);
+                }
+            };
+
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_BENCH_HARNESS_HPP
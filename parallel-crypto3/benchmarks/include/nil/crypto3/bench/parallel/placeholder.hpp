@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef PARALLEL_CRYPTO3_BENCH_PLACEHOLDER_HPP
+#define PARALLEL_CRYPTO3_BENCH_PLACEHOLDER_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+#include <nil/crypto3/bench/parallel/synthetic_circuit.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace bench {
+
+            // Placeholder with LPC over the Pallas base field with Keccak, as the proof producer uses by default.
+            struct placeholder_benchmark_params {
+                using field_type = algebra::curves::pallas::base_field_type;
+                using hash_type = hashes::keccak_1600<256>;
+                using transcript_type = zk::transcript::fiat_shamir_heuristic_sequential<hash_type>;
+
+                using circuit_params = zk::snark::placeholder_circuit_params<field_type>;
+                using lpc_params_type = zk::commitments::list_polynomial_commitment_params<hash_type, hash_type, 2>;
+                using lpc_type = zk::commitments::list_polynomial_commitment<field_type, lpc_params_type>;
+                using lpc_scheme_type = zk::commitments::lpc_commitment_scheme<lpc_type>;
+                using placeholder_params_type = zk::snark::placeholder_params<circuit_params, lpc_scheme_type>;
+                using policy_type = zk::snark::detail::placeholder_policy<field_type, placeholder_params_type>;
+                using constraint_system_type = typename policy_type::constraint_system_type;
+                using public_preprocessor_type =
+                    zk::snark::placeholder_public_preprocessor<field_type, placeholder_params_type>;
+                using private_preprocessor_type =
+                    zk::snark::placeholder_private_preprocessor<field_type, placeholder_params_type>;
+
+                // Defaults of the proof producer.
+                static constexpr std::size_t lambda = 9;
+                static constexpr std::size_t expand_factor = 2;
+
+                static std::vector<std::uint8_t> init_blob() {
+                    return {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u};
+                }
+            };
+
+            // Synthetic circuit with everything the placeholder prover needs to run on it.
+            struct placeholder_benchmark_circuit {
+                using params = placeholder_benchmark_params;
+                using field_type = typename params::field_type;
+
+                explicit placeholder_benchmark_circuit(std::size_t rows_log)
+                    : circuit(make_synthetic_circuit<field_type>(rows_log))
+                    , desc(circuit.table.witnesses().size(),
+                           circuit.table.public_inputs().size(),
+                           circuit.table.constants().size(),
+                           circuit.table.selectors().size(),
+                           circuit.usable_rows,
+                           circuit.table_rows)
+                    , constraint_system(circuit.gates, circuit.copy_constraints, circuit.lookup_gates,
+                                        circuit.lookup_tables)
+                    , fri_params(1, std::log2(circuit.table_rows), params::lambda, params::expand_factor) {
+                }
+
+                typename params::public_preprocessor_type::preprocessed_data_type
+                    preprocess_public(typename params::lpc_scheme_type& lpc_scheme) const {
+                    return params::public_preprocessor_type::process(
+                        constraint_system, circuit.table.public_table(), desc, lpc_scheme, 0,
+                        algebra::fields::arithmetic_params<field_type>::multiplicative_generator, std::nullopt,
+                        &size_class_cache);
+                }
+
+                typename params::private_preprocessor_type::preprocessed_data_type preprocess_private() const {
+                    return params::private_preprocessor_type::process(
+                        constraint_system, circuit.table.private_table(), desc);
+                }
+
+                synthetic_circuit<field_type> circuit;
+                zk::snark::plonk_table_description<field_type> desc;
+                typename params::constraint_system_type constraint_system;
+                typename params::lpc_type::fri_type::params_type fri_params;
+                // Iterations preprocess the same circuit, so the size class data is computed once.
+                mutable typename params::public_preprocessor_type::size_class_cache size_class_cache;
+            };
+
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_BENCH_PLACEHOLDER_HPP
@@ -0,0 +1,158 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef PARALLEL_CRYPTO3_BENCH_SYNTHETIC_CIRCUIT_HPP
+#define PARALLEL_CRYPTO3_BENCH_SYNTHETIC_CIRCUIT_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/random/mersenne_twister.hpp>
+
+#include <nil/crypto3/random/algebraic_engine.hpp>
+#include <nil/crypto3/random/chacha_field_engine.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/copy_constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/gate.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_gate.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_table.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/padding.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace bench {
+
+            template<typename FieldType>
+            struct synthetic_circuit {
+                std::size_t table_rows;
+                std::size_t usable_rows;
+
+                zk::snark::plonk_assignment_table<FieldType> table;
+
+                std::vector<zk::snark::plonk_gate<FieldType, zk::snark::plonk_constraint<FieldType>>> gates;
+                std::vector<zk::snark::plonk_copy_constraint<FieldType>> copy_constraints;
+                std::vector<zk::snark::plonk_lookup_gate<FieldType, zk::snark::plonk_lookup_constraint<FieldType>>>
+                    lookup_gates;
+                std::vector<zk::snark::plonk_lookup_table<FieldType>> lookup_tables;
+            };
+
+            //---------------------------------------------------------------------------//
+            // Synthetic circuit of 2^rows_log rows, exercising gates, copy constraints and lookups.
+            //  i  | w_0 .. w_{k-1} | w_k  | public | s_gate | s_lookup | s_table | c_0   |
+            //  0  |  p .. p        |  0   |   p    |   0    |    0     |    0    |  0    | -- reserved for lookups
+            //  1  |  x_1           |  b_1 |   0    |   1    |    1     |    1    |  0    |
+            //  2  |  x_2           |  b_2 |   0    |   1    |    1     |    1    |  1    |
+            // ... |                |      |        |        |          |  1 up to row 256  | 255   |
+            // u-1 |  x_{u-1}       |      |   0    |   0    |    1     |    0    |  0    |
+            //
+            // GATE (for each chain column): w_j(+1) = w_j * w_j(-1) + w_j
+            // LOOKUP: w_k is a byte, i.e. in the table c_0
+            // COPY: public(0) = w_j(0) for each chain column
+            //---------------------------------------------------------------------------//
+            template<typename FieldType>
+            synthetic_circuit<FieldType> make_synthetic_circuit(
+                std::size_t rows_log,
+                std::size_t chain_columns = 8,
+                random::algebraic_engine<FieldType> alg_rnd = random::algebraic_engine<FieldType>(),
+                boost::random::mt11213b rnd = boost::random::mt11213b()) {
+
+                using value_type = typename FieldType::value_type;
+                using variable_type = zk::snark::plonk_variable<value_type>;
+                using column_type = zk::snark::plonk_column<FieldType>;
+
+                constexpr std::size_t table_size = 256;
+                // zk_padding fills the rows after the usable ones with random values.
+                constexpr std::size_t blinding_rows = 8;
+
+                synthetic_circuit<FieldType> circuit;
+                circuit.usable_rows = (std::size_t(1) << rows_log) - blinding_rows;
+                BOOST_ASSERT(circuit.usable_rows > table_size + 1);
+
+                const std::size_t byte_column = chain_columns;
+                std::vector<column_type> witnesses(chain_columns + 1, column_type(circuit.usable_rows));
+                std::vector<column_type> public_inputs(1, column_type(circuit.usable_rows));
+                std::vector<column_type> constants(1, column_type(circuit.usable_rows));
+                std::vector<column_type> selectors(3, column_type(circuit.usable_rows));
+
+                value_type public_value = alg_rnd();
+                public_inputs[0][0] = public_value;
+                for (std::size_t j = 0; j < chain_columns; ++j) {
+                    witnesses[j][0] = public_value;
+                    witnesses[j][1] = alg_rnd();
+                    for (std::size_t i = 1; i + 1 < circuit.usable_rows; ++i) {
+                        witnesses[j][i + 1] = witnesses[j][i] * witnesses[j][i - 1] + witnesses[j][i];
+                    }
+                }
+                for (std::size_t i = 1; i < circuit.usable_rows; ++i) {
+                    witnesses[byte_column][i] = rnd() % table_size;
+                    selectors[0][i] = i + 1 < circuit.usable_rows ? 1u : 0u;
+                    selectors[1][i] = 1u;
+                }
+                for (std::size_t i = 1; i <= table_size; ++i) {
+                    selectors[2][i] = 1u;
+                    constants[0][i] = i - 1;
+                }
+
+                circuit.table = zk::snark::plonk_assignment_table<FieldType>(
+                    zk::snark::plonk_private_assignment_table<FieldType>(witnesses),
+                    zk::snark::plonk_public_assignment_table<FieldType>(public_inputs, constants, selectors));
+                circuit.table_rows = zk::snark::zk_padding<FieldType, column_type>(
+                    circuit.table, random::chacha_field_engine<FieldType>(rnd()));
+
+                std::vector<zk::snark::plonk_constraint<FieldType>> chain_constraints;
+                variable_type public_input(0, 0, false, variable_type::column_type::public_input);
+                for (std::size_t j = 0; j < chain_columns; ++j) {
+                    variable_type prev(j, -1, true, variable_type::column_type::witness);
+                    variable_type cur(j, 0, true, variable_type::column_type::witness);
+                    variable_type next(j, 1, true, variable_type::column_type::witness);
+                    chain_constraints.push_back(next - cur * prev - cur);
+
+                    circuit.copy_constraints.push_back(zk::snark::plonk_copy_constraint<FieldType>(
+                        public_input, variable_type(j, 0, false, variable_type::column_type::witness)));
+                }
+                circuit.gates.emplace_back(0, chain_constraints);
+
+                zk::snark::plonk_lookup_constraint<FieldType> byte_constraint;
+                byte_constraint.lookup_input.push_back(
+                    variable_type(byte_column, 0, true, variable_type::column_type::witness));
+                byte_constraint.table_id = 1;
+                circuit.lookup_gates.emplace_back(
+                    1, std::vector<zk::snark::plonk_lookup_constraint<FieldType>> {byte_constraint});
+
+                zk::snark::plonk_lookup_table<FieldType> byte_table(1, 2);
+                byte_table.append_option({variable_type(0, 0, true, variable_type::column_type::constant)});
+                circuit.lookup_tables.push_back(byte_table);
+
+                return circuit;
+            }
+
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_BENCH_SYNTHETIC_CIRCUIT_HPP
@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_fft_benchmark
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/bench/parallel/harness.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::bench;
+
+using field_type = algebra::curves::pallas::base_field_type;
+using value_type = typename field_type::value_type;
+
+BOOST_TEST_GLOBAL_FIXTURE(benchmark_fixture);
+
+BOOST_FIXTURE_TEST_SUITE(parallel_fft_benchmark_suite, benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(fft) {
+    for (std::size_t log_size: config.log_sizes(14, 22)) {
+        std::size_t size = std::size_t(1) << log_size;
+        std::vector<value_type> values(size);
+        for (auto& value: values) {
+            value = algebra::random_element<field_type>();
+        }
+        auto domain = math::make_evaluation_domain<field_type>(size);
+
+        measure("fft", log_size, [&values]() { return values; }, [&domain](auto& a) { domain->fft(a); });
+        measure("inverse_fft", log_size, [&values]() { return values; }, [&domain](auto& a) { domain->inverse_fft(a); });
+    }
+}
+
+// The product of two polynomials of size n is computed on a domain of size 2n, it costs three FFTs.
+BOOST_AUTO_TEST_CASE(polynomial_dfs_multiplication) {
+    for (std::size_t log_size: config.log_sizes(14, 21)) {
+        std::size_t size = std::size_t(1) << log_size;
+        std::vector<value_type> a_values(size), b_values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            a_values[i] = algebra::random_element<field_type>();
+            b_values[i] = algebra::random_element<field_type>();
+        }
+        math::polynomial_dfs<value_type> a(size - 1, a_values), b(size - 1, b_values);
+
+        measure("polynomial_dfs_multiplication", log_size, [&a]() { return a; }, [&b](auto& product) { product *= b; });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
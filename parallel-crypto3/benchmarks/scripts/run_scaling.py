@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Runs the parallel-crypto3 benchmarks with different thread counts.
+
+Each benchmark binary is started once per thread count, the results are merged into one JSON file in the format
+written by the benchmarks. A table of median times, speedups and parallel efficiencies against the smallest thread
+count is printed, and can be saved as CSV for plotting. With --baseline, the results are compared with an earlier
+run and the script exits with 1 if any of them got slower than the threshold allows.
+"""
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import tempfile
+from collections import defaultdict
+
+
+def find_benchmarks(build_dir, names):
+    found = {}
+    for root, _, files in os.walk(build_dir):
+        for file in files:
+            path = os.path.join(root, file)
+            if file.startswith("parallel_") and file.endswith("_benchmark") and os.access(path, os.X_OK):
+                found[file] = path
+    if names:
+        missing = [name for name in names if name not in found]
+        if missing:
+            sys.exit("Benchmarks not found in {}: {}".format(build_dir, ", ".join(missing)))
+        return [found[name] for name in names]
+    return [found[name] for name in sorted(found)]
+
+
+def run_benchmark(path, threads, args):
+    with tempfile.NamedTemporaryFile(suffix=".json", delete=False) as output:
+        output_path = output.name
+    env = dict(os.environ)
+    env["PARALLEL_BENCH_THREADS"] = str(threads)
+    env["PARALLEL_BENCH_OUTPUT"] = output_path
+    env.pop("PARALLEL_BENCH_BASELINE", None)
+    for name, value in (("PARALLEL_BENCH_MIN_LOG_SIZE", args.min_log_size),
+                        ("PARALLEL_BENCH_MAX_LOG_SIZE", args.max_log_size),
+                        ("PARALLEL_BENCH_ITERATIONS", args.iterations)):
+        if value is not None:
+            env[name] = str(value)
+
+    print("=== {} with {} threads".format(os.path.basename(path), threads), flush=True)
+    result = subprocess.run([path], env=env)
+    try:
+        if result.returncode != 0:
+            sys.exit("{} failed with code {}".format(path, result.returncode))
+        with open(output_path) as f:
+            return json.load(f)["results"]
+    finally:
+        os.remove(output_path)
+
+
+def key(result):
+    return result["name"], result["size"], result["threads"]
+
+
+def print_scaling(results, csv_path):
+    series = defaultdict(dict)
+    for result in results:
+        series[(result["name"], result["size"])][result["threads"]] = result["median_ms"]
+
+    rows = []
+    print("\n{:<40} {:>5} {:>8} {:>14} {:>9} {:>11}".format(
+        "benchmark", "size", "threads", "median ms", "speedup", "efficiency"))
+    for (name, size), times in sorted(series.items()):
+        base_threads = min(times)
+        for threads, median in sorted(times.items()):
+            speedup = times[base_threads] / median if median > 0 else 0
+            efficiency = speedup * base_threads / threads
+            rows.append([name, size, threads, median, speedup, efficiency])
+            print("{:<40} {:>5} {:>8} {:>14.3f} {:>9.2f} {:>10.0%}".format(
+                name, "2^{}".format(size), threads, median, speedup, efficiency))
+
+    if csv_path:
+        with open(csv_path, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(["name", "log_size", "threads", "median_ms", "speedup", "efficiency"])
+            writer.writerows(rows)
+
+
+def compare(results, baseline_path, threshold):
+    with open(baseline_path) as f:
+        baseline = {key(result): result["median_ms"] for result in json.load(f)["results"]}
+
+    regressions = 0
+    print("\n{:<40} {:>5} {:>8} {:>14} {:>14} {:>8}".format(
+        "benchmark", "size", "threads", "baseline ms", "current ms", "change"))
+    for result in sorted(results, key=key):
+        if key(result) not in baseline:
+            continue
+        before, after = baseline[key(result)], result["median_ms"]
+        change = after / before - 1 if before > 0 else 0
+        regressed = change > threshold
+        regressions += regressed
+        print("{:<40} {:>5} {:>8} {:>14.3f} {:>14.3f} {:>+7.1%}{}".format(
+            result["name"], "2^{}".format(result["size"]), result["threads"], before, after, change,
+            "  REGRESSION" if regressed else ""))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--build-dir", required=True, help="build directory with the benchmark binaries")
+    parser.add_argument("--benchmarks", nargs="*", default=[],
+                        help="binaries to run, e.g. parallel_math_fft_benchmark, all of them by default")
+    parser.add_argument("--threads", default="1,2,4,8",
+                        help="comma separated thread counts (default: %(default)s)")
+    parser.add_argument("--min-log-size", type=int, help="overrides the smallest input size (log2) of all benchmarks")
+    parser.add_argument("--max-log-size", type=int, help="overrides the largest input size (log2) of all benchmarks")
+    parser.add_argument("--iterations", type=int, help="measured runs per size")
+    parser.add_argument("--output", default="parallel_benchmarks.json", help="merged results (default: %(default)s)")
+    parser.add_argument("--csv", help="writes the scaling table as CSV")
+    parser.add_argument("--baseline", help="results of an earlier run to compare with")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="allowed slowdown against the baseline (default: %(default)s)")
+    args = parser.parse_args()
+
+    thread_counts = [int(threads) for threads in args.threads.split(",")]
+    results = []
+    for path in find_benchmarks(args.build_dir, args.benchmarks):
+        for threads in thread_counts:
+            results.extend(run_benchmark(path, threads, args))
+
+    with open(args.output, "w") as f:
+        json.dump({"metadata": {"threads": args.threads}, "results": results}, f, indent=1)
+
+    print_scaling(results, args.csv)
+
+    if args.baseline:
+        regressions = compare(results, args.baseline, args.threshold)
+        if regressions:
+            print("\n{} benchmarks regressed by more than {:.0%}".format(regressions, args.threshold))
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_fri_benchmark
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+#include <nil/crypto3/bench/parallel/harness.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::bench;
+
+BOOST_TEST_GLOBAL_FIXTURE(benchmark_fixture);
+
+using field_type = algebra::curves::pallas::base_field_type;
+using value_type = typename field_type::value_type;
+using hash_type = hashes::keccak_1600<256>;
+using fri_type = zk::commitments::fri<field_type, hash_type, hash_type, 2>;
+using polynomial_type = math::polynomial_dfs<value_type>;
+using transcript_type = zk::transcript::fiat_shamir_heuristic_sequential<hash_type>;
+
+// Defaults of the proof producer.
+constexpr std::size_t lambda = 9;
+constexpr std::size_t expand_factor = 2;
+
+BOOST_FIXTURE_TEST_SUITE(parallel_fri_benchmark_suite, benchmark_suite)
+
+// The initial precommitment, then the commit phase (folding and committing the folded polynomials) and the query
+// phase of the FRI proof of a random polynomial of degree 2^log_size - 1.
+BOOST_AUTO_TEST_CASE(fri_phases) {
+    const std::vector<std::uint8_t> init_blob {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u};
+
+    for (std::size_t log_size: config.log_sizes(14, 20)) {
+        typename fri_type::params_type fri_params(1, log_size, lambda, expand_factor);
+
+        std::vector<value_type> coefficients(std::size_t(1) << log_size);
+        for (auto& coefficient: coefficients) {
+            coefficient = algebra::random_element<field_type>();
+        }
+        polynomial_type f;
+        f.from_coefficients(coefficients);
+        f.resize(fri_params.D[0]->size(), nullptr, fri_params.D[0]);
+
+        measure("fri/precommit", log_size, [&]() {
+            zk::algorithms::precommit<fri_type>(f, fri_params.D[0], fri_params.step_list[0]);
+        });
+
+        auto tree = zk::algorithms::precommit<fri_type>(f, fri_params.D[0], fri_params.step_list[0]);
+
+        measure("fri/commit_phase", log_size,
+            [&]() { return transcript_type(init_blob); },
+            [&](transcript_type& transcript) {
+                zk::algorithms::commit_phase<fri_type, polynomial_type>(f, tree, fri_params, transcript);
+            });
+
+        // The query phase needs the folded polynomials and trees of the commit phase.
+        using commit_phase_result = std::tuple<std::vector<polynomial_type>,
+                                               std::vector<typename fri_type::precommitment_type>,
+                                               typename fri_type::commitments_part_of_proof>;
+        struct query_phase_input {
+            transcript_type transcript;
+            commit_phase_result commit_result;
+        };
+
+        const std::map<std::size_t, typename fri_type::precommitment_type> precommitments {{0, tree}};
+        const std::map<std::size_t, std::vector<polynomial_type>> g {{0, {f}}};
+
+        measure("fri/query_phase", log_size,
+            [&]() {
+                query_phase_input input {transcript_type(init_blob), {}};
+                input.commit_result = zk::algorithms::commit_phase<fri_type, polynomial_type>(
+                    f, tree, fri_params, input.transcript);
+                return input;
+            },
+            [&](query_phase_input& input) {
+                const auto& [fs, fri_trees, commitments_proof] = input.commit_result;
+                auto query_proofs = zk::algorithms::query_phase<fri_type, polynomial_type>(
+                    precommitments, fri_params, input.transcript, g, fri_trees, fs,
+                    commitments_proof.final_polynomial);
+                BOOST_CHECK(query_proofs.size() == lambda);
+            });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_lpc_benchmark
+
+#include <memory>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+#include <nil/crypto3/bench/parallel/harness.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::bench;
+
+BOOST_TEST_GLOBAL_FIXTURE(benchmark_fixture);
+
+using field_type = algebra::curves::pallas::base_field_type;
+using value_type = typename field_type::value_type;
+using hash_type = hashes::keccak_1600<256>;
+using lpc_params_type = zk::commitments::list_polynomial_commitment_params<hash_type, hash_type, 2>;
+using lpc_type = zk::commitments::list_polynomial_commitment<field_type, lpc_params_type>;
+using lpc_scheme_type = zk::commitments::lpc_commitment_scheme<lpc_type>;
+using polynomial_type = math::polynomial_dfs<value_type>;
+using transcript_type = zk::transcript::fiat_shamir_heuristic_sequential<hash_type>;
+
+// Defaults of the proof producer.
+constexpr std::size_t lambda = 9;
+constexpr std::size_t expand_factor = 2;
+// About the number of witness columns of a small circuit.
+constexpr std::size_t batch_size = 16;
+
+std::vector<polynomial_type> generate_batch(std::size_t log_size) {
+    std::vector<polynomial_type> batch;
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        std::vector<value_type> values(std::size_t(1) << log_size);
+        for (auto& value: values) {
+            value = algebra::random_element<field_type>();
+        }
+        batch.emplace_back(values.size() - 1, values);
+    }
+    return batch;
+}
+
+BOOST_FIXTURE_TEST_SUITE(parallel_lpc_benchmark_suite, benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(lpc_commit_and_proof_eval) {
+    const std::vector<std::uint8_t> init_blob {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u};
+
+    for (std::size_t log_size: config.log_sizes(14, 20)) {
+        typename lpc_type::fri_type::params_type fri_params(1, log_size, lambda, expand_factor);
+        const std::vector<polynomial_type> batch = generate_batch(log_size);
+        const value_type point = algebra::random_element<field_type>();
+
+        auto make_scheme = [&]() {
+            auto scheme = std::make_unique<lpc_scheme_type>(fri_params);
+            scheme->append_to_batch(0, batch);
+            return scheme;
+        };
+
+        measure("lpc/commit", log_size, make_scheme, [](std::unique_ptr<lpc_scheme_type>& scheme) {
+            scheme->commit(0);
+        });
+
+        measure("lpc/proof_eval", log_size,
+            [&]() {
+                auto scheme = make_scheme();
+                scheme->commit(0);
+                scheme->append_eval_point(0, point);
+                return scheme;
+            },
+            [&](std::unique_ptr<lpc_scheme_type>& scheme) {
+                transcript_type transcript(init_blob);
+                scheme->proof_eval(transcript);
+            });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
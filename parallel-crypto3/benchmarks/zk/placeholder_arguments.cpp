@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_placeholder_arguments_benchmark
+
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/lookup_argument.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/permutation_argument.hpp>
+
+#include <nil/crypto3/bench/parallel/harness.hpp>
+#include <nil/crypto3/bench/parallel/placeholder.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::bench;
+
+BOOST_TEST_GLOBAL_FIXTURE(benchmark_fixture);
+
+using params = placeholder_benchmark_params;
+using field_type = typename params::field_type;
+using value_type = typename field_type::value_type;
+using lpc_scheme_type = typename params::lpc_scheme_type;
+using transcript_type = typename params::transcript_type;
+
+// The arguments add their polynomials to the commitment scheme, so each run gets a copy of the preprocessed one.
+struct argument_state {
+    lpc_scheme_type lpc_scheme;
+    transcript_type transcript;
+};
+
+BOOST_FIXTURE_TEST_SUITE(parallel_placeholder_arguments_benchmark_suite, benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(placeholder_arguments) {
+    for (std::size_t rows_log: config.log_sizes(14, 18)) {
+        placeholder_benchmark_circuit bench_circuit(rows_log);
+
+        lpc_scheme_type lpc_scheme(bench_circuit.fri_params);
+        auto public_data = bench_circuit.preprocess_public(lpc_scheme);
+        auto private_data = bench_circuit.preprocess_private();
+        zk::snark::plonk_polynomial_dfs_table<field_type> polynomial_table(
+            private_data.private_polynomial_table, public_data.public_polynomial_table);
+
+        auto make_state = [&]() {
+            return argument_state {lpc_scheme, transcript_type(params::init_blob())};
+        };
+
+        measure("placeholder/permutation_argument", rows_log, make_state, [&](argument_state& state) {
+            zk::snark::placeholder_permutation_argument<field_type, params::placeholder_params_type>::prove_eval(
+                bench_circuit.constraint_system, public_data, bench_circuit.desc, polynomial_table,
+                state.lpc_scheme, state.transcript);
+        });
+
+        measure("placeholder/lookup_argument", rows_log, make_state, [&](argument_state& state) {
+            zk::snark::placeholder_lookup_argument_prover<field_type, lpc_scheme_type,
+                                                          params::placeholder_params_type>
+                lookup_prover(bench_circuit.constraint_system, public_data, polynomial_table, state.lpc_scheme,
+                              state.transcript);
+            lookup_prover.prove_eval();
+        });
+
+        math::polynomial_dfs<value_type> mask_polynomial(
+            0, public_data.common_data.basic_domain->m, value_type::one());
+        mask_polynomial -= public_data.q_last;
+        mask_polynomial -= public_data.q_blind;
+
+        measure("placeholder/gates_argument", rows_log, make_state, [&](argument_state& state) {
+            zk::snark::placeholder_gates_argument<field_type, params::placeholder_params_type>::prove_eval(
+                bench_circuit.constraint_system, polynomial_table, public_data.common_data.basic_domain,
+                public_data.common_data.max_gates_degree, mask_polynomial, public_data.common_data.lagrange_0,
+                state.transcript);
+        });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallel_placeholder_prover_benchmark
+
+#include <memory>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
+
+#include <nil/crypto3/bench/parallel/harness.hpp>
+#include <nil/crypto3/bench/parallel/placeholder.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::bench;
+
+BOOST_TEST_GLOBAL_FIXTURE(benchmark_fixture);
+
+using params = placeholder_benchmark_params;
+using field_type = typename params::field_type;
+using lpc_scheme_type = typename params::lpc_scheme_type;
+using prover_type = zk::snark::placeholder_prover<field_type, params::placeholder_params_type>;
+using verifier_type = zk::snark::placeholder_verifier<field_type, params::placeholder_params_type>;
+
+BOOST_FIXTURE_TEST_SUITE(parallel_placeholder_prover_benchmark_suite, benchmark_suite)
+
+// End-to-end proof generation for synthetic circuits of 2^14 to 2^22 rows, the default range stops at 2^18 to keep
+// the run short, set PARALLEL_BENCH_MAX_LOG_SIZE=22 for the full range.
+BOOST_AUTO_TEST_CASE(placeholder_prover) {
+    for (std::size_t rows_log: config.log_sizes(14, 18)) {
+        placeholder_benchmark_circuit bench_circuit(rows_log);
+
+        measure("placeholder/preprocessor", rows_log, [&]() {
+            lpc_scheme_type lpc_scheme(bench_circuit.fri_params);
+            bench_circuit.preprocess_public(lpc_scheme);
+            bench_circuit.preprocess_private();
+        });
+
+        struct prover_input {
+            std::unique_ptr<lpc_scheme_type> lpc_scheme;
+            typename params::public_preprocessor_type::preprocessed_data_type public_data;
+            typename params::private_preprocessor_type::preprocessed_data_type private_data;
+        };
+
+        measure("placeholder/prover", rows_log,
+            [&]() {
+                auto lpc_scheme = std::make_unique<lpc_scheme_type>(bench_circuit.fri_params);
+                auto public_data = bench_circuit.preprocess_public(*lpc_scheme);
+                return prover_input {std::move(lpc_scheme), std::move(public_data), bench_circuit.preprocess_private()};
+            },
+            [&](prover_input& input) {
+                prover_type::process(input.public_data, std::move(input.private_data), bench_circuit.desc,
+                                     bench_circuit.constraint_system, *input.lpc_scheme);
+            });
+    }
+}
+
+// The timings are meaningless if the synthetic circuit is not satisfied, checked once on the smallest size.
+BOOST_AUTO_TEST_CASE(synthetic_circuit_proof_verifies) {
+    placeholder_benchmark_circuit bench_circuit(config.log_sizes(14, 14).front());
+
+    lpc_scheme_type lpc_scheme(bench_circuit.fri_params);
+    auto public_data = bench_circuit.preprocess_public(lpc_scheme);
+    auto proof = prover_type::process(public_data, bench_circuit.preprocess_private(), bench_circuit.desc,
+                                      bench_circuit.constraint_system, lpc_scheme);
+
+    lpc_scheme_type verifier_lpc_scheme(bench_circuit.fri_params);
+    BOOST_CHECK(verifier_type::process(public_data.common_data, proof, bench_circuit.desc,
+                                       bench_circuit.constraint_system, verifier_lpc_scheme));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,8 @@
 #define CRYPTO3_MERKLE_PROOF_HPP
 
 #include <algorithm>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <stack>
 
@@ -53,6 +55,53 @@ namespace nil {
         }    // namespace marshalling
         namespace containers {
             namespace detail {
+                /**
+                 * Nodes of one merkle tree which are already known to lead to its root. Proofs of several leaves of the
+                 * same tree share the upper part of their paths, once a path reaches a known node the rest of it
+                 * doesn't need to be hashed again. Can be shared between threads validating proofs concurrently.
+                 */
+                template<typename ValueType>
+                class merkle_verified_nodes {
+                public:
+                    typedef ValueType value_type;
+
+                    explicit merkle_verified_nodes(const value_type &root) : _root(root) {
+                    }
+
+                    const value_type &root() const {
+                        return _root;
+                    }
+
+                    // Checks if the node with hash 'd' on the given layer, counted from the leaves, is known.
+                    bool contains(std::size_t layer, const value_type &d) const {
+                        std::shared_lock<std::shared_mutex> lock(_mutex);
+                        if (layer >= _layers.size()) {
+                            return false;
+                        }
+                        return std::find(_layers[layer].begin(), _layers[layer].end(), d) != _layers[layer].end();
+                    }
+
+                    // Remembers the nodes of a path which was checked against the root, 'hashes[i]' is on layer i.
+                    void insert(const std::vector<value_type> &hashes) {
+                        std::unique_lock<std::shared_mutex> lock(_mutex);
+                        if (_layers.size() < hashes.size()) {
+                            _layers.resize(hashes.size());
+                        }
+                        for (std::size_t layer = 0; layer < hashes.size(); ++layer) {
+                            if (std::find(_layers[layer].begin(), _layers[layer].end(), hashes[layer]) ==
+                                _layers[layer].end()) {
+                                _layers[layer].push_back(hashes[layer]);
+                            }
+                        }
+                    }
+
+                private:
+                    value_type _root;
+                    // Few proofs are validated against one tree, so a linear search over a layer is fast enough.
+                    std::vector<std::vector<value_type>> _layers;
+                    mutable std::shared_mutex _mutex;
+                };
+
                 template<typename NodeType, std::size_t Arity = 2>
                 class merkle_proof_impl {
                 public:
@@ -146,6 +195,43 @@ namespace nil {
                         return (d == _root);
                     }
 
+                    typedef merkle_verified_nodes<value_type> verified_nodes_type;
+
+                    /**
+                     * Same as 'validate', but stops as soon as the path reaches a node which is already known to lead
+                     * to the root of the tree. The nodes of a successfully validated path are added to 'verified'.
+                     */
+                    template<typename Hashable>
+                    bool validate(const Hashable &a, verified_nodes_type &verified) const {
+                        if (_root != verified.root()) {
+                            return validate(a);
+                        }
+                        std::vector<value_type> hashes;
+                        hashes.reserve(_path.size());
+                        value_type d = crypto3::hash<hash_type>(a);
+                        for (auto &it : _path) {
+                            if (verified.contains(hashes.size(), d)) {
+                                return true;
+                            }
+                            hashes.push_back(d);
+                            accumulator_set<hash_type> acc;
+                            size_t i = 0;
+                            for (; (i < arity - 1) && i == it[i]._position; ++i) {
+                                crypto3::hash<hash_type>(it[i]._hash, acc);
+                            }
+                            crypto3::hash<hash_type>(d, acc);
+                            for (; i < arity - 1; ++i) {
+                                crypto3::hash<hash_type>(it[i]._hash, acc);
+                            }
+                            d = accumulators::extract::hash<hash_type>(acc);
+                        }
+                        if (d != _root) {
+                            return false;
+                        }
+                        verified.insert(hashes);
+                        return true;
+                    }
+
                     static std::vector<merkle_proof_impl>
                         generate_compressed_proofs(const containers::merkle_tree<NodeType, Arity> &tree,
                                                     std::vector<std::size_t> leaf_idxs) {
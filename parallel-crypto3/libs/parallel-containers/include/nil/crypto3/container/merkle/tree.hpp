@@ -29,6 +29,8 @@
 
 #include <vector>
 #include <cmath>
+#include <climits>
+#include <iterator>
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
@@ -37,6 +39,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_batch.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -489,12 +492,25 @@ namespace nil {
                     typedef typename node_type::value_type value_type;
                     typedef typename std::iterator_traits<LeafIterator>::value_type leaf_value_type;
 
+                    // Hashes with a multi-buffer backend get whole chunks of a row at once: leaves stored as
+                    // byte containers and internal nodes, whose children are Arity consecutive digests.
+                    constexpr static const bool batch_rows = hashes::detail::batch_hash_impl<hash_type>::multi_buffer;
+
                     merkle_tree_impl<T, Arity> ret(std::distance(first, last));
                     ret.resize(ret.complete_size());
 
-                    nil::crypto3::parallel_transform(first, last, ret.begin(), [](const leaf_value_type& leaf) {
-                        return static_cast<value_type>(crypto3::hash<hash_type>(leaf));
-                    });
+                    if constexpr (batch_rows && hashes::detail::is_contiguous_byte_range<leaf_value_type>::value) {
+                        nil::crypto3::wait_for_all(nil::crypto3::parallel_run_in_chunks<void>(
+                            std::distance(first, last),
+                            [first, &ret](std::size_t begin, std::size_t end) {
+                                hash_batch<hash_type>(std::next(first, begin), std::next(first, end),
+                                                      ret.begin() + begin);
+                            }));
+                    } else {
+                        nil::crypto3::parallel_transform(first, last, ret.begin(), [](const leaf_value_type& leaf) {
+                            return static_cast<value_type>(crypto3::hash<hash_type>(leaf));
+                        });
+                    }
 
                     std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
                     typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
@@ -502,10 +518,22 @@ namespace nil {
                     std::size_t next_row_start_index = std::distance(first, last);
 
                     for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        nil::crypto3::parallel_for(0, row_size, [&ret, it, next_row_start_index](std::size_t index) {
-                            ret[next_row_start_index + index] = generate_hash<hash_type>(
-                                it + index * Arity, it + (index + 1) * Arity);
-                        });
+                        if constexpr (batch_rows) {
+                            static_assert(sizeof(value_type) * CHAR_BIT == node_type::value_bits,
+                                          "digests must be stored without padding");
+                            nil::crypto3::wait_for_all(nil::crypto3::parallel_run_in_chunks<void>(
+                                row_size,
+                                [&ret, it, next_row_start_index](std::size_t begin, std::size_t end) {
+                                    hash_batch<hash_type>((it + begin * Arity)->data(), Arity * sizeof(value_type),
+                                                          end - begin, ret.begin() + next_row_start_index + begin);
+                                }));
+                        } else {
+                            nil::crypto3::parallel_for(
+                                0, row_size, [&ret, it, next_row_start_index](std::size_t index) {
+                                    ret[next_row_start_index + index] = generate_hash<hash_type>(
+                                        it + index * Arity, it + (index + 1) * Arity);
+                                });
+                        }
                         next_row_start_index += row_size;
                         it += row_size * Arity;
                     }
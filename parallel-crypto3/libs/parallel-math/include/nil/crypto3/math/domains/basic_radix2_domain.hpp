@@ -35,6 +35,7 @@
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
+#include <nil/crypto3/bench/tracer.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -82,6 +83,7 @@ namespace nil {
                 }
 
                 void fft(std::vector<value_type> &a) override {
+                    TRACE_SCOPE_ARG("FFT", "size", this->m);
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -94,6 +96,7 @@ namespace nil {
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
+                    TRACE_SCOPE_ARG("inverse FFT", "size", this->m);
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
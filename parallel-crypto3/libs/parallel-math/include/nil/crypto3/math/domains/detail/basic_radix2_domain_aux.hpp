@@ -32,6 +32,7 @@
 #include <vector>
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/batch_operations.hpp>
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
@@ -105,6 +106,18 @@ namespace nil {
                             [&a, m, count_k, inc, &omega_cache](std::size_t begin, std::size_t end) {
                                 size_t current_index = begin;
                                 size_t start_k = begin / m;
+                                if constexpr (algebra::fields::is_goldilocks64_element<value_type>) {
+                                    // Butterflies of each group are done in blocks by the vectorized kernels.
+                                    for (std::size_t k_index = start_k; k_index < count_k && k_index * m < end; ++k_index) {
+                                        std::size_t k = k_index * 2 * m;
+                                        std::size_t j_begin = (start_k == k_index) ? (begin % m) : 0;
+                                        std::size_t j_end = std::min(m, end - k_index * m);
+                                        algebra::fields::goldilocks64_batch_operations::butterfly(
+                                            &a[k + j_begin], &a[k + j_begin + m], &omega_cache[j_begin * inc], inc,
+                                            j_end - j_begin);
+                                    }
+                                    return;
+                                }
                                 value_type t;
                                 for (std::size_t k_index = start_k; k_index < count_k; ++k_index) {
                                     std::size_t k = k_index * 2 * m;
@@ -0,0 +1,209 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_BARYCENTRIC_EVALUATION_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_BARYCENTRIC_EVALUATION_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Weights of the barycentric formula for a polynomial of degree less than n given by its values on the
+             * radix-2 domain {omega^i} of size n:
+             *     p(x) = sum_i w_i * p(omega^i),    w_i = (x^n - 1) / n * omega^i / (x - omega^i).
+             * The weights depend only on n and x, so once computed they evaluate any number of polynomials at x with a
+             * single dot product each, without converting them to coefficients. If x is on the domain, the value of
+             * the polynomial is taken from the corresponding point.
+             */
+            template<typename FieldValueType>
+            class barycentric_weights {
+            public:
+                typedef FieldValueType value_type;
+                typedef typename value_type::field_type field_type;
+
+                barycentric_weights(std::size_t domain_size, const value_type& point)
+                    : _point(point), _domain_size(domain_size), _domain_index(not_in_domain) {
+                    const value_type omega = unity_root<field_type>(domain_size);
+                    const value_type point_pow_n = point.pow(domain_size);
+
+                    if (point_pow_n == value_type::one()) {
+                        find_domain_index(omega);
+                        return;
+                    }
+
+                    const value_type factor = (point_pow_n - value_type::one()) * value_type(domain_size).inversed();
+                    _weights.resize(domain_size);
+
+                    // Each chunk computes its powers of omega and inverts all its denominators with a single
+                    // inversion, using the prefix products of the denominators.
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        domain_size,
+                        [this, &omega, &factor](std::size_t begin, std::size_t end) {
+                            std::vector<value_type> powers(end - begin);
+                            value_type omega_power = omega.pow(begin);
+                            value_type prefix = value_type::one();
+                            for (std::size_t i = begin; i < end; ++i) {
+                                powers[i - begin] = omega_power;
+                                _weights[i] = prefix;
+                                prefix *= _point - omega_power;
+                                omega_power *= omega;
+                            }
+                            value_type inverse = prefix.inversed();
+                            for (std::size_t i = end; i-- > begin;) {
+                                const value_type denominator = _point - powers[i - begin];
+                                _weights[i] *= inverse;
+                                inverse *= denominator;
+                                _weights[i] *= factor * powers[i - begin];
+                            }
+                        }));
+                }
+
+                std::size_t size() const {
+                    return _domain_size;
+                }
+
+                const value_type& point() const {
+                    return _point;
+                }
+
+                // Evaluates the polynomial with values [first, last) on the domain at the point of the weights.
+                template<typename InputIterator>
+                value_type evaluate(InputIterator first, InputIterator last) const {
+                    BOOST_ASSERT(std::size_t(std::distance(first, last)) == _domain_size);
+
+                    if (_domain_index != not_in_domain) {
+                        return *std::next(first, _domain_index);
+                    }
+
+                    std::vector<value_type> partial_sums = wait_for_all(parallel_run_in_chunks<value_type>(
+                        _domain_size,
+                        [this, first](std::size_t begin, std::size_t end) {
+                            value_type sum = value_type::zero();
+                            auto it = std::next(first, begin);
+                            for (std::size_t i = begin; i < end; ++i, ++it) {
+                                sum += _weights[i] * *it;
+                            }
+                            return sum;
+                        }));
+
+                    value_type result = value_type::zero();
+                    for (const auto& sum: partial_sums) {
+                        result += sum;
+                    }
+                    return result;
+                }
+
+                template<typename ContiguousContainer>
+                value_type evaluate(const ContiguousContainer& values) const {
+                    return evaluate(values.begin(), values.end());
+                }
+
+            private:
+                constexpr static const std::size_t not_in_domain = std::numeric_limits<std::size_t>::max();
+
+                void find_domain_index(const value_type& omega) {
+                    std::atomic<std::size_t> domain_index = not_in_domain;
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        _domain_size,
+                        [this, &omega, &domain_index](std::size_t begin, std::size_t end) {
+                            value_type omega_power = omega.pow(begin);
+                            for (std::size_t i = begin; i < end; ++i) {
+                                if (omega_power == _point) {
+                                    domain_index = i;
+                                    return;
+                                }
+                                omega_power *= omega;
+                            }
+                        }));
+                    _domain_index = domain_index;
+                    BOOST_ASSERT(_domain_index != not_in_domain);
+                }
+
+                value_type _point;
+                std::size_t _domain_size;
+                std::size_t _domain_index;
+                std::vector<value_type> _weights;
+            };
+
+            /**
+             * Evaluates a batch of polynomials in DFS form at the given points. The weights are computed once for each
+             * distinct pair of polynomial size and point, the dot products run in parallel for all the polynomials.
+             * \param points For each polynomial, the points to evaluate it at.
+             * \returns For each polynomial, its values at its points.
+             */
+            template<typename PolynomialDFSType>
+            std::vector<std::vector<typename PolynomialDFSType::value_type>> evaluate_barycentric(
+                    const std::vector<PolynomialDFSType>& polys,
+                    const std::vector<std::vector<typename PolynomialDFSType::value_type>>& points,
+                    ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::HIGH) {
+                typedef typename PolynomialDFSType::value_type value_type;
+                BOOST_ASSERT(polys.size() == points.size());
+
+                // Few distinct points are used in a batch, a linear search over them is cheaper than hashing.
+                std::vector<barycentric_weights<value_type>> weights;
+                std::vector<std::vector<std::size_t>> weight_indices(polys.size());
+                for (std::size_t i = 0; i < polys.size(); ++i) {
+                    for (const auto& point: points[i]) {
+                        std::size_t w = 0;
+                        while (w < weights.size() &&
+                               (weights[w].size() != polys[i].size() || weights[w].point() != point)) {
+                            ++w;
+                        }
+                        if (w == weights.size()) {
+                            weights.emplace_back(polys[i].size(), point);
+                        }
+                        weight_indices[i].push_back(w);
+                    }
+                }
+
+                std::vector<std::vector<value_type>> result(polys.size());
+                parallel_for(0, polys.size(), [&polys, &weights, &weight_indices, &result](std::size_t i) {
+                    result[i].reserve(weight_indices[i].size());
+                    for (std::size_t w: weight_indices[i]) {
+                        result[i].push_back(weights[w].evaluate(polys[i].begin(), polys[i].end()));
+                    }
+                }, pool_id);
+                return result;
+            }
+
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_BARYCENTRIC_EVALUATION_HPP
@@ -27,15 +27,317 @@
 #ifndef CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 #define CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace math {
-            // Default implementation according to Wikipedia
-            // https://en.wikipedia.org/wiki/Lagrange_polynomial
+            namespace detail {
+
+                // Below this number of points the quadratic algorithms are faster than the subproduct tree.
+                constexpr static const std::size_t subproduct_tree_min_points = 64;
+
+                // Products and remainders of polynomials shorter than this are computed by the schoolbook
+                // algorithms, FFT does not pay off for them.
+                constexpr static const std::size_t subproduct_tree_schoolbook_size = 32;
+
+                // The remainder tree stops at nodes with at most this many points and evaluates the remainders there
+                // by the Horner scheme.
+                constexpr static const std::size_t subproduct_tree_leaf_points = 32;
+
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_multiply(const std::vector<FieldValueType> &a,
+                                                                const std::vector<FieldValueType> &b) {
+                    std::vector<FieldValueType> c;
+                    if (std::min(a.size(), b.size()) < subproduct_tree_schoolbook_size) {
+                        c.resize(a.size() + b.size() - 1, FieldValueType::zero());
+                        for (std::size_t i = 0; i < a.size(); ++i) {
+                            for (std::size_t j = 0; j < b.size(); ++j) {
+                                c[i + j] += a[i] * b[j];
+                            }
+                        }
+                    } else {
+                        multiplication(c, a, b);
+                    }
+                    return c;
+                }
+
+                /**
+                 * Computes g such that f * g = 1 mod x^n by the Newton iteration g = g * (2 - f * g), which doubles
+                 * the number of correct coefficients of g on each step. f[0] must be invertible.
+                 */
+                template<typename FieldValueType>
+                std::vector<FieldValueType> power_series_inverse(const std::vector<FieldValueType> &f, std::size_t n) {
+                    const FieldValueType two = FieldValueType::one() + FieldValueType::one();
+
+                    std::vector<FieldValueType> g = {f[0].inversed()};
+                    for (std::size_t k = 1; k < n;) {
+                        k = std::min(2 * k, n);
+                        std::vector<FieldValueType> f_k(f.begin(), f.begin() + std::min(k, f.size()));
+                        std::vector<FieldValueType> e = subproduct_multiply(f_k, g);
+                        e.resize(k, FieldValueType::zero());
+                        for (auto &coeff : e) {
+                            coeff = -coeff;
+                        }
+                        e[0] += two;
+                        g = subproduct_multiply(g, e);
+                        g.resize(k, FieldValueType::zero());
+                    }
+                    return g;
+                }
+
+                /**
+                 * Remainder of the division of a by b. For large operands the quotient is found as the reversed
+                 * product rev(a) * rev(b)^{-1} mod x^{deg a - deg b + 1}, so the division costs a few FFT
+                 * multiplications instead of the quadratic long division.
+                 */
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_remainder(const std::vector<FieldValueType> &a,
+                                                                 const std::vector<FieldValueType> &b) {
+                    const std::size_t d = b.size() - 1;
+                    if (d == 0) {
+                        return {FieldValueType::zero()};
+                    }
+                    if (a.size() <= d) {
+                        return a;
+                    }
+
+                    const std::size_t quotient_size = a.size() - d;
+                    std::vector<FieldValueType> r;
+                    if (std::min(quotient_size, d) < subproduct_tree_schoolbook_size) {
+                        const FieldValueType lead_inverse = b.back().inversed();
+                        r = a;
+                        for (std::size_t i = r.size(); i-- > d;) {
+                            const FieldValueType factor = r[i] * lead_inverse;
+                            for (std::size_t j = 0; j < d; ++j) {
+                                r[i - d + j] -= factor * b[j];
+                            }
+                        }
+                        r.resize(d);
+                    } else {
+                        std::vector<FieldValueType> a_reversed(a.rbegin(), a.rbegin() + quotient_size);
+                        std::vector<FieldValueType> b_reversed(b.rbegin(),
+                                                               b.rbegin() + std::min(b.size(), quotient_size));
+
+                        std::vector<FieldValueType> q =
+                            subproduct_multiply(a_reversed, power_series_inverse(b_reversed, quotient_size));
+                        q.resize(quotient_size, FieldValueType::zero());
+                        std::reverse(q.begin(), q.end());
+
+                        const std::vector<FieldValueType> qb = subproduct_multiply(q, b);
+                        r.assign(a.begin(), a.begin() + d);
+                        for (std::size_t i = 0; i < d && i < qb.size(); ++i) {
+                            r[i] -= qb[i];
+                        }
+                    }
+                    condense(r);
+                    return r;
+                }
+
+                /**
+                 * Subproduct tree over the points x_0, ..., x_{n-1}. Leaves are the polynomials x - x_i, every inner
+                 * node is the product of its two children, a node without a pair is carried to the next level as is.
+                 * Node j of level l covers the points [j * 2^l, (j + 1) * 2^l), the root is prod_i (x - x_i).
+                 * See [von zur Gathen, Gerhard. Modern Computer Algebra, section 10.1].
+                 */
+                template<typename FieldValueType>
+                class subproduct_tree {
+                public:
+                    typedef FieldValueType value_type;
+                    typedef std::vector<value_type> coefficients_type;
+
+                    explicit subproduct_tree(const std::vector<value_type> &points) : _points(points) {
+                        BOOST_ASSERT(!_points.empty());
+
+                        std::vector<coefficients_type> level;
+                        level.reserve(_points.size());
+                        for (const auto &point : _points) {
+                            level.push_back({-point, value_type::one()});
+                        }
+                        _levels.push_back(std::move(level));
+
+                        while (_levels.back().size() > 1) {
+                            const std::vector<coefficients_type> &lower = _levels.back();
+                            std::vector<coefficients_type> upper((lower.size() + 1) / 2);
+                            for (std::size_t j = 0; j < upper.size(); ++j) {
+                                upper[j] = 2 * j + 1 < lower.size() ?
+                                               subproduct_multiply(lower[2 * j], lower[2 * j + 1]) :
+                                               lower[2 * j];
+                            }
+                            _levels.push_back(std::move(upper));
+                        }
+                    }
+
+                    std::size_t size() const {
+                        return _points.size();
+                    }
+
+                    const std::vector<value_type> &points() const {
+                        return _points;
+                    }
+
+                    // prod_i (x - x_i)
+                    const coefficients_type &root() const {
+                        return _levels.back()[0];
+                    }
+
+                    /**
+                     * Evaluates the polynomial at all the points of the tree. The polynomial is reduced modulo the
+                     * root and then modulo the nodes of each level down to the small subtrees, whose remainders are
+                     * evaluated at their points directly.
+                     */
+                    std::vector<value_type> evaluate(const coefficients_type &poly) const {
+                        std::size_t stop_level = 0;
+                        while ((std::size_t(1) << (stop_level + 1)) <= subproduct_tree_leaf_points &&
+                               stop_level + 1 < _levels.size()) {
+                            ++stop_level;
+                        }
+
+                        std::vector<coefficients_type> remainders = {subproduct_remainder(poly, root())};
+                        for (std::size_t l = _levels.size() - 1; l-- > stop_level;) {
+                            std::vector<coefficients_type> lower(_levels[l].size());
+                            for (std::size_t j = 0; j < lower.size(); ++j) {
+                                lower[j] = subproduct_remainder(remainders[j / 2], _levels[l][j]);
+                            }
+                            remainders = std::move(lower);
+                        }
+
+                        std::vector<value_type> result(_points.size());
+                        const std::size_t node_points = std::size_t(1) << stop_level;
+                        for (std::size_t j = 0; j < remainders.size(); ++j) {
+                            const coefficients_type &r = remainders[j];
+                            for (std::size_t i = j * node_points; i < std::min((j + 1) * node_points, _points.size());
+                                 ++i) {
+                                value_type value = value_type::zero();
+                                for (std::size_t k = r.size(); k-- > 0;) {
+                                    value = value * _points[i] + r[k];
+                                }
+                                result[i] = value;
+                            }
+                        }
+                        return result;
+                    }
+
+                    /**
+                     * Computes sum_i c_i * prod_{m != i} (x - x_m) bottom-up: the sum over a node is
+                     * left_sum * right_product + right_sum * left_product.
+                     */
+                    coefficients_type linear_combination(const std::vector<value_type> &c) const {
+                        BOOST_ASSERT(c.size() == _points.size());
+
+                        std::vector<coefficients_type> sums(c.size());
+                        for (std::size_t i = 0; i < c.size(); ++i) {
+                            sums[i] = {c[i]};
+                        }
+                        for (std::size_t l = 0; l + 1 < _levels.size(); ++l) {
+                            const std::vector<coefficients_type> &level = _levels[l];
+                            std::vector<coefficients_type> upper((sums.size() + 1) / 2);
+                            for (std::size_t j = 0; j < upper.size(); ++j) {
+                                if (2 * j + 1 == sums.size()) {
+                                    upper[j] = std::move(sums[2 * j]);
+                                    continue;
+                                }
+                                coefficients_type left = subproduct_multiply(sums[2 * j], level[2 * j + 1]);
+                                const coefficients_type right = subproduct_multiply(sums[2 * j + 1], level[2 * j]);
+                                left.resize(std::max(left.size(), right.size()), value_type::zero());
+                                for (std::size_t i = 0; i < right.size(); ++i) {
+                                    left[i] += right[i];
+                                }
+                                upper[j] = std::move(left);
+                            }
+                            sums = std::move(upper);
+                        }
+                        condense(sums[0]);
+                        return sums[0];
+                    }
+
+                private:
+                    std::vector<value_type> _points;
+                    std::vector<std::vector<coefficients_type>> _levels;
+                };
+
+                /**
+                 * Quadratic interpolation for a moderate number of points: the product M = prod_m (x - x_m) is built
+                 * once, every basis polynomial M / (x - x_j) is obtained from it by the synthetic division, and its
+                 * value at x_j gives the denominator of the basis polynomial.
+                 */
+                template<typename FieldValueType>
+                std::vector<FieldValueType> lagrange_interpolation_quadratic(const std::vector<FieldValueType> &xs,
+                                                                             const std::vector<FieldValueType> &ys) {
+                    const std::size_t k = xs.size();
+
+                    std::vector<FieldValueType> product(k + 1, FieldValueType::zero());
+                    product[0] = FieldValueType::one();
+                    for (std::size_t m = 0; m < k; ++m) {
+                        for (std::size_t i = m + 1; i > 0; --i) {
+                            product[i] = product[i - 1] - xs[m] * product[i];
+                        }
+                        product[0] = -xs[m] * product[0];
+                    }
+
+                    std::vector<FieldValueType> result(k, FieldValueType::zero());
+                    std::vector<FieldValueType> basis(k);
+                    for (std::size_t j = 0; j < k; ++j) {
+                        FieldValueType carry = FieldValueType::zero();
+                        for (std::size_t i = k; i > 0; --i) {
+                            carry = product[i] + carry * xs[j];
+                            basis[i - 1] = carry;
+                        }
+                        FieldValueType denominator = FieldValueType::zero();
+                        for (std::size_t i = k; i > 0; --i) {
+                            denominator = denominator * xs[j] + basis[i - 1];
+                        }
+                        const FieldValueType weight = ys[j] * denominator.inversed();
+                        for (std::size_t i = 0; i < k; ++i) {
+                            result[i] += weight * basis[i];
+                        }
+                    }
+                    return result;
+                }
+
+                /**
+                 * Interpolation by the subproduct tree: with M = prod_m (x - x_m) the denominators of the basis
+                 * polynomials are M'(x_j), they are found by one multipoint evaluation, and the interpolant is the
+                 * linear combination of M / (x - x_j) with the coefficients y_j / M'(x_j).
+                 */
+                template<typename FieldValueType>
+                std::vector<FieldValueType> lagrange_interpolation_subproduct_tree(
+                        const std::vector<FieldValueType> &xs, const std::vector<FieldValueType> &ys) {
+                    const subproduct_tree<FieldValueType> tree(xs);
+
+                    const std::vector<FieldValueType> &root = tree.root();
+                    std::vector<FieldValueType> derivative(root.size() - 1);
+                    for (std::size_t i = 1; i < root.size(); ++i) {
+                        derivative[i - 1] = root[i] * FieldValueType(i);
+                    }
+
+                    std::vector<FieldValueType> weights = tree.evaluate(derivative);
+                    for (std::size_t j = 0; j < weights.size(); ++j) {
+                        weights[j] = ys[j] * weights[j].inversed();
+                    }
+                    return tree.linear_combination(weights);
+                }
+            }    // namespace detail
+
+            /**
+             * Returns the polynomial of degree less than k, which takes the values points[j].second at the k distinct
+             * points points[j].first. One and two points are interpolated by the closed-form formulas, up to
+             * detail::subproduct_tree_min_points points by the quadratic algorithm, larger sets by the subproduct
+             * tree with FFT-based multiplication in O(M(k) log k).
+             */
             template<typename InputRange,
                     typename FieldValueType =
                     typename std::iterator_traits<typename InputRange::iterator>::value_type::first_type>
@@ -47,17 +349,89 @@ namespace nil {
 
                 std::size_t k = std::size(points);
 
-                polynomial<FieldValueType> result;
+                if (k == 0) {
+                    return polynomial<FieldValueType>();
+                }
+                if (k == 1) {
+                    return polynomial<FieldValueType>({points[0].second});
+                }
+                if (k == 2) {
+                    const FieldValueType slope =
+                        (points[1].second - points[0].second) * (points[1].first - points[0].first).inversed();
+                    polynomial<FieldValueType> result({points[0].second - slope * points[0].first, slope});
+                    result.condense();
+                    return result;
+                }
+
+                std::vector<FieldValueType> xs(k), ys(k);
                 for (std::size_t j = 0; j < k; ++j) {
-                    polynomial<FieldValueType> term({points[j].second});
-                    for (std::size_t m = 0; m < k; ++m) {
-                        if (m != j) {
-                            term = term * (polynomial<FieldValueType>({-points[m].first, FieldValueType::one()}) *
-                                           (points[j].first - points[m].first).inversed());
-                        }
+                    xs[j] = points[j].first;
+                    ys[j] = points[j].second;
+                }
+
+                std::vector<FieldValueType> coefficients = k < detail::subproduct_tree_min_points ?
+                    detail::lagrange_interpolation_quadratic(xs, ys) :
+                    detail::lagrange_interpolation_subproduct_tree(xs, ys);
+
+                polynomial<FieldValueType> result(std::move(coefficients));
+                result.condense();
+                return result;
+            }
+
+            /**
+             * Interpolates each of the point sets. The sets are processed in parallel.
+             * We use HIGH level thread pool here, because the interpolation may use the lower level one, so this
+             * function must not be called from a task of the HIGH level pool.
+             */
+            template<typename InputRange,
+                    typename FieldValueType =
+                    typename std::iterator_traits<typename InputRange::iterator>::value_type::first_type>
+            std::vector<polynomial<FieldValueType>>
+            lagrange_interpolation_batch(const std::vector<InputRange> &point_sets) {
+                std::vector<polynomial<FieldValueType>> result(point_sets.size());
+                parallel_for(0, point_sets.size(), [&result, &point_sets](std::size_t i) {
+                    result[i] = lagrange_interpolation(point_sets[i]);
+                }, ThreadPool::PoolLevel::HIGH);
+                return result;
+            }
+
+            /**
+             * Evaluates the polynomial at all the given points. Large sets of points are processed by the remainder
+             * tree in O(M(n) log n) instead of evaluating the polynomial at each point separately.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<FieldValueType> evaluate_multipoint(const polynomial<FieldValueType, Allocator> &poly,
+                                                            const std::vector<FieldValueType> &points) {
+                if (points.size() < detail::subproduct_tree_min_points) {
+                    std::vector<FieldValueType> result(points.size());
+                    for (std::size_t i = 0; i < points.size(); ++i) {
+                        result[i] = poly.evaluate(points[i]);
                     }
-                    result = result + term;
+                    return result;
+                }
+                const detail::subproduct_tree<FieldValueType> tree(points);
+                return tree.evaluate(std::vector<FieldValueType>(poly.begin(), poly.end()));
+            }
+
+            /**
+             * Evaluates each of the polynomials at all the given points. The subproduct tree over the points is built
+             * once and shared by the polynomials, which are processed in parallel on the HIGH level thread pool.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<std::vector<FieldValueType>>
+            evaluate_multipoint(const std::vector<polynomial<FieldValueType, Allocator>> &polys,
+                                const std::vector<FieldValueType> &points) {
+                std::vector<std::vector<FieldValueType>> result(polys.size());
+                if (points.size() < detail::subproduct_tree_min_points) {
+                    parallel_for(0, polys.size(), [&result, &polys, &points](std::size_t i) {
+                        result[i] = evaluate_multipoint(polys[i], points);
+                    }, ThreadPool::PoolLevel::HIGH);
+                    return result;
                 }
+                const detail::subproduct_tree<FieldValueType> tree(points);
+                parallel_for(0, polys.size(), [&result, &polys, &tree](std::size_t i) {
+                    result[i] = tree.evaluate(std::vector<FieldValueType>(polys[i].begin(), polys[i].end()));
+                }, ThreadPool::PoolLevel::HIGH);
                 return result;
             }
         }    // namespace math
@@ -35,8 +35,11 @@
 #include <iterator>
 #include <unordered_map>
 
+#include <nil/crypto3/algebra/fields/goldilocks64/batch_operations.hpp>
+
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
@@ -140,7 +143,7 @@ namespace nil {
                                      "DFS optimal polynomial size must be a power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynomial size must be a power of two");
                 }
@@ -370,15 +373,10 @@ namespace nil {
                     std::swap(_d, other._d);
                 }
 
+                // Uses the barycentric formula, so no conversion to coefficients is needed. To evaluate many
+                // polynomials at the same point, use barycentric_weights or evaluate_barycentric directly.
                 FieldValueType evaluate(const FieldValueType& value) const {
-                    std::vector<FieldValueType> tmp = this->coefficients();
-                    FieldValueType result = FieldValueType::zero();
-                    auto end = tmp.end();
-                    // TODO(martun): parallelize the lower loop.
-                    while (end != tmp.begin()) {
-                        result = result * value + *--end;
-                    }
-                    return result;
+                    return barycentric_weights<FieldValueType>(this->size(), value).evaluate(this->begin(), this->end());
                 }
 
                 /**
@@ -445,13 +443,15 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
 
-                        in_place_parallel_transform(this->begin(), this->end(), tmp.begin(),
-                            [](FieldValueType& v1, const FieldValueType& v2){v1+=v2;});
+                        pointwise_in_place(tmp,
+                            [](FieldValueType& v1, const FieldValueType& v2){v1+=v2;},
+                            &algebra::fields::goldilocks64_batch_operations::add);
                         return *this;
                     }
 
-                    in_place_parallel_transform(this->begin(), this->end(), other.begin(),
-                            [](FieldValueType& v1, const FieldValueType& v2){v1+=v2;});
+                    pointwise_in_place(other,
+                            [](FieldValueType& v1, const FieldValueType& v2){v1+=v2;},
+                            &algebra::fields::goldilocks64_batch_operations::add);
 
                     return *this;
                 }
@@ -499,14 +499,16 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
 
-                        in_place_parallel_transform(this->begin(), this->end(), tmp.begin(),
-                            [](FieldValueType& v1, const FieldValueType& v2){v1-=v2;});
+                        pointwise_in_place(tmp,
+                            [](FieldValueType& v1, const FieldValueType& v2){v1-=v2;},
+                            &algebra::fields::goldilocks64_batch_operations::sub);
 
                         return *this;
                     }
 
-                    in_place_parallel_transform(this->begin(), this->end(), other.begin(),
-                            [](FieldValueType& v1, const FieldValueType& v2){v1-=v2;});
+                    pointwise_in_place(other,
+                            [](FieldValueType& v1, const FieldValueType& v2){v1-=v2;},
+                            &algebra::fields::goldilocks64_batch_operations::sub);
                     return *this;
                 }
 
@@ -562,13 +564,15 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(polynomial_s, other_domain, new_domain);
 
-                        in_place_parallel_transform(this->begin(), this->end(), tmp.begin(),
-                            [](FieldValueType& v1, const FieldValueType& v2){v1*=v2;});
+                        pointwise_in_place(tmp,
+                            [](FieldValueType& v1, const FieldValueType& v2){v1*=v2;},
+                            &algebra::fields::goldilocks64_batch_operations::mul);
                         return *this;
                     }
 
-                    in_place_parallel_transform(this->begin(), this->end(), other.begin(),
-                            [](FieldValueType& v1, const FieldValueType& v2){v1*=v2;});
+                    pointwise_in_place(other,
+                            [](FieldValueType& v1, const FieldValueType& v2){v1*=v2;},
+                            &algebra::fields::goldilocks64_batch_operations::mul);
 
                     return *this;
                 }
@@ -675,6 +679,25 @@ namespace nil {
                     return result;
                 }
 
+            private:
+                /**
+                 * Applies 'op' to the pairs of values of this and 'other', which must have the same size. Goldilocks
+                 * values are processed by 'batch_op' from the vectorized batch operations instead.
+                 */
+                template<typename Operation, typename BatchOperation>
+                void pointwise_in_place(const polynomial_dfs& other, Operation op, BatchOperation batch_op) {
+                    if constexpr (algebra::fields::is_goldilocks64_element<FieldValueType>) {
+                        FieldValueType* dst = this->val.data();
+                        const FieldValueType* src = other.val.data();
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            this->size(),
+                            [dst, src, batch_op](std::size_t begin, std::size_t end) {
+                                batch_op(dst + begin, dst + begin, src + begin, end - begin);
+                            }, ThreadPool::PoolLevel::LOW));
+                    } else {
+                        in_place_parallel_transform(this->begin(), this->end(), other.begin(), op);
+                    }
+                }
             };
 
             template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>,
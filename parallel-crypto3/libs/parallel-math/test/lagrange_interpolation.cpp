@@ -94,4 +94,78 @@ BOOST_AUTO_TEST_CASE(polynomial_lagrange_interpolation_random_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_lagrange_interpolation_subproduct_tree_test) {
+    using field_type = fields::bls12_fr<381>;
+
+    for (std::size_t n : {2, 63, 64, 65, 300}) {
+        std::vector<std::pair<typename field_type::value_type, typename field_type::value_type>> points(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            points[i] = std::make_pair(nil::crypto3::algebra::random_element<field_type>(),
+                                       nil::crypto3::algebra::random_element<field_type>());
+        }
+
+        polynomial<typename field_type::value_type> ans = lagrange_interpolation(points);
+
+        BOOST_CHECK(ans.size() <= n);
+        for (std::size_t i = 0; i < n; ++i) {
+            BOOST_CHECK(ans.evaluate(points[i].first) == points[i].second);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_lagrange_interpolation_batch_test) {
+    using field_type = fields::bls12_fr<381>;
+    using point_set_type = std::vector<std::pair<typename field_type::value_type, typename field_type::value_type>>;
+
+    std::vector<point_set_type> point_sets;
+    for (std::size_t n : {1, 2, 3, 17, 100}) {
+        point_set_type points(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            points[i] = std::make_pair(nil::crypto3::algebra::random_element<field_type>(),
+                                       nil::crypto3::algebra::random_element<field_type>());
+        }
+        point_sets.push_back(points);
+    }
+
+    std::vector<polynomial<typename field_type::value_type>> ans = lagrange_interpolation_batch(point_sets);
+
+    BOOST_CHECK_EQUAL(ans.size(), point_sets.size());
+    for (std::size_t j = 0; j < point_sets.size(); ++j) {
+        for (const auto &point : point_sets[j]) {
+            BOOST_CHECK(ans[j].evaluate(point.first) == point.second);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_evaluate_multipoint_test) {
+    using field_type = fields::bls12_fr<381>;
+
+    std::vector<polynomial<typename field_type::value_type>> polys(3);
+    for (auto &p : polys) {
+        std::vector<typename field_type::value_type> coeffs(500);
+        for (auto &c : coeffs) {
+            c = nil::crypto3::algebra::random_element<field_type>();
+        }
+        p = polynomial<typename field_type::value_type>(coeffs.begin(), coeffs.end());
+    }
+
+    for (std::size_t n : {10, 200}) {
+        std::vector<typename field_type::value_type> points(n);
+        for (auto &x : points) {
+            x = nil::crypto3::algebra::random_element<field_type>();
+        }
+
+        std::vector<typename field_type::value_type> values = evaluate_multipoint(polys[0], points);
+        std::vector<std::vector<typename field_type::value_type>> batch_values = evaluate_multipoint(polys, points);
+
+        BOOST_CHECK_EQUAL(batch_values.size(), polys.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            BOOST_CHECK(values[i] == polys[0].evaluate(points[i]));
+            for (std::size_t j = 0; j < polys.size(); ++j) {
+                BOOST_CHECK(batch_values[j][i] == polys[j].evaluate(points[i]));
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
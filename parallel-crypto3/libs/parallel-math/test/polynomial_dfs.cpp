@@ -37,6 +37,7 @@
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
@@ -96,6 +97,17 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_from_coefficients_less_degree) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_dfs_adopts_moved_container) {
+    std::vector<typename FieldType::value_type> values = {1u, 3u, 4u, 25u, 6u, 7u, 7u, 2u};
+    const typename FieldType::value_type *storage = values.data();
+
+    polynomial_dfs<typename FieldType::value_type> a(7, std::move(values));
+
+    BOOST_CHECK_EQUAL(a.size(), 8);
+    BOOST_CHECK(&*a.begin() == storage);
+    BOOST_CHECK_EQUAL(a[3].data, typename FieldType::value_type(25u).data);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(polynomial_dfs_coefficients_test_suite)
@@ -1447,3 +1459,59 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_equality_check_perf_test, *boost::unit_test:
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_evaluation_test_suite)
+
+typename FieldType::value_type evaluate_by_coefficients(
+        const polynomial_dfs<typename FieldType::value_type>& poly, const typename FieldType::value_type& x) {
+    return polynomial<typename FieldType::value_type>(poly.coefficients()).evaluate(x);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_evaluate_out_of_domain_test) {
+    for (std::size_t size: {1, 2, 8, 1 << 13}) {
+        polynomial_dfs<typename FieldType::value_type> poly(size - 1, size);
+        for (std::size_t i = 0; i < size; ++i) {
+            poly[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        auto x = nil::crypto3::algebra::random_element<FieldType>();
+        BOOST_CHECK_EQUAL(poly.evaluate(x), evaluate_by_coefficients(poly, x));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_evaluate_on_domain_test) {
+    const std::size_t size = 16;
+    polynomial_dfs<typename FieldType::value_type> poly(size - 1, size);
+    for (std::size_t i = 0; i < size; ++i) {
+        poly[i] = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    auto omega = unity_root<FieldType>(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(poly.evaluate(omega.pow(i)), poly[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_evaluate_barycentric_batch_test) {
+    std::vector<polynomial_dfs<typename FieldType::value_type>> polys;
+    std::vector<std::vector<typename FieldType::value_type>> points;
+    auto x = nil::crypto3::algebra::random_element<FieldType>();
+    auto y = nil::crypto3::algebra::random_element<FieldType>();
+    for (std::size_t size: {8, 8, 32, 32, 32}) {
+        polynomial_dfs<typename FieldType::value_type> poly(size / 2, size);
+        for (std::size_t i = 0; i < size; ++i) {
+            poly[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polys.push_back(poly);
+        points.push_back({x, y, unity_root<FieldType>(size)});
+    }
+
+    auto values = evaluate_barycentric(polys, points);
+    BOOST_CHECK_EQUAL(values.size(), polys.size());
+    for (std::size_t i = 0; i < polys.size(); ++i) {
+        BOOST_CHECK_EQUAL(values[i].size(), points[i].size());
+        for (std::size_t j = 0; j < points[i].size(); ++j) {
+            BOOST_CHECK_EQUAL(values[i][j], evaluate_by_coefficients(polys[i], points[i][j]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -34,12 +34,15 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/type_traits.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/eval_storage.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/spilled_polynomials.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -80,6 +83,13 @@ namespace nil {
 
                     std::map<std::size_t, std::vector<std::vector<value_type>>> _points;
 
+                    // Committed batches moved out of memory, _polys keeps an empty vector for each of them.
+                    // Copies of the evaluator share the scratch files, batches are read back with get_batch.
+                    std::map<std::size_t, std::shared_ptr<detail::spilled_polynomials<polynomial_type>>> _spilled;
+
+                    // Budget of the prover which owns the evaluator, committed batches are not spilled without it.
+                    std::shared_ptr<detail::memory_budget> _memory_budget;
+
                     bool operator==(const polys_evaluator& other) const {
                         return _z == other._z && _polys == other._polys &&
                             _locked == other._locked && _points == other._points;
@@ -108,7 +118,97 @@ namespace nil {
                     // polynomials.
                     void state_commited(std::size_t index) {
                         _locked[index] = true;
-                        _points[index].resize(_polys[index].size());
+                        _points[index].resize(get_batch_size(index));
+                    }
+
+                    // Number of polynomials in the batch, including the batches moved out of memory.
+                    std::size_t get_batch_size(std::size_t index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return it->second->size();
+                        }
+                        auto polys_it = _polys.find(index);
+                        return polys_it == _polys.end() ? 0 : polys_it->second.size();
+                    }
+
+                    // Number of values of polynomial 'poly_index' of the batch, the batch is not loaded if it was spilled.
+                    std::size_t get_poly_size(std::size_t index, std::size_t poly_index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return it->second->size(poly_index);
+                        }
+                        return _polys.at(index)[poly_index].size();
+                    }
+
+                    // Degree of polynomial 'poly_index' of the batch, the batch is not loaded if it was spilled.
+                    std::size_t get_poly_degree(std::size_t index, std::size_t poly_index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return it->second->degree(poly_index);
+                        }
+                        return _polys.at(index)[poly_index].degree();
+                    }
+
+                    /**
+                     * Returns the polynomials of a batch. A batch in memory is returned without copying, a spilled
+                     * batch is read back from its scratch file and freed when the last pointer to it is released,
+                     * so callers going over the batches one by one hold at most one spilled batch in memory.
+                     */
+                    std::shared_ptr<const std::vector<polynomial_type>> get_batch(std::size_t index) const {
+                        auto it = _spilled.find(index);
+                        if (it != _spilled.end()) {
+                            return std::make_shared<const std::vector<polynomial_type>>(it->second->load());
+                        }
+                        return std::shared_ptr<const std::vector<polynomial_type>>(std::shared_ptr<void>(), &_polys.at(index));
+                    }
+
+                    void set_memory_budget(std::shared_ptr<detail::memory_budget> budget) {
+                        _memory_budget = std::move(budget);
+                    }
+
+                    const std::shared_ptr<detail::memory_budget>& get_memory_budget() const {
+                        return _memory_budget;
+                    }
+
+                    // Moves a committed batch to a scratch file of the memory budget. Does nothing without a budget
+                    // or if the file can't be created.
+                    void spill_batch(std::size_t index) {
+                        if (!_memory_budget || _spilled.find(index) != _spilled.end() || _polys.find(index) == _polys.end())
+                            return;
+                        BOOST_ASSERT(_locked[index]);
+
+                        auto spilled = detail::spilled_polynomials<polynomial_type>::spill(
+                            _polys[index], _memory_budget->scratch_directory());
+                        if (spilled) {
+                            _spilled[index] = std::move(spilled);
+                        }
+                    }
+
+                    // Spills all the committed batches still in memory if the process is over the memory budget.
+                    // Batches committed while there was enough memory, e.g. the witness, are spilled as well.
+                    void spill_committed_batches_over_budget() {
+                        if (!_memory_budget || !_memory_budget->exceeded())
+                            return;
+                        for (const auto& [index, locked]: _locked) {
+                            if (locked) {
+                                spill_batch(index);
+                            }
+                        }
+                    }
+
+                    void load_spilled_batch(std::size_t index) {
+                        auto it = _spilled.find(index);
+                        if (it == _spilled.end())
+                            return;
+                        _polys[index] = it->second->load();
+                        _spilled.erase(it);
+                    }
+
+                    // Must be called before _polys is accessed directly, e.g. from marshalling.
+                    void load_spilled_batches() {
+                        while (!_spilled.empty()) {
+                            load_spilled_batch(_spilled.begin()->first);
+                        }
                     }
 
                 protected:
@@ -208,8 +308,11 @@ namespace nil {
                         return eval_map;
                     }
 
+                    // Spilled batches are read back one at a time.
                     void eval_polys() {
-                        for(auto const &[k, poly] : _polys) {
+                        for(auto const &[k, stored_poly] : _polys) {
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = get_batch(k);
+                            const std::vector<polynomial_type>& poly = *batch;
                             _z.set_batch_size(k, poly.size());
                             auto const &point = _points.at(k);
 
@@ -219,16 +322,31 @@ namespace nil {
                                 _z.set_poly_points_number(k, i, point[i].size());
                             }
 
-                            // Lambda in parallel_for can not capture structured bindings [k, poly], until C++20
-                            auto k_capture = k;
-                            auto poly_capture = poly;
-
-                            // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
-                            parallel_for(0, poly.size(), [this, &point, k_capture, &poly_capture](std::size_t i) {
-                                for (std::size_t j = 0; j < point[i].size(); j++) {
-                                    _z.set(k_capture, i, j, poly_capture[i].evaluate(point[i][j]));
+                            if constexpr (math::is_polynomial_dfs<polynomial_type>::value) {
+                                // Polynomials of a batch share their points, the barycentric weights of each point
+                                // are computed once for the whole batch.
+                                std::vector<std::vector<typename polynomial_type::value_type>> poly_points(poly.size());
+                                for (std::size_t i = 0; i < poly.size(); ++i) {
+                                    poly_points[i] = point.size() == 1 ? point[0] : point[i];
                                 }
-                            }, ThreadPool::PoolLevel::HIGH);
+                                auto values = math::evaluate_barycentric(poly, poly_points);
+                                for (std::size_t i = 0; i < poly.size(); ++i) {
+                                    for (std::size_t j = 0; j < values[i].size(); j++) {
+                                        _z.set(k, i, j, values[i][j]);
+                                    }
+                                }
+                            } else {
+                                // Lambda in parallel_for can not capture structured bindings [k, poly], until C++20
+                                auto k_capture = k;
+                                const auto& poly_capture = poly;
+
+                                // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
+                                parallel_for(0, poly.size(), [this, &point, k_capture, &poly_capture](std::size_t i) {
+                                    for (std::size_t j = 0; j < point[i].size(); j++) {
+                                        _z.set(k_capture, i, j, poly_capture[i].evaluate(point[i][j]));
+                                    }
+                                }, ThreadPool::PoolLevel::HIGH);
+                            }
                         }
                     }
 
@@ -0,0 +1,349 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_LDE_CACHE_HPP
+#define CRYPTO3_ZK_COMMITMENTS_LDE_CACHE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/field_element_block.hpp>
+#include <nil/crypto3/marshalling/containers/types/merkle_node.hpp>
+#include <nil/crypto3/marshalling/containers/types/merkle_tree.hpp>
+#include <nil/crypto3/marshalling/math/types/polynomial.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+
+                    /**
+                     * Cache of the low degree extensions and merkle trees of committed batches, used to re-prove
+                     * near identical workloads. A column is identified by the SHA-256 fingerprint of its values on
+                     * the original domain, so the extension of a column that was committed before is read from the
+                     * cache instead of being recomputed. The tree of a batch with all the columns unchanged is read
+                     * as a whole. Both fingerprints include the type tag of the field and the merkle hash, so one
+                     * directory can be shared by schemes over different fields and hashes. Entries are files in the
+                     * cache directory, written with the marshalling codecs: extensions as polynomial blocks in the
+                     * canonical encoding, trees as merkle trees. The least recently used entries are removed when the
+                     * directory grows over the limit. An empty directory disables the cache.
+                     *
+                     * The cache is owned by the caller and given to the commitment schemes that should use it, it is
+                     * configured before the first commitment.
+                     */
+                    class lde_cache {
+                    public:
+                        using fingerprint_type = std::array<std::uint8_t, 32>;
+
+                        lde_cache() = default;
+
+                        explicit lde_cache(const boost::filesystem::path& directory, std::size_t limit_bytes = 0) {
+                            set_directory(directory);
+                            set_limit(limit_bytes);
+                        }
+
+                        void set_directory(const boost::filesystem::path& directory) {
+                            if (!directory.empty()) {
+                                boost::filesystem::create_directories(directory);
+                            }
+                            _directory = directory;
+                        }
+
+                        const boost::filesystem::path& directory() const {
+                            return _directory;
+                        }
+
+                        bool enabled() const {
+                            return !_directory.empty();
+                        }
+
+                        // Limit of the total size of the cache files in bytes, 0 means no limit.
+                        void set_limit(std::size_t limit_bytes) {
+                            _limit_bytes = limit_bytes;
+                        }
+
+                        /**
+                         * Identifies the field and the merkle hash of the entries. The field is identified by the
+                         * canonical encoding of -1, that is the modulus minus one, and its element length. The
+                         * hash is identified by the digest size and the value of a node over two empty children,
+                         * so hashes with the same digest size still get different tags.
+                         */
+                        template<typename FieldType, typename TreeType>
+                        static fingerprint_type type_tag() {
+                            using value_type = typename FieldType::value_type;
+                            using node_value_type = typename TreeType::value_type;
+
+                            const value_type minus_one = -value_type::one();
+                            std::vector<std::uint8_t> data(
+                                marshalling::types::field_element_block_element_length<value_type>());
+                            marshalling::types::write_field_elements(&minus_one, 1, data.data());
+                            append_integer(data, data.size());
+
+                            const std::array<node_value_type, 2> children = {node_value_type(), node_value_type()};
+                            auto filled_node = marshalling::types::fill_merkle_node_value<node_value_type, endianness>(
+                                containers::detail::generate_hash<typename TreeType::hash_type>(
+                                    children.begin(), children.end()));
+                            const std::size_t node_offset = data.size();
+                            data.resize(node_offset + filled_node.length());
+                            auto write_iter = data.begin() + node_offset;
+                            filled_node.write(write_iter, filled_node.length());
+                            append_integer(data, TreeType::hash_type::digest_bits);
+                            return digest(data.data(), data.data() + data.size());
+                        }
+
+                        // Fingerprint of the canonical encoding of the values, so it doesn't depend on the arithmetic.
+                        template<typename ValueType>
+                        static fingerprint_type fingerprint(const math::polynomial_dfs<ValueType>& poly,
+                                                            const fingerprint_type& tag) {
+                            std::vector<std::uint8_t> data(
+                                poly.size() * marshalling::types::field_element_block_element_length<ValueType>());
+                            marshalling::types::write_field_elements(&*poly.begin(), poly.size(), data.data());
+                            append_integer(data, poly.size());
+                            append_integer(data, poly.degree());
+                            data.insert(data.end(), tag.begin(), tag.end());
+                            return digest(data.data(), data.data() + data.size());
+                        }
+
+                        // Fingerprint of a batch of columns committed with the given extended domain size and FRI step.
+                        static fingerprint_type fingerprint(const std::vector<fingerprint_type>& columns,
+                                                            std::size_t domain_size, std::size_t fri_step,
+                                                            const fingerprint_type& tag) {
+                            std::vector<std::uint8_t> data;
+                            data.reserve((columns.size() + 1) * sizeof(fingerprint_type) + 2 * sizeof(std::uint64_t));
+                            for (const auto& column: columns) {
+                                data.insert(data.end(), column.begin(), column.end());
+                            }
+                            append_integer(data, domain_size);
+                            append_integer(data, fri_step);
+                            data.insert(data.end(), tag.begin(), tag.end());
+                            return digest(data.data(), data.data() + data.size());
+                        }
+
+                        /**
+                         * Reads the extension of the column with the given fingerprint to the domain of the given
+                         * size. \returns false if there is no such entry or it is damaged.
+                         */
+                        template<typename ValueType>
+                        bool load_polynomial(const fingerprint_type& column, std::size_t domain_size,
+                                             math::polynomial_dfs<ValueType>& poly) const {
+                            using polynomial_type = math::polynomial_dfs<ValueType>;
+
+                            typename marshalling::types::polynomial_block<TTypeBase, polynomial_type>::type filled;
+                            if (!load_entry(entry_path("lde", column, domain_size), filled)) {
+                                return false;
+                            }
+                            poly = marshalling::types::make_polynomial_block<endianness, polynomial_type>(filled);
+                            return poly.size() == domain_size;
+                        }
+
+                        template<typename ValueType>
+                        void store_polynomial(const fingerprint_type& column,
+                                              const math::polynomial_dfs<ValueType>& poly) {
+                            boost::filesystem::path path = entry_path("lde", column, poly.size());
+                            boost::system::error_code ec;
+                            if (!boost::filesystem::exists(path, ec)) {
+                                store_entry(path, marshalling::types::fill_polynomial_block<endianness>(poly));
+                            }
+                        }
+
+                        // Reads the merkle tree of the batch with the given fingerprint.
+                        template<typename TreeType>
+                        bool load_tree(const fingerprint_type& batch, TreeType& tree) const {
+                            marshalling::types::merkle_tree<TTypeBase, TreeType> filled;
+                            if (!load_entry(entry_path("tree", batch, 0), filled) || filled.value().empty()) {
+                                return false;
+                            }
+                            tree = marshalling::types::make_merkle_tree<TreeType, endianness>(filled);
+                            return true;
+                        }
+
+                        template<typename TreeType>
+                        void store_tree(const fingerprint_type& batch, const TreeType& tree) {
+                            boost::filesystem::path path = entry_path("tree", batch, 0);
+                            boost::system::error_code ec;
+                            if (!boost::filesystem::exists(path, ec)) {
+                                store_entry(path, marshalling::types::fill_merkle_tree<TreeType, endianness>(tree));
+                            }
+                        }
+
+                        // Removes the least recently used entries until the cache fits into the limit.
+                        void prune() {
+                            if (_directory.empty() || _limit_bytes == 0) {
+                                return;
+                            }
+
+                            struct entry_info {
+                                boost::filesystem::path path;
+                                std::time_t last_use;
+                                std::size_t size;
+                            };
+                            std::vector<entry_info> entries;
+                            std::size_t total_size = 0;
+                            boost::system::error_code ec;
+                            for (boost::filesystem::directory_iterator it(_directory, ec), end; !ec && it != end;
+                                    it.increment(ec)) {
+                                if (!boost::filesystem::is_regular_file(it->path(), ec) ||
+                                        it->path().extension() != ".bin") {
+                                    continue;
+                                }
+                                std::size_t size = boost::filesystem::file_size(it->path(), ec);
+                                std::time_t last_use = boost::filesystem::last_write_time(it->path(), ec);
+                                entries.push_back({it->path(), last_use, size});
+                                total_size += size;
+                            }
+
+                            std::sort(entries.begin(), entries.end(), [](const entry_info& a, const entry_info& b) {
+                                return a.last_use < b.last_use;
+                            });
+                            for (const auto& entry: entries) {
+                                if (total_size <= _limit_bytes) {
+                                    break;
+                                }
+                                boost::filesystem::remove(entry.path, ec);
+                                total_size -= entry.size;
+                            }
+                        }
+
+                    private:
+                        using endianness = nil::marshalling::option::big_endian;
+                        using TTypeBase = nil::marshalling::field_type<endianness>;
+
+                        constexpr static const std::uint64_t magic = 0x334843414345444CULL; // "LDECACH3"
+
+                        static fingerprint_type digest(const std::uint8_t* first, const std::uint8_t* last) {
+                            typename nil::crypto3::hashes::sha2<256>::digest_type result =
+                                nil::crypto3::hash<nil::crypto3::hashes::sha2<256>>(first, last);
+                            fingerprint_type fingerprint;
+                            std::copy(result.begin(), result.end(), fingerprint.begin());
+                            return fingerprint;
+                        }
+
+                        static void append_integer(std::vector<std::uint8_t>& data, std::uint64_t value) {
+                            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                                data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+                            }
+                        }
+
+                        boost::filesystem::path entry_path(const char* kind, const fingerprint_type& fingerprint,
+                                                           std::size_t domain_size) const {
+                            std::ostringstream name;
+                            name << kind << '-' << std::hex << std::setfill('0');
+                            for (std::uint8_t byte: fingerprint) {
+                                name << std::setw(2) << static_cast<unsigned>(byte);
+                            }
+                            name << std::dec << '-' << domain_size << ".bin";
+                            return directory() / name.str();
+                        }
+
+                        // Reads an entry and marks it as recently used.
+                        template<typename MarshallingType>
+                        static bool load_entry(const boost::filesystem::path& path, MarshallingType& filled) {
+                            boost::system::error_code ec;
+                            std::size_t size = boost::filesystem::file_size(path, ec);
+                            if (ec || size < sizeof(magic)) {
+                                return false;
+                            }
+                            std::vector<std::uint8_t> data(size);
+                            std::ifstream file(path.string(), std::ios::binary);
+                            if (!file || !file.read(reinterpret_cast<char*>(data.data()), size)) {
+                                return false;
+                            }
+
+                            std::uint64_t entry_magic = 0;
+                            for (std::size_t i = 0; i < sizeof(magic); ++i) {
+                                entry_magic |= std::uint64_t(data[i]) << (8 * i);
+                            }
+                            if (entry_magic != magic) {
+                                return false;
+                            }
+                            auto read_iter = data.cbegin() + sizeof(magic);
+                            nil::marshalling::status_type status = filled.read(read_iter, size - sizeof(magic));
+                            if (status != nil::marshalling::status_type::success || read_iter != data.cend()) {
+                                return false;
+                            }
+
+                            boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+                            return true;
+                        }
+
+                        // Writes to a temporary file first, so concurrent provers never read a partial entry.
+                        template<typename MarshallingType>
+                        static void store_entry(const boost::filesystem::path& path, const MarshallingType& filled) {
+                            std::vector<std::uint8_t> data;
+                            append_integer(data, magic);
+                            data.resize(sizeof(magic) + filled.length());
+                            auto write_iter = data.begin() + sizeof(magic);
+                            if (filled.write(write_iter, filled.length()) != nil::marshalling::status_type::success) {
+                                return;
+                            }
+
+                            boost::system::error_code ec;
+                            boost::filesystem::path temporary = path;
+                            temporary += "." + boost::filesystem::unique_path().string();
+                            {
+                                std::ofstream file(temporary.string(), std::ios::binary | std::ios::trunc);
+                                file.write(reinterpret_cast<const char*>(data.data()), data.size());
+                                if (!file) {
+                                    file.close();
+                                    boost::filesystem::remove(temporary, ec);
+                                    return;
+                                }
+                            }
+                            boost::filesystem::rename(temporary, path, ec);
+                            if (ec) {
+                                boost::filesystem::remove(temporary, ec);
+                            }
+                        }
+
+                        boost::filesystem::path _directory;
+                        std::size_t _limit_bytes = 0;
+                    };
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_LDE_CACHE_HPP
@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_MULTI_PAIRING_HPP
+#define CRYPTO3_ZK_COMMITMENTS_MULTI_PAIRING_HPP
+
+#include <optional>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+                    /**
+                     * Reduced pairing product e(P[0], Q[0]) * ... * e(P[n-1], Q[n-1]) with a single final
+                     * exponentiation. The pairs are split into chunks whose Miller loops run on the HIGH pool, so
+                     * verification shares the cores with the rest of the pool work.
+                     */
+                    template<typename CurveType,
+                             typename PairingPolicy = algebra::pairing::pairing_policy<CurveType>>
+                    std::optional<typename CurveType::gt_type::value_type> parallel_multi_pair_reduced(
+                            const std::vector<typename CurveType::template g1_type<>::value_type> &P,
+                            const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q) {
+                        using gt_value_type = typename CurveType::gt_type::value_type;
+                        BOOST_ASSERT(P.size() == prec_Q.size());
+
+                        std::vector<typename PairingPolicy::g1_precomputed_type> prec_P;
+                        prec_P.reserve(P.size());
+                        for (const auto &p : P) {
+                            prec_P.push_back(PairingPolicy::precompute_g1::process(p));
+                        }
+
+                        std::vector<gt_value_type> chunk_products = wait_for_all(parallel_run_in_chunks<gt_value_type>(
+                            prec_P.size(),
+                            [&prec_P, &prec_Q](std::size_t begin, std::size_t end) {
+                                return PairingPolicy::multi_miller_loop::process(prec_P, prec_Q, begin, end);
+                            },
+                            ThreadPool::PoolLevel::HIGH));
+
+                        gt_value_type f = chunk_products[0];
+                        for (std::size_t i = 1; i < chunk_products.size(); ++i) {
+                            f = f * chunk_products[i];
+                        }
+                        return PairingPolicy::final_exponentiation::process(f);
+                    }
+
+                    // Same as above, the line coefficients of the G2 points are computed on the HIGH pool as well.
+                    template<typename CurveType,
+                             typename PairingPolicy = algebra::pairing::pairing_policy<CurveType>>
+                    std::optional<typename CurveType::gt_type::value_type> parallel_multi_pair_reduced(
+                            const std::vector<typename CurveType::template g1_type<>::value_type> &P,
+                            const std::vector<typename CurveType::template g2_type<>::value_type> &Q) {
+                        BOOST_ASSERT(P.size() == Q.size());
+
+                        std::vector<typename PairingPolicy::g2_precomputed_type> prec_Q(Q.size());
+                        parallel_for(0, Q.size(), [&Q, &prec_Q](std::size_t i) {
+                            prec_Q[i] = PairingPolicy::precompute_g2::process(Q[i]);
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        return parallel_multi_pair_reduced<CurveType, PairingPolicy>(P, prec_Q);
+                    }
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_MULTI_PAIRING_HPP
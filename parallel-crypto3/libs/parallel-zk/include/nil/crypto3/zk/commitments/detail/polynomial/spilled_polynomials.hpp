@@ -0,0 +1,292 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_SPILLED_POLYNOMIALS_HPP
+#define CRYPTO3_ZK_COMMITMENTS_SPILLED_POLYNOMIALS_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/type_traits.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/field_element_block.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+
+                    // Resident set size of the current process in bytes, 0 if it can't be determined.
+                    inline std::size_t current_rss_bytes() {
+                        std::FILE* statm = std::fopen("/proc/self/statm", "r");
+                        if (statm == nullptr) {
+                            return 0;
+                        }
+                        unsigned long total_pages = 0, resident_pages = 0;
+                        int read = std::fscanf(statm, "%lu %lu", &total_pages, &resident_pages);
+                        std::fclose(statm);
+                        if (read != 2) {
+                            return 0;
+                        }
+                        return static_cast<std::size_t>(resident_pages) * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+                    }
+
+                    // Peak resident set size of the current process in bytes.
+                    inline std::size_t peak_rss_bytes() {
+                        struct rusage usage;
+                        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+                            return 0;
+                        }
+                        // ru_maxrss is in kilobytes on Linux.
+                        return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+                    }
+
+                    /**
+                     * Memory budget of a prover. When the resident set grows over the limit, committed polynomial
+                     * batches are moved to scratch files and loaded back one batch at a time when they are needed.
+                     * A limit of 0 disables spilling. The prover owns the budget and hands it to its commitment
+                     * schemes, so provers in one process don't share limits or scratch directories.
+                     */
+                    class memory_budget {
+                    public:
+                        memory_budget() = default;
+
+                        explicit memory_budget(std::size_t limit_bytes,
+                                               const boost::filesystem::path& scratch_directory = {}) :
+                            _limit_bytes(limit_bytes), _scratch_directory(scratch_directory) {
+                        }
+
+                        void set_limit(std::size_t limit_bytes) {
+                            _limit_bytes = limit_bytes;
+                        }
+
+                        std::size_t limit() const {
+                            return _limit_bytes;
+                        }
+
+                        bool enabled() const {
+                            return _limit_bytes != 0;
+                        }
+
+                        // True if spilling is enabled and the process uses more memory than allowed.
+                        bool exceeded() const {
+                            return enabled() && current_rss_bytes() > _limit_bytes;
+                        }
+
+                        void set_scratch_directory(const boost::filesystem::path& directory) {
+                            _scratch_directory = directory;
+                        }
+
+                        boost::filesystem::path scratch_directory() const {
+                            if (_scratch_directory.empty()) {
+                                return boost::filesystem::temp_directory_path();
+                            }
+                            return _scratch_directory;
+                        }
+
+                    private:
+                        std::size_t _limit_bytes = 0;
+                        boost::filesystem::path _scratch_directory;
+                    };
+
+                    /**
+                     * A batch of polynomials stored in an unlinked, memory-mapped scratch file. The values are
+                     * written with the field element codec in Montgomery form, the file never outlives the process.
+                     * The pages of the mapping are file-backed, so the kernel writes them back and drops them from
+                     * the resident set of the prover instead of keeping them in anonymous memory.
+                     */
+                    template<typename PolynomialType>
+                    class spilled_polynomials {
+                    public:
+                        using polynomial_type = PolynomialType;
+                        using value_type = typename polynomial_type::value_type;
+
+                        static_assert(math::is_polynomial<polynomial_type>::value ||
+                                          math::is_polynomial_dfs<polynomial_type>::value,
+                                      "only math::polynomial and math::polynomial_dfs batches can be spilled");
+
+                        spilled_polynomials(const spilled_polynomials&) = delete;
+                        spilled_polynomials& operator=(const spilled_polynomials&) = delete;
+
+                        ~spilled_polynomials() {
+                            if (_data != nullptr) {
+                                munmap(_data, _bytes);
+                            }
+                            if (_fd != -1) {
+                                close(_fd);
+                            }
+                        }
+
+                        /**
+                         * Moves the values of 'polys' to a new scratch file in 'directory', 'polys' is cleared on success.
+                         * \returns nullptr if the scratch file can't be created, 'polys' is left unchanged in this case.
+                         */
+                        static std::shared_ptr<spilled_polynomials> spill(
+                                std::vector<polynomial_type>& polys,
+                                const boost::filesystem::path& directory) {
+                            std::shared_ptr<spilled_polynomials> result(new spilled_polynomials());
+                            for (const auto& poly: polys) {
+                                result->_offsets.push_back(result->_bytes);
+                                result->_sizes.push_back(poly.size());
+                                result->_degrees.push_back(poly.degree());
+                                result->_bytes += poly.size() * element_length;
+                            }
+                            if (result->_bytes == 0) {
+                                return nullptr;
+                            }
+
+                            std::string file_template = (directory / "placeholder-spill-XXXXXX").string();
+                            result->_fd = mkstemp(file_template.data());
+                            if (result->_fd == -1) {
+                                return nullptr;
+                            }
+                            // The file is removed as soon as the descriptor is closed.
+                            unlink(file_template.c_str());
+
+                            if (ftruncate(result->_fd, result->_bytes) != 0) {
+                                return nullptr;
+                            }
+                            void* data = mmap(nullptr, result->_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, result->_fd, 0);
+                            if (data == MAP_FAILED) {
+                                return nullptr;
+                            }
+                            result->_data = static_cast<std::uint8_t*>(data);
+
+                            for (std::size_t i = 0; i < polys.size(); ++i) {
+                                marshalling::types::write_field_elements(
+                                    &*polys[i].begin(), polys[i].size(), result->_data + result->_offsets[i],
+                                    marshalling::types::field_element_encoding::montgomery);
+                            }
+                            // Start writing the pages back and drop them from the resident set.
+                            result->release(0, result->_bytes);
+
+                            polys.clear();
+                            polys.shrink_to_fit();
+                            return result;
+                        }
+
+                        // Reads the polynomials back, the scratch file is kept until the object is destroyed.
+                        std::vector<polynomial_type> load() const {
+                            std::vector<polynomial_type> polys;
+                            polys.reserve(_sizes.size());
+                            for (std::size_t i = 0; i < _sizes.size(); ++i) {
+                                polys.emplace_back(load(i));
+                            }
+                            return polys;
+                        }
+
+                        // Reads polynomial 'i' back, only the pages of this polynomial are touched.
+                        polynomial_type load(std::size_t i) const {
+                            polynomial_type poly = make_polynomial(i);
+                            std::size_t offset = _offsets[i];
+                            std::size_t length = _sizes[i] * element_length;
+                            madvise(page_begin(offset), page_length(offset, length), MADV_SEQUENTIAL);
+                            marshalling::types::read_field_elements(
+                                _data + offset, _sizes[i], &*poly.begin(),
+                                marshalling::types::field_element_encoding::montgomery);
+                            // The pages are clean, dropping them doesn't write anything.
+                            madvise(page_begin(offset), page_length(offset, length), MADV_DONTNEED);
+                            return poly;
+                        }
+
+                        // Number of polynomials in the batch.
+                        std::size_t size() const {
+                            return _sizes.size();
+                        }
+
+                        // Number of values of polynomial 'i', known without reading it back.
+                        std::size_t size(std::size_t i) const {
+                            return _sizes[i];
+                        }
+
+                        // Degree of polynomial 'i', known without reading it back.
+                        std::size_t degree(std::size_t i) const {
+                            return _degrees[i];
+                        }
+
+                        std::size_t bytes() const {
+                            return _bytes;
+                        }
+
+                    private:
+                        static constexpr std::size_t element_length =
+                            marshalling::types::field_element_block_element_length<value_type>();
+
+                        spilled_polynomials() = default;
+
+                        polynomial_type make_polynomial(std::size_t i) const {
+                            if constexpr (math::is_polynomial_dfs<polynomial_type>::value) {
+                                return polynomial_type(_degrees[i], _sizes[i], value_type::zero());
+                            } else {
+                                return polynomial_type(_sizes[i], value_type::zero());
+                            }
+                        }
+
+                        // madvise and msync take page aligned addresses.
+                        std::uint8_t* page_begin(std::size_t offset) const {
+                            return _data + offset - offset % page_size();
+                        }
+
+                        std::size_t page_length(std::size_t offset, std::size_t length) const {
+                            return length + offset % page_size();
+                        }
+
+                        static std::size_t page_size() {
+                            static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+                            return size;
+                        }
+
+                        void release(std::size_t offset, std::size_t length) const {
+                            msync(page_begin(offset), page_length(offset, length), MS_SYNC);
+                            madvise(page_begin(offset), page_length(offset, length), MADV_DONTNEED);
+                        }
+
+                        int _fd = -1;
+                        std::uint8_t* _data = nullptr;
+                        std::size_t _bytes = 0;
+                        std::vector<std::size_t> _offsets;
+                        std::vector<std::size_t> _sizes;
+                        std::vector<std::size_t> _degrees;
+                    };
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_SPILLED_POLYNOMIALS_HPP
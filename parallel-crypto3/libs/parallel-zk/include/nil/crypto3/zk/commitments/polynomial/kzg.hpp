@@ -29,6 +29,8 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_KZG_HPP
 #define CRYPTO3_ZK_COMMITMENTS_KZG_HPP
 
+#include <algorithm>
+#include <map>
 #include <tuple>
 #include <vector>
 #include <set>
@@ -37,11 +39,13 @@
 #include <boost/assert.hpp>
 #include <boost/iterator/zip_iterator.hpp>
 #include <boost/accumulators/accumulators.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_to_affine.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
@@ -53,6 +57,9 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
 #include <nil/crypto3/zk/commitments/batched_commitment.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/multi_pairing.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
 
 using namespace nil::crypto3::math;
 
@@ -62,6 +69,20 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace commitments {
+                namespace detail {
+                    // Brings the points to Z = 1 in place, chunks with their own inversion run on the HIGH pool.
+                    template<typename PointType>
+                    void parallel_batch_normalize(std::vector<PointType> &points) {
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            points.size(),
+                            [&points](std::size_t begin, std::size_t end) {
+                                auto chunk = boost::make_iterator_range(points.begin() + begin, points.begin() + end);
+                                algebra::batch_normalize(chunk);
+                            },
+                            ThreadPool::PoolLevel::HIGH));
+                    }
+                }    // namespace detail
+
                 /**
                  * @brief The KZG Polynomial Commitment with Fiat-Shamir heuristic.
                  *
@@ -104,6 +125,8 @@ namespace nil {
                                 commitment_key[i] = alpha_com;
                                 alpha_com = alpha * alpha_com;
                             }
+                            // Stored with Z = 1, so that commitments add the key with mixed additions.
+                            detail::parallel_batch_normalize(commitment_key);
                         }
 
                         params_type(std::size_t d, scalar_value_type alpha) {
@@ -114,6 +137,8 @@ namespace nil {
                                 commitment_key[i] = alpha_com;
                                 alpha_com = alpha * alpha_com;
                             }
+                            // Stored with Z = 1, so that commitments add the key with mixed additions.
+                            detail::parallel_batch_normalize(commitment_key);
                         }
 
                         params_type(single_commitment_type ck, verification_key_type vk) :
@@ -133,9 +158,65 @@ namespace nil {
                         public_key_type &operator=(const public_key_type &other) = default;
                     };
                 };
+
+                namespace detail {
+                    // Strict weak order of field elements, elements of extension fields are ordered by their coordinates.
+                    template<typename FieldValueType>
+                    bool field_element_less(const FieldValueType &a, const FieldValueType &b) {
+                        if constexpr (algebra::is_extended_field_element<FieldValueType>::value) {
+                            return std::lexicographical_compare(
+                                a.data.begin(), a.data.end(), b.data.begin(), b.data.end(),
+                                field_element_less<typename FieldValueType::underlying_type>);
+                        } else {
+                            return a < b;
+                        }
+                    }
+
+                    /**
+                     * Checks e(P[0], Q[0]) * ... * e(P[n-1], Q[n-1]) == 1 with one multi-Miller loop and a single final
+                     * exponentiation. Terms with equal G2 points are merged in G1 first, as e(a, Q) * e(b, Q) = e(a + b, Q).
+                     * The G2 points are brought to affine form with a single inversion and looked up in a map ordered by
+                     * their coordinates. Terms with the point at infinity are dropped, their pairing is one.
+                     */
+                    template<typename CurveType>
+                    inline bool pairing_product_is_one(
+                            const std::vector<typename CurveType::template g1_type<>::value_type> &P,
+                            const std::vector<typename CurveType::template g2_type<>::value_type> &Q) {
+                        BOOST_ASSERT(P.size() == Q.size());
+
+                        const auto affine_Q = algebra::batch_to_affine(Q);
+                        using affine_type = typename std::decay_t<decltype(affine_Q)>::value_type;
+                        auto affine_less = [](const affine_type &a, const affine_type &b) {
+                            if (a.X != b.X) {
+                                return field_element_less(a.X, b.X);
+                            }
+                            return field_element_less(a.Y, b.Y);
+                        };
+
+                        std::map<affine_type, std::size_t, decltype(affine_less)> merged_indices(affine_less);
+                        std::vector<typename CurveType::template g1_type<>::value_type> merged_P;
+                        std::vector<typename CurveType::template g2_type<>::value_type> merged_Q;
+                        for (std::size_t i = 0; i < P.size(); ++i) {
+                            if (Q[i].is_zero()) {
+                                continue;
+                            }
+                            auto [it, inserted] = merged_indices.emplace(affine_Q[i], merged_P.size());
+                            if (inserted) {
+                                merged_P.push_back(P[i]);
+                                merged_Q.push_back(Q[i]);
+                            } else {
+                                merged_P[it->second] += P[i];
+                            }
+                        }
+
+                        auto result = parallel_multi_pair_reduced<CurveType>(merged_P, merged_Q);
+                        return result && *result == CurveType::gt_type::value_type::one();
+                    }
+                }    // namespace detail
             } // namespace commitments
 
             namespace algorithms {
+
                 template<typename CommitmentSchemeType,
                         typename std::enable_if<
                                 std::is_base_of<
@@ -199,27 +280,14 @@ namespace nil {
                                         const typename CommitmentSchemeType::proof_type &proof,
                                         const typename CommitmentSchemeType::public_key_type &public_key) {
 
-                    auto A_1 = algebra::precompute_g1<typename CommitmentSchemeType::curve_type>(proof);
-                    auto A_2 = algebra::precompute_g2<typename CommitmentSchemeType::curve_type>(
-                            params.verification_key -
-                            public_key.z *
-                            CommitmentSchemeType::curve_type::template g2_type<>::value_type::one());
-                    auto B_1 = algebra::precompute_g1<typename CommitmentSchemeType::curve_type>(
-                            public_key.eval * CommitmentSchemeType::curve_type::template g1_type<>::value_type::one() -
-                            public_key.commit);
-                    auto B_2 = algebra::precompute_g2<typename CommitmentSchemeType::curve_type>(
-                            CommitmentSchemeType::curve_type::template g2_type<>::value_type::one());
-
-                    typename CommitmentSchemeType::gt_value_type gt3 =
-                        algebra::double_miller_loop<typename CommitmentSchemeType::curve_type>( A_1, A_2, B_1, B_2);
-                    std::optional<typename CommitmentSchemeType::gt_value_type> gt_4 =
-                        algebra::final_exponentiation<typename CommitmentSchemeType::curve_type>(gt3);
-
-                    if (!gt_4) {
-                        return false;
-                    }
+                    using curve_type = typename CommitmentSchemeType::curve_type;
+                    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+                    using g2_value_type = typename curve_type::template g2_type<>::value_type;
 
-                    return *gt_4 == CommitmentSchemeType::gt_value_type::one();
+                    // e(proof, vk - z * g2) * e(eval * g1 - commit, g2) == 1
+                    return commitments::detail::pairing_product_is_one<curve_type>(
+                        {proof, public_key.eval * g1_value_type::one() - public_key.commit},
+                        {params.verification_key - public_key.z * g2_value_type::one(), g2_value_type::one()});
                 }
             } // namespace algorithms
 
@@ -282,6 +350,7 @@ namespace nil {
                                 commitment_key[i] = alpha_comm;
                                 alpha_comm *= alpha;
                             }
+                            detail::parallel_batch_normalize(commitment_key);
                             auto alpha_ver = verification_key_type::one();
                             for (std::size_t i = 0; i <= t; ++i) {
                                 verification_key[i] = alpha_ver;
@@ -297,6 +366,7 @@ namespace nil {
                                 commitment_key[i] = alpha_comm;
                                 alpha_comm = alpha * alpha_comm;
                             }
+                            detail::parallel_batch_normalize(commitment_key);
                             auto alpha_ver = verification_key_type::one();
                             for (std::size_t i = 0; i <= t; ++i) {
                                 verification_key[i] = alpha_ver;
@@ -379,15 +449,15 @@ namespace nil {
                 create_evals_polys(const typename CommitmentSchemeType::batch_of_polynomials_type &polys,
                                    const std::vector<std::vector<typename CommitmentSchemeType::scalar_value_type>> S) {
                     BOOST_ASSERT(polys.size() == S.size());
-                    std::vector<typename CommitmentSchemeType::polynomial_type> rs(polys.size());
+                    std::vector<std::vector<std::pair<typename CommitmentSchemeType::scalar_value_type, typename CommitmentSchemeType::scalar_value_type>>> evals(polys.size());
                     for (std::size_t i = 0; i < polys.size(); ++i) {
-                        typename std::vector<std::pair<typename CommitmentSchemeType::scalar_value_type, typename CommitmentSchemeType::scalar_value_type>> evals;
                         for (auto s: S[i]) {
-                            evals.push_back(std::make_pair(s, polys[i].evaluate(s)));
+                            evals[i].push_back(std::make_pair(s, polys[i].evaluate(s)));
                         }
-                        rs[i] = math::lagrange_interpolation(evals);
                     }
-                    return rs;
+                    auto interpolants = math::lagrange_interpolation_batch(evals);
+                    return std::vector<typename CommitmentSchemeType::polynomial_type>(
+                        std::make_move_iterator(interpolants.begin()), std::make_move_iterator(interpolants.end()));
                 }
 
                 template<typename CommitmentSchemeType, typename PolynomialType=typename CommitmentSchemeType::polynomial_type,
@@ -607,8 +677,10 @@ namespace nil {
 
                     auto gamma = transcript.template challenge<typename CommitmentSchemeType::curve_type::scalar_field_type>();
                     auto factor = CommitmentSchemeType::scalar_value_type::one();
-                    auto left_side_pairing = CommitmentSchemeType::gt_value_type::one();
 
+                    // prod_i e(gamma^i * (commit_i - r_i), [Z_{T \ S_i}]_2) == e(proof, [Z_T]_2)
+                    std::vector<typename CommitmentSchemeType::curve_type::template g1_type<>::value_type> P;
+                    std::vector<typename CommitmentSchemeType::verification_key_type> Q;
                     for (std::size_t i = 0; i < public_key.commits.size(); ++i) {
                         auto r_commit = commit_one<CommitmentSchemeType>(params, public_key.r[i]);
                         auto left = factor * (public_key.commits[i] - r_commit);
@@ -619,22 +691,15 @@ namespace nil {
                             assert(right == CommitmentSchemeType::verification_key_type::one());
                         }
 
-                        auto left_right = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(left, right);
-                        if (!left_right) {
-                            return false;
-                        }
-                        left_side_pairing = left_side_pairing * (*left_right);
+                        P.push_back(left);
+                        Q.push_back(right);
                         factor = factor * gamma;
                     }
 
-                    auto right = commit_g2<CommitmentSchemeType>(params, create_polynom_by_zeros<CommitmentSchemeType>( public_key.T));
-                    auto right_side_pairing = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(proof, right);
+                    P.push_back(-proof);
+                    Q.push_back(commit_g2<CommitmentSchemeType>(params, create_polynom_by_zeros<CommitmentSchemeType>( public_key.T)));
 
-                    if (!right_side_pairing) {
-                        return false;
-                    }
-
-                    return left_side_pairing == *right_side_pairing;
+                    return commitments::detail::pairing_product_is_one<typename CommitmentSchemeType::curve_type>(P, Q);
                 }
             } // namespace algorithms
 
@@ -828,7 +893,8 @@ namespace nil {
 
                         auto gamma = transcript.template challenge<typename CommitmentSchemeType::curve_type::scalar_field_type>();
                         auto factor = CommitmentSchemeType::scalar_value_type::one();
-                        auto left_side_accum = CommitmentSchemeType::gt_value_type::one();
+                        std::vector<typename curve_type::template g1_type<>::value_type> P;
+                        std::vector<typename CommitmentSchemeType::verification_key_type> Q;
 
                         for (const auto &it: this->_commitments) {
                             auto k = it.first;
@@ -849,27 +915,16 @@ namespace nil {
                                 auto diffpoly = set_difference_polynom(_merged_points, this->_points.at(k)[i]);
                                 auto diffpoly_commitment = commit_g2(diffpoly);
 
-                                auto left_side_pairing = nil::crypto3::algebra::pair_reduced<curve_type>
-                                    (factor * (i_th_commitment - U_commit), diffpoly_commitment);
-                                if (!left_side_pairing) {
-                                    return false;
-                                }
-
-                                left_side_accum = left_side_accum * (*left_side_pairing);
+                                P.push_back(factor * (i_th_commitment - U_commit));
+                                Q.push_back(diffpoly_commitment);
                                 factor *= gamma;
                             }
                         }
 
-                        auto right_side_pairing = algebra::pair_reduced<typename CommitmentSchemeType::curve_type>(
-                                proof.kzg_proof,
-                                commit_g2(this->get_V(this->_merged_points))
-                        );
-
-                        if (!right_side_pairing) {
-                            return false;
-                        }
+                        P.push_back(-proof.kzg_proof);
+                        Q.push_back(commit_g2(this->get_V(this->_merged_points)));
 
-                        return left_side_accum == *right_side_pairing;
+                        return nil::crypto3::zk::commitments::detail::pairing_product_is_one<curve_type>(P, Q);
                     }
 
                     const params_type &get_commitment_params() const {
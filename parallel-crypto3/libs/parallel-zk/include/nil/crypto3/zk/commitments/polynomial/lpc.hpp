@@ -30,14 +30,21 @@
 #ifndef CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 #define CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 
+#include <memory>
+#include <optional>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/polynomial/barycentric_evaluation.hpp>
+#include <nil/crypto3/math/type_traits.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
 
 #include <nil/crypto3/zk/commitments/batched_commitment.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/basic_fri.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/lde_cache.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
 #include <nil/actor/core/parallelization_utils.hpp>
@@ -82,6 +89,64 @@ namespace nil {
                     value_type _etha;
                     std::map<std::size_t, bool> _batch_fixed;
                     preprocessed_data_type _fixed_polys_values;
+                    // Not a part of the scheme state, copies of the scheme share the cache.
+                    std::shared_ptr<detail::lde_cache> _lde_cache;
+
+                    /** \brief Computes the merkle tree of the batch through detail::lde_cache. The tree of a batch with
+                     *  all the columns unchanged since an earlier commitment is read from the cache, otherwise only the
+                     *  columns missing in the cache are extended to the FRI domain, the leaves are hashed from the
+                     *  cached and the new extensions. New extensions and the tree are stored to the cache.
+                     */
+                    precommitment_type precommit_with_cache(const std::vector<polynomial_type>& polys) {
+                        const auto& D = _fri_params.D[0];
+                        const std::size_t fri_step = _fri_params.step_list.front();
+
+                        if constexpr (!math::is_polynomial_dfs<polynomial_type>::value) {
+                            return nil::crypto3::zk::algorithms::precommit<fri_type>(polys, D, fri_step);
+                        } else {
+                            PROFILE_SCOPE("LPC precommit with LDE cache");
+                            detail::lde_cache& cache = *_lde_cache;
+                            static const detail::lde_cache::fingerprint_type tag =
+                                detail::lde_cache::type_tag<field_type, precommitment_type>();
+
+                            std::vector<detail::lde_cache::fingerprint_type> fingerprints(polys.size());
+                            parallel_for(0, polys.size(), [&polys, &fingerprints](std::size_t i) {
+                                fingerprints[i] = detail::lde_cache::fingerprint(polys[i], tag);
+                            }, ThreadPool::PoolLevel::HIGH);
+                            const auto batch_fingerprint =
+                                detail::lde_cache::fingerprint(fingerprints, D->size(), fri_step, tag);
+
+                            precommitment_type tree;
+                            if (cache.load_tree(batch_fingerprint, tree)) {
+                                return tree;
+                            }
+
+                            // Resize uses low level thread pool, so we need to use the high level one here.
+                            std::vector<polynomial_type> extended(polys.size());
+                            parallel_for(0, polys.size(), [&polys, &fingerprints, &extended, &cache, &D](
+                                    std::size_t i) {
+                                if (polys[i].size() == D->size()) {
+                                    extended[i] = polys[i];
+                                } else if (!cache.load_polynomial(fingerprints[i], D->size(), extended[i])) {
+                                    extended[i] = polys[i];
+                                    extended[i].resize(D->size(), nullptr, D);
+                                    cache.store_polynomial(fingerprints[i], extended[i]);
+                                }
+                            }, ThreadPool::PoolLevel::HIGH);
+
+                            tree = nil::crypto3::zk::algorithms::precommit<fri_type>(std::move(extended), D, fri_step);
+                            cache.store_tree(batch_fingerprint, tree);
+                            cache.prune();
+                            return tree;
+                        }
+                    }
+
+                    // Gives the committed batches to FRI one at a time, spilled batches are read back on request.
+                    nil::crypto3::zk::algorithms::polynomial_batch_loader<polynomial_type> batch_loader() const {
+                        return [this](std::size_t index) {
+                            return this->get_batch(index);
+                        };
+                    }
 
                 public:
                     // Getters for the upper fields. Used from marshalling only so far.
@@ -94,6 +159,10 @@ namespace nil {
                     // We must set it in verifier, taking this value from common data.
                     void set_fixed_polys_values(const preprocessed_data_type& value) {_fixed_polys_values = value;}
 
+                    // Batches are committed through the cache if it is set and enabled.
+                    void set_lde_cache(std::shared_ptr<detail::lde_cache> cache) {_lde_cache = std::move(cache);}
+                    const std::shared_ptr<detail::lde_cache>& get_lde_cache() const {return _lde_cache;}
+
                     // This constructor is normally used from marshalling, to recover the LPC state from a file.
                     // Maybe we want the move variant of this constructor.
                     lpc_commitment_scheme(
@@ -124,8 +193,19 @@ namespace nil {
                             if (!fixed)
                                 continue;
                             result[index] = {};
-                            for (const auto& poly: this->_polys.at(index)){
-                                result[index].push_back(poly.evaluate(etha));
+                            // The batch may have been spilled right after the commitment.
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = this->get_batch(index);
+                            const std::vector<polynomial_type>& polys = *batch;
+                            if constexpr (math::is_polynomial_dfs<polynomial_type>::value) {
+                                auto values = math::evaluate_barycentric(
+                                    polys, std::vector<std::vector<value_type>>(polys.size(), {etha}));
+                                for (const auto& poly_values: values) {
+                                    result[index].push_back(poly_values[0]);
+                                }
+                            } else {
+                                for (const auto& poly: polys){
+                                    result[index].push_back(poly.evaluate(etha));
+                                }
                             }
                         }
                         return result;
@@ -137,13 +217,55 @@ namespace nil {
                     }
 
                     commitment_type commit(std::size_t index) {
+                        TRACE_SCOPE_ARG("LPC commit", "batch", index);
                         this->state_commited(index);
 
-                        _trees[index] = nil::crypto3::zk::algorithms::precommit<fri_type>(
-                            this->_polys[index], _fri_params.D[0], _fri_params.step_list.front());
+                        if (_lde_cache && _lde_cache->enabled()) {
+                            _trees[index] = precommit_with_cache(this->_polys[index]);
+                        } else {
+                            _trees[index] = nil::crypto3::zk::algorithms::precommit<fri_type>(
+                                this->_polys[index], _fri_params.D[0], _fri_params.step_list.front());
+                        }
+
+                        // Committed batches are not used again until the evaluation proof.
+                        this->spill_committed_batches_over_budget();
                         return _trees[index].root();
                     }
 
+                    /** \brief Recomputes the merkle trees of already committed batches from the stored polynomials.
+                     *  Used when the commitment scheme state was saved without the trees. Batches are processed
+                     *  in parallel, each precommit parallelizes over the leaves on the lower level pools.
+                     *  \param roots Expected roots of the trees, one per batch index.
+                     *  \returns false if any of the rebuilt roots does not match the expected one.
+                     */
+                    bool rebuild_trees(const std::map<std::size_t, commitment_type>& roots) {
+                        PROFILE_SCOPE("LPC rebuild trees");
+
+                        std::vector<std::size_t> indices;
+                        for (auto const& [index, root]: roots) {
+                            if (this->_polys.find(index) == this->_polys.end()) {
+                                return false;
+                            }
+                            indices.push_back(index);
+                        }
+
+                        std::vector<precommitment_type> trees(indices.size());
+                        // Spilled batches are read back by the task rebuilding their tree and freed when it is done.
+                        parallel_for(0, indices.size(), [this, &indices, &trees](std::size_t i) {
+                            trees[i] = nil::crypto3::zk::algorithms::precommit<fri_type>(
+                                *this->get_batch(indices[i]), _fri_params.D[0], _fri_params.step_list.front());
+                        }, ThreadPool::PoolLevel::LASTPOOL);
+
+                        for (std::size_t i = 0; i < indices.size(); ++i) {
+                            if (trees[i].root() != roots.at(indices[i])) {
+                                return false;
+                            }
+                            _trees[indices[i]] = std::move(trees[i]);
+                        }
+                        this->spill_committed_batches_over_budget();
+                        return true;
+                    }
+
                     // Should be done after commitment.
                     void mark_batch_as_fixed(std::size_t index) {
                         _batch_fixed[index] = true;
@@ -183,10 +305,9 @@ namespace nil {
                     lpc_proof_type proof_eval_lpc_proof(
                             const polynomial_type& combined_Q,
                             const std::vector<typename fri_type::field_type::value_type>& challenges) {
-
                         typename fri_type::initial_proofs_batch_type initial_proofs =
                             nil::crypto3::zk::algorithms::query_phase_initial_proofs<fri_type, polynomial_type>(
-                            this->_trees, this->_fri_params, this->_polys, challenges);
+                            this->_trees, this->_fri_params, batch_loader(), challenges);
                         return {this->_z, initial_proofs};
                     }
 
@@ -255,7 +376,7 @@ namespace nil {
 
                         typename fri_type::proof_type fri_proof = nil::crypto3::zk::algorithms::proof_eval<
                                 fri_type, polynomial_type>(
-                            this->_polys,
+                            batch_loader(),
                             combined_Q,
                             this->_trees,
                             combined_Q_precommitment,
@@ -275,6 +396,190 @@ namespace nil {
                     polynomial_type prepare_combined_Q(
                             const typename field_type::value_type& theta,
                             std::size_t starting_power = 0) {
+                        if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
+                            std::optional<polynomial_type> combined_Q =
+                                prepare_combined_Q_on_evaluation_domain(theta, starting_power);
+                            if (combined_Q) {
+                                return std::move(*combined_Q);
+                            }
+                        }
+                        return prepare_combined_Q_in_coefficient_form(theta, starting_power);
+                    }
+
+                    /** \brief Computes combined_Q directly on the evaluation domain of the committed polynomials.
+                     * Each evaluation point z contributes (sum theta^k * (f_k(x) - f_k(z))) / (x - z), the values f_k(x)
+                     * are taken from the committed DFS polynomials and the denominators are inverted in batches,
+                     * so no polynomial is converted to the coefficient form. Spilled batches are read back one at a time.
+                     * \returns std::nullopt if some evaluation point lies in the evaluation domain, in this case
+                     * combined_Q must be computed in the coefficient form.
+                     */
+                    std::optional<polynomial_type> prepare_combined_Q_on_evaluation_domain(
+                            const typename field_type::value_type& theta,
+                            std::size_t starting_power = 0) {
+                        PROFILE_SCOPE("LPC prepare combined_Q on evaluation domain");
+
+                        this->build_points_map();
+
+                        // Polynomials opened at the same point are summed up with their powers of theta, the sum of
+                        // their evaluations at the point goes to 'constant'.
+                        struct opening_type {
+                            value_type point;
+                            value_type constant;
+                            std::vector<std::tuple<std::size_t, std::size_t, value_type>> terms;
+                        };
+                        std::vector<opening_type> openings;
+
+                        // Powers of theta are consumed in the same order as in the verifier.
+                        value_type theta_acc = theta.pow(starting_power);
+                        for (auto const& point: this->get_unique_points()) {
+                            opening_type opening{point, value_type::zero(), {}};
+                            for (std::size_t i: this->_z.get_batches()) {
+                                for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
+                                    auto iter = this->_points_map[i][j].find(point);
+                                    if (iter == this->_points_map[i][j].end())
+                                        continue;
+                                    opening.terms.emplace_back(i, j, theta_acc);
+                                    opening.constant += this->_z.get(i, j, iter->second) * theta_acc;
+                                    theta_acc *= theta;
+                                }
+                            }
+                            openings.push_back(std::move(opening));
+                        }
+
+                        opening_type etha_opening{_etha, value_type::zero(), {}};
+                        for (std::size_t i: this->_z.get_batches()) {
+                            if (_batch_fixed.find(i) == _batch_fixed.end() || !_batch_fixed[i])
+                                continue;
+                            for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
+                                etha_opening.terms.emplace_back(i, j, theta_acc);
+                                etha_opening.constant += _fixed_polys_values[i][j] * theta_acc;
+                                theta_acc *= theta;
+                            }
+                        }
+                        if (!etha_opening.terms.empty()) {
+                            openings.push_back(std::move(etha_opening));
+                        }
+
+                        // All the polynomials are brought to the largest domain among them, the result is exact on
+                        // it since the degree of combined_Q is lower than the degree of any summand.
+                        std::size_t domain_size = 1;
+                        std::size_t max_degree = 0;
+                        for (const auto& opening: openings) {
+                            for (const auto& [i, j, coeff]: opening.terms) {
+                                domain_size = std::max(domain_size, this->get_poly_size(i, j));
+                                max_degree = std::max(max_degree, this->get_poly_degree(i, j));
+                            }
+                        }
+
+                        // z lies in the domain iff it is a root of unity of the domain size.
+                        for (const auto& opening: openings) {
+                            if (opening.point.pow(domain_size) == value_type::one())
+                                return std::nullopt;
+                        }
+
+                        // Terms of each opening grouped by batch, the batches are loaded one at a time. The constant
+                        // of an opening is added together with the terms of the first batch it has terms in.
+                        std::map<std::size_t, std::vector<std::vector<std::pair<std::size_t, value_type>>>> batch_terms;
+                        for (std::size_t p = 0; p < openings.size(); p++) {
+                            for (const auto& [i, j, coeff]: openings[p].terms) {
+                                auto& terms = batch_terms[i];
+                                terms.resize(openings.size());
+                                terms[p].emplace_back(j, coeff);
+                            }
+                        }
+                        std::vector<std::size_t> constant_batch(openings.size());
+                        for (std::size_t p = 0; p < openings.size(); p++) {
+                            constant_batch[p] = std::get<0>(openings[p].terms.front());
+                            for (const auto& [i, j, coeff]: openings[p].terms) {
+                                constant_batch[p] = std::min(constant_batch[p], i);
+                            }
+                        }
+
+                        const value_type omega = math::unity_root<field_type>(domain_size);
+                        polynomial_type combined_Q(max_degree > 0 ? max_degree - 1 : 0, domain_size);
+
+                        for (const auto& [i, terms]: batch_terms) {
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = this->get_batch(i);
+
+                            std::map<std::size_t, polynomial_type> resized_polys;
+                            for (const auto& opening_terms: terms) {
+                                for (const auto& [j, coeff]: opening_terms) {
+                                    if ((*batch)[j].size() != domain_size)
+                                        resized_polys.emplace(j, polynomial_type());
+                                }
+                            }
+                            std::vector<typename decltype(resized_polys)::iterator> resized_iters;
+                            for (auto it = resized_polys.begin(); it != resized_polys.end(); ++it) {
+                                resized_iters.push_back(it);
+                            }
+                            parallel_for(0, resized_iters.size(), [&batch, &resized_iters, domain_size](std::size_t k) {
+                                auto& [j, poly] = *resized_iters[k];
+                                poly = (*batch)[j];
+                                poly.resize(domain_size);
+                            }, ThreadPool::PoolLevel::HIGH);
+
+                            // Pointers to the values of each term on the common domain.
+                            std::vector<std::vector<std::pair<const polynomial_type*, value_type>>> opening_values(
+                                openings.size());
+                            for (std::size_t p = 0; p < openings.size(); p++) {
+                                for (const auto& [j, coeff]: terms[p]) {
+                                    auto it = resized_polys.find(j);
+                                    opening_values[p].emplace_back(
+                                        it == resized_polys.end() ? &(*batch)[j] : &it->second, coeff);
+                                }
+                            }
+
+                            const std::size_t batch_index = i;
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                domain_size,
+                                [&openings, &opening_values, &constant_batch, &combined_Q, &omega, batch_index](
+                                        std::size_t begin, std::size_t end) {
+                                    std::vector<value_type> denominators(end - begin);
+                                    std::vector<value_type> prefix(end - begin);
+                                    const value_type x_begin = omega.pow(begin);
+
+                                    for (std::size_t p = 0; p < openings.size(); p++) {
+                                        if (opening_values[p].empty())
+                                            continue;
+
+                                        // Batch inversion of (x - z) for all x in the chunk.
+                                        value_type x = x_begin;
+                                        value_type acc = value_type::one();
+                                        for (std::size_t k = 0; k < end - begin; k++) {
+                                            denominators[k] = x - openings[p].point;
+                                            prefix[k] = acc;
+                                            acc *= denominators[k];
+                                            x *= omega;
+                                        }
+                                        acc = acc.inversed();
+                                        for (std::size_t k = end - begin; k > 0; k--) {
+                                            value_type inverse = acc * prefix[k - 1];
+                                            acc *= denominators[k - 1];
+                                            denominators[k - 1] = inverse;
+                                        }
+
+                                        const value_type constant = constant_batch[p] == batch_index ?
+                                            -openings[p].constant : value_type::zero();
+                                        for (std::size_t k = 0; k < end - begin; k++) {
+                                            value_type numerator = constant;
+                                            for (const auto& [poly, coeff]: opening_values[p]) {
+                                                numerator += (*poly)[begin + k] * coeff;
+                                            }
+                                            combined_Q[begin + k] += numerator * denominators[k];
+                                        }
+                                    }
+                                }));
+                        }
+
+                        if (combined_Q.size() != _fri_params.D[0]->size()) {
+                            combined_Q.resize(_fri_params.D[0]->size(), nullptr, _fri_params.D[0]);
+                        }
+                        return combined_Q;
+                    }
+
+                    polynomial_type prepare_combined_Q_in_coefficient_form(
+                            const typename field_type::value_type& theta,
+                            std::size_t starting_power = 0) {
                         this->build_points_map();
 
                         typename field_type::value_type theta_acc = theta.pow(starting_power);
@@ -290,19 +595,15 @@ namespace nil {
                         // of the loop over the points.
                         std::vector<std::size_t> theta_powers;
 
-                        // Write point and back indices into a vector, so it's easier to parallelize.
-                        std::vector<std::pair<std::size_t, std::size_t>> point_batch_pairs;
-
-                        // An array of the same size as point_batch_pairs, showing starting power of theta for
-                        // each entry of 'point_batch_pairs'.
-                        std::vector<std::size_t> theta_powers_for_each_batch;
+                        // Starting power of theta for each pair of point and batch, indexed as
+                        // [point_index][batch_idx].
+                        std::vector<std::vector<std::size_t>> theta_powers_for_each_batch(points.size());
 
                         theta_powers.push_back(starting_power);
                         std::size_t current_power = starting_power;
                         for (std::size_t point_index = 0; point_index < points.size(); ++point_index) {
                             for(std::size_t batch_idx = 0; batch_idx < this->_z.get_batches().size(); ++batch_idx) {
-                                point_batch_pairs.push_back({point_index, batch_idx});
-                                theta_powers_for_each_batch.push_back(current_power);
+                                theta_powers_for_each_batch[point_index].push_back(current_power);
 
                                 std::size_t i = this->_z.get_batches()[batch_idx];
                                 for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
@@ -313,57 +614,73 @@ namespace nil {
                             theta_powers.push_back(current_power);
                         }
 
-                        // If PolynomialType is DFS type, we need to convert this->polys to coefficients form,
-                        // otherwise we do nothing. After this block polys_coefficients_ptr must be used,
-                        // it will point to this->_polys if no conversion is required, or to polys_coefficients
-                        // if conversion was required.
-                        std::map<std::size_t, std::vector<math::polynomial<value_type>>> polys_coefficients;
-                        std::map<std::size_t, std::vector<math::polynomial<value_type>>>* polys_coefficients_ptr;
-
-                        if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
-                            // Convert this->_polys to coefficients form.
-                            std::vector<std::pair<std::size_t, std::size_t>> indices;
-                            for (const auto& [i, V]: this->_polys) {
-                                polys_coefficients[i].resize(V.size());
-                                for (std::size_t j = 0; j < V.size(); ++j) {
-                                    indices.push_back({i, j});
-                                }
-                            }
-
-                            parallel_for(0, indices.size(), [this, &indices, &polys_coefficients](std::size_t i) {
-                                polys_coefficients[indices[i].first][indices[i].second] =
-                                    this->_polys[indices[i].first][indices[i].second].coefficients();
-                            }, ThreadPool::PoolLevel::HIGH);
-
-                            polys_coefficients_ptr = &polys_coefficients;
-                        } else {
-                            polys_coefficients_ptr = &this->_polys;
+                        std::vector<std::size_t> etha_theta_powers = {theta_powers[points.size()]};
+                        for(std::size_t i : this->_z.get_batches()) {
+                            etha_theta_powers.push_back(etha_theta_powers.back() + this->_z.get_batch_size(i));
                         }
 
                         std::vector<std::vector<math::polynomial<value_type>>> Q_normal_parts(
                             points.size(), std::vector<math::polynomial<value_type>>(this->_z.get_batches().size()));
+                        std::vector<math::polynomial<value_type>> etha_Q_normals(this->_z.get_batches().size());
 
-                        parallel_for(0, point_batch_pairs.size(),
-                            [this, &points, &theta, &theta_powers, polys_coefficients_ptr, &point_batch_pairs, &Q_normal_parts, &theta_powers_for_each_batch]
-                                (std::size_t point_batch_index) {
-                            typename field_type::value_type theta_acc = theta.pow(theta_powers_for_each_batch[point_batch_index]);
-                            std::size_t point_index = point_batch_pairs[point_batch_index].first;
-                            auto const &point = points[point_index];
+                        // Batches are converted to coefficients form one by one, so only one of them is kept in both
+                        // forms at a time.
+                        for (std::size_t batch_idx = 0; batch_idx < this->_z.get_batches().size(); ++batch_idx) {
+                            std::size_t i = this->_z.get_batches()[batch_idx];
+                            std::shared_ptr<const std::vector<polynomial_type>> batch = this->get_batch(i);
+
+                            // If PolynomialType is DFS type, we need to convert the batch to coefficients form,
+                            // otherwise we do nothing. After this block polys_coefficients_ptr must be used.
+                            std::vector<math::polynomial<value_type>> polys_coefficients;
+                            const std::vector<math::polynomial<value_type>>* polys_coefficients_ptr;
+
+                            if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
+                                polys_coefficients.resize(batch->size());
+                                parallel_for(0, batch->size(), [&batch, &polys_coefficients](std::size_t j) {
+                                    polys_coefficients[j] = (*batch)[j].coefficients();
+                                }, ThreadPool::PoolLevel::HIGH);
+                                batch.reset();
+                                polys_coefficients_ptr = &polys_coefficients;
+                            } else {
+                                polys_coefficients_ptr = batch.get();
+                            }
 
-                            std::size_t i = this->_z.get_batches()[point_batch_pairs[point_batch_index].second];
-                            for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
-                                auto iter = this->_points_map[i][j].find(point);
-                                if (iter == this->_points_map[i][j].end())
-                                    continue;
+                            parallel_for(0, points.size(),
+                                [this, &points, &theta, polys_coefficients_ptr, &Q_normal_parts, &theta_powers_for_each_batch, batch_idx, i]
+                                    (std::size_t point_index) {
+                                typename field_type::value_type theta_acc = theta.pow(theta_powers_for_each_batch[point_index][batch_idx]);
+                                auto const &point = points[point_index];
 
-                                math::polynomial<value_type> g_normal = (*polys_coefficients_ptr)[i][j];
-                                g_normal *= theta_acc;
-                                Q_normal_parts[point_index][point_batch_pairs[point_batch_index].second] += g_normal;
-                                Q_normal_parts[point_index][point_batch_pairs[point_batch_index].second] -=
-                                    this->_z.get(i, j, iter->second) * theta_acc;
-                                theta_acc *= theta;
+                                for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
+                                    auto iter = this->_points_map[i][j].find(point);
+                                    if (iter == this->_points_map[i][j].end())
+                                        continue;
+
+                                    math::polynomial<value_type> g_normal = (*polys_coefficients_ptr)[j];
+                                    g_normal *= theta_acc;
+                                    Q_normal_parts[point_index][batch_idx] += g_normal;
+                                    Q_normal_parts[point_index][batch_idx] -= this->_z.get(i, j, iter->second) * theta_acc;
+                                    theta_acc *= theta;
+                                }
+                            }, ThreadPool::PoolLevel::HIGH);
+
+                            // TODO(martun): the following code is the same as above with point = _etha, de-duplicate it.
+                            if( _batch_fixed.find(i) != _batch_fixed.end() && _batch_fixed[i] ) {
+                                typename field_type::value_type theta_acc = theta.pow(etha_theta_powers[i]);
+                                math::polynomial<value_type>& Q_normal = etha_Q_normals[batch_idx];
+                                math::polynomial<value_type> V = {-_etha, 1u};
+
+                                for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++){
+                                    math::polynomial<value_type> g_normal = (*polys_coefficients_ptr)[j];
+                                    g_normal *= theta_acc;
+                                    Q_normal += g_normal;
+                                    Q_normal -= _fixed_polys_values[i][j] * theta_acc;
+                                    theta_acc *= theta;
+                                }
+
+                                Q_normal = Q_normal / V;
                             }
-                        }, ThreadPool::PoolLevel::HIGH);
+                        }
 
                         parallel_for(0, points.size(), [this, &points, &Q_normals, &Q_normal_parts](std::size_t point_index) {
                             math::polynomial<value_type>& Q_normal = Q_normals[point_index];
@@ -379,36 +696,7 @@ namespace nil {
                         for (const auto& Q_normal: Q_normals) {
                             combined_Q_normal += Q_normal;
                         }
-
-                        // TODO(martun): the following code is the same as above with point = _etha, de-duplicate it.
-                        theta_powers = {theta_powers[points.size()]};
-                        for(std::size_t i : this->_z.get_batches()) {
-                            theta_powers.push_back(theta_powers.back() + this->_z.get_batch_size(i));
-                        }
-                        Q_normals.assign(this->_z.get_batches().size(), math::polynomial<value_type>{});
-
-                        parallel_for(0, this->_z.get_batches().size(), [this, &theta, &theta_powers, &Q_normals, polys_coefficients_ptr](std::size_t batch_idx) {
-                            std::size_t i = this->_z.get_batches()[batch_idx];
-                            typename field_type::value_type theta_acc = theta.pow(theta_powers[i]);
-
-                            if( _batch_fixed.find(i) == _batch_fixed.end() || !_batch_fixed[i] )
-                                return;
-                            math::polynomial<value_type>& Q_normal = Q_normals[batch_idx];
-                            auto point = _etha;
-                            math::polynomial<value_type> V = {-point, 1u};
-
-                            for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++){
-                                math::polynomial<value_type> g_normal = (*polys_coefficients_ptr)[i][j];
-                                g_normal *= theta_acc;
-                                Q_normal += g_normal;
-                                Q_normal -= _fixed_polys_values[i][j] * theta_acc;
-                                theta_acc *= theta;
-                            }
-
-                            Q_normal = Q_normal / V;
-                        }, ThreadPool::PoolLevel::HIGH);
-
-                        for (const auto& Q_normal: Q_normals) {
+                        for (const auto& Q_normal: etha_Q_normals) {
                             combined_Q_normal += Q_normal;
                         }
 
@@ -78,6 +78,12 @@ namespace nil {
                         _witnesses.resize(new_size);
                     }
 
+                    void reserve_rows(std::uint32_t rows_amount) {
+                        for (auto &column : _witnesses) {
+                            column.reserve(rows_amount);
+                        }
+                    }
+
                     std::uint32_t witnesses_amount() const {
                         return _witnesses.size();
                     }
@@ -146,6 +152,11 @@ namespace nil {
                         typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd
                     );
 
+                    friend std::uint32_t zk_padding<FieldType, ColumnType>(
+                        plonk_table<FieldType, ColumnType> &table,
+                        const nil::crypto3::random::chacha_field_engine<FieldType> &rnd
+                    );
+
                     friend class nil::blueprint::assignment<plonk_constraint_system<FieldType>>;
                     friend class plonk_table<FieldType, ColumnType>;
                 };
@@ -187,6 +198,14 @@ namespace nil {
                         return _public_inputs.size();
                     }
 
+                    void reserve_rows(std::uint32_t rows_amount) {
+                        for (auto *columns : {&_public_inputs, &_constants, &_selectors}) {
+                            for (auto &column : *columns) {
+                                column.reserve(rows_amount);
+                            }
+                        }
+                    }
+
                     void resize_public_inputs(std::uint32_t new_size) {
                         _public_inputs.resize(new_size);
                     }
@@ -304,6 +323,11 @@ namespace nil {
                         typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd
                     );
 
+                    friend std::uint32_t zk_padding<FieldType, ColumnType>(
+                        plonk_table<FieldType, ColumnType> &table,
+                        const nil::crypto3::random::chacha_field_engine<FieldType> &rnd
+                    );
+
                     friend class nil::blueprint::assignment<plonk_constraint_system<FieldType>>;
                     friend class plonk_table<FieldType, ColumnType>;
                 };
@@ -467,6 +491,15 @@ namespace nil {
                         _public_table.resize_selectors(new_size);
                     }
 
+                    /**
+                     * Reserves every column for rows_amount rows, so filling and padding the table up to that
+                     * size does not reallocate the columns.
+                     */
+                    void reserve_rows(std::uint32_t rows_amount) {
+                        _private_table.reserve_rows(rows_amount);
+                        _public_table.reserve_rows(rows_amount);
+                    }
+
                     const ColumnType& operator[](std::uint32_t index) const {
                         if (index < _private_table.size())
                             return _private_table[index];
@@ -565,6 +598,11 @@ namespace nil {
                         plonk_table &table,
                         typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd
                     );
+
+                    friend std::uint32_t zk_padding<FieldType, ColumnType>(
+                        plonk_table<FieldType, ColumnType> &table,
+                        const nil::crypto3::random::chacha_field_engine<FieldType> &rnd
+                    );
                 };
 
                 template<typename FieldType>
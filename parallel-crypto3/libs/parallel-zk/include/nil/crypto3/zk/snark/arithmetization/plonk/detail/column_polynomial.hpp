@@ -96,6 +96,12 @@ namespace nil {
 
                         std::size_t d = std::distance(column_assignment.begin(), column_assignment.end()) - 1;
 
+                        // Padded columns already have the domain size, their storage is adopted as is.
+                        if (column_assignment.size() == domain->size()) {
+                            return nil::crypto3::math::polynomial_dfs<typename FieldType::value_type>(
+                                d, std::move(column_assignment));
+                        }
+
                         nil::crypto3::math::polynomial_dfs<typename FieldType::value_type> res(
                             d, column_assignment.begin(), column_assignment.end());
 
@@ -28,6 +28,10 @@
 
 #include <nil/crypto3/random/algebraic_random_device.hpp>
 #include <nil/crypto3/random/algebraic_engine.hpp>
+#include <nil/crypto3/random/chacha_field_engine.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -48,6 +52,9 @@ namespace nil {
                     if (padded_rows_amount < 8)
                         padded_rows_amount = 8;
 
+                    // Grow every column at most once, even where it is resized in several steps below.
+                    table.reserve_rows(padded_rows_amount);
+
                     for (std::uint32_t w_index = 0; w_index <
                                                    table._private_table.witnesses_amount(); w_index++) {
 
@@ -83,7 +90,7 @@ namespace nil {
                 template<typename FieldType, typename ColumnType>
                 std::uint32_t zk_padding(
                     plonk_table<FieldType, ColumnType> &table,
-                    typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd = nil::crypto3::random::algebraic_engine<FieldType>()
+                    typename nil::crypto3::random::algebraic_engine<FieldType> alg_rnd
                 ) {
                     std::uint32_t usable_rows_amount = table.rows_amount();
 
@@ -94,6 +101,8 @@ namespace nil {
                     if (padded_rows_amount < 8)
                         padded_rows_amount = 8;
 
+                    table.reserve_rows(padded_rows_amount);
+
                     //std::cout << "usable_rows_amount = " << usable_rows_amount << std::endl;
                     //std::cout << "padded_rows_amount = " << padded_rows_amount << std::endl;
 
@@ -123,6 +132,60 @@ namespace nil {
 
                     return padded_rows_amount;
                 }
+
+                /**
+                 * Pads the table like the overload above, the witness padding is filled from a counter-based
+                 * generator. The engine is not advanced, the cells get its elements starting from rnd.position().
+                 * By default the key is taken from the random device.
+                 */
+                template<typename FieldType, typename ColumnType>
+                std::uint32_t zk_padding(
+                    plonk_table<FieldType, ColumnType> &table,
+                    const nil::crypto3::random::chacha_field_engine<FieldType> &rnd =
+                        nil::crypto3::random::chacha_field_engine<FieldType>::from_random_device()
+                ) {
+                    std::uint32_t usable_rows_amount = table.rows_amount();
+
+                    std::uint32_t padded_rows_amount = std::pow(2, std::ceil(std::log2(usable_rows_amount)));
+                    if (padded_rows_amount == usable_rows_amount)
+                        padded_rows_amount *= 2;
+
+                    if (padded_rows_amount < 8)
+                        padded_rows_amount = 8;
+
+                    table.reserve_rows(padded_rows_amount);
+
+                    for (std::uint32_t w_index = 0; w_index < table._private_table.witnesses_amount(); w_index++) {
+                        table._private_table._witnesses[w_index].resize(usable_rows_amount, FieldType::value_type::zero());
+                        table._private_table._witnesses[w_index].resize(padded_rows_amount);
+                    }
+
+                    for (std::uint32_t pi_index = 0; pi_index < table._public_table.public_inputs_amount(); pi_index++) {
+                        table._public_table._public_inputs[pi_index].resize(padded_rows_amount, FieldType::value_type::zero());
+                    }
+
+                    for (std::uint32_t c_index = 0; c_index < table._public_table.constants_amount(); c_index++) {
+                        table._public_table._constants[c_index].resize(padded_rows_amount, FieldType::value_type::zero());
+                    }
+
+                    for (std::uint32_t s_index = 0; s_index < table._public_table.selectors_amount(); s_index++) {
+                        table._public_table._selectors[s_index].resize(padded_rows_amount, FieldType::value_type::zero());
+                    }
+
+                    // Cell k of the padding gets element k of the stream, so the result does not depend on
+                    // the number of threads.
+                    const std::size_t padding_rows = padded_rows_amount - usable_rows_amount;
+                    wait_for_all(parallel_run_in_chunks<void>(
+                        table._private_table.witnesses_amount() * padding_rows,
+                        [&table, &rnd, usable_rows_amount, padding_rows](std::size_t begin, std::size_t end) {
+                            for (std::size_t k = begin; k < end; k++) {
+                                table._private_table._witnesses[k / padding_rows][usable_rows_amount + k % padding_rows] =
+                                    rnd.at(rnd.position() + k);
+                            }
+                        }, ThreadPool::PoolLevel::LOW));
+
+                    return padded_rows_amount;
+                }
             }    // namespace snark
         }        // namespace zk
     }            // namespace crypto3
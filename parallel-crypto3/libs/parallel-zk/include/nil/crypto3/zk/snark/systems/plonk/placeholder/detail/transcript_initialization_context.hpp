@@ -28,7 +28,11 @@
 #ifndef CRYPTO3_PLONK_PLACEHOLDER_TRANSCRIPT_INITIALIZATION_CONTEXT_HPP
 #define CRYPTO3_PLONK_PLACEHOLDER_TRANSCRIPT_INITIALIZATION_CONTEXT_HPP
 
+#include <algorithm>
+#include <vector>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/block_to_field_elements_wrapper.hpp>
 
 #include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
@@ -38,7 +42,12 @@
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 
+#include <nil/crypto3/bench/scoped_profiler.hpp>
+
 #include <nil/crypto3/marshalling/zk/types/placeholder/transcript_initialization_context.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -96,6 +105,138 @@ namespace nil {
                         std::string application_id;
                     };
 
+                    /**
+                     * Feeds marshalled objects to a hash accumulator through a bounded buffer, so the hashed data is
+                     * never materialized as a whole. The digest is the same as the hash of the concatenation of all the
+                     * written objects.
+                     */
+                    template<typename Hash>
+                    class marshalling_hash_stream {
+                    public:
+                        using hash_type = Hash;
+                        using digest_type = typename hash_type::digest_type;
+
+                        template<typename MarshallingType>
+                        void write(const MarshallingType &filled_value) {
+                            std::size_t offset = buffer.size();
+                            buffer.resize(offset + filled_value.length());
+                            auto write_iter = buffer.begin() + offset;
+                            nil::marshalling::status_type status = filled_value.write(write_iter, filled_value.length());
+                            THROW_IF_ERROR_STATUS(status, "marshalling_hash_stream::write");
+                            if (buffer.size() >= buffer_size) {
+                                flush();
+                            }
+                        }
+
+                        void write_digest(const digest_type &digest) {
+                            if constexpr (algebra::is_field_element<digest_type>::value) {
+                                nil::marshalling::status_type status;
+                                std::vector<std::uint8_t> digest_bytes =
+                                    nil::marshalling::pack<nil::marshalling::option::big_endian>(digest, status);
+                                THROW_IF_ERROR_STATUS(status, "marshalling_hash_stream::write_digest");
+                                buffer.insert(buffer.end(), digest_bytes.begin(), digest_bytes.end());
+                            } else {
+                                buffer.insert(buffer.end(), digest.begin(), digest.end());
+                            }
+                            if (buffer.size() >= buffer_size) {
+                                flush();
+                            }
+                        }
+
+                        digest_type digest() {
+                            absorb(buffer.size());
+                            buffer.clear();
+                            return accumulators::extract::hash<hash_type>(acc);
+                        }
+
+                    private:
+                        // Only whole blocks of the hash, or whole field elements for algebraic hashes, are absorbed
+                        // before the end of the stream, so the split of the data into writes doesn't change the digest.
+                        static constexpr std::size_t absorb_unit() {
+                            if constexpr (algebra::is_field_element<typename hash_type::word_type>::value) {
+                                return hash_type::word_type::field_type::modulus_bits / 8;
+                            } else {
+                                return hash_type::construction::type::block_bits / 8;
+                            }
+                        }
+
+                        constexpr static const std::size_t buffer_size = absorb_unit() * 4096;
+
+                        void flush() {
+                            std::size_t amount = buffer.size() - buffer.size() % absorb_unit();
+                            absorb(amount);
+                            buffer.erase(buffer.begin(), buffer.begin() + amount);
+                        }
+
+                        void absorb(std::size_t amount) {
+                            if (amount == 0) {
+                                return;
+                            }
+                            if constexpr (algebra::is_field_element<typename hash_type::word_type>::value) {
+                                hash<hash_type>(
+                                    hashes::block_to_field_elements_wrapper<
+                                        typename hash_type::word_type::field_type, std::vector<std::uint8_t>>(
+                                            buffer.cbegin(), buffer.cbegin() + amount),
+                                    acc);
+                            } else {
+                                hash<hash_type>(buffer.cbegin(), buffer.cbegin() + amount, acc);
+                            }
+                        }
+
+                        accumulator_set<hash_type> acc;
+                        std::vector<std::uint8_t> buffer;
+                    };
+
+                    // Circuits with more copy constraints than this hash them as a list of digests of chunks of this
+                    // size, so large circuits don't hash all their copy constraints sequentially.
+                    constexpr static const std::size_t copy_constraints_hash_chunk_size = 1 << 16;
+
+                    template<typename transcript_hash_type, typename Endianness, typename FieldType>
+                    typename transcript_hash_type::digest_type hash_copy_constraints_chunk(
+                            const std::vector<plonk_copy_constraint<FieldType>> &constraints,
+                            std::size_t chunk) {
+                        marshalling_hash_stream<transcript_hash_type> stream;
+                        std::size_t end = std::min(constraints.size(), (chunk + 1) * copy_constraints_hash_chunk_size);
+                        for (std::size_t i = chunk * copy_constraints_hash_chunk_size; i < end; i++) {
+                            stream.write(
+                                nil::crypto3::marshalling::types::fill_plonk_copy_constraint<Endianness, FieldType>(
+                                    constraints[i]));
+                        }
+                        return stream.digest();
+                    }
+
+                    // Writes the copy constraints in the same format as plonk_copy_constraints marshalling, or as the
+                    // amount of constraints followed by the digests of the chunks for large circuits.
+                    // Chunks are hashed in parallel.
+                    template<typename transcript_hash_type, typename Endianness, typename FieldType>
+                    void hash_copy_constraints(
+                            marshalling_hash_stream<transcript_hash_type> &stream,
+                            const std::vector<plonk_copy_constraint<FieldType>> &constraints) {
+                        using TTypeBase = nil::marshalling::field_type<Endianness>;
+                        using digest_type = typename transcript_hash_type::digest_type;
+
+                        stream.write(nil::marshalling::types::integral<TTypeBase, std::size_t>(constraints.size()));
+                        if (constraints.size() <= copy_constraints_hash_chunk_size) {
+                            for (const auto &constraint: constraints) {
+                                stream.write(
+                                    nil::crypto3::marshalling::types::fill_plonk_copy_constraint<Endianness, FieldType>(
+                                        constraint));
+                            }
+                            return;
+                        }
+
+                        std::size_t chunks_amount =
+                            (constraints.size() + copy_constraints_hash_chunk_size - 1) / copy_constraints_hash_chunk_size;
+                        std::vector<digest_type> chunk_digests(chunks_amount);
+                        parallel_for(0, chunks_amount, [&constraints, &chunk_digests](std::size_t chunk) {
+                            chunk_digests[chunk] = hash_copy_constraints_chunk<transcript_hash_type, Endianness, FieldType>(
+                                constraints, chunk);
+                        }, ThreadPool::PoolLevel::HIGH);
+                        for (const auto &digest: chunk_digests) {
+                            stream.write_digest(digest);
+                        }
+                    }
+
                     template <typename PlaceholderParamsType, typename transcript_hash_type>
                     typename transcript_hash_type::digest_type compute_constraint_system_with_params_hash(
                             const plonk_constraint_system<typename PlaceholderParamsType::field_type>
@@ -107,6 +248,8 @@ namespace nil {
                             const typename PlaceholderParamsType::commitment_scheme_type::params_type& commitment_params,
                             const std::string& application_id,
                             const typename PlaceholderParamsType::field_type::value_type& delta) {
+                        PROFILE_SCOPE("Constraint system hash");
+
                         nil::crypto3::zk::snark::detail::transcript_initialization_context<PlaceholderParamsType> context(
                             rows_amount,
                             usable_rows_amount,
@@ -116,34 +259,37 @@ namespace nil {
                             delta
                         );
 
-                        // Marshall the initialization context and push it to the transcript.
+                        // Marshall the initialization context and the constraint system into the hash stream, this is
+                        // the same data as in the marshalled constraint system, the copy constraints of large circuits
+                        // aside.
                         using Endianness = nil::marshalling::option::big_endian;
-                        auto filled_context = nil::crypto3::marshalling::types::fill_transcript_initialization_context<
-                            Endianness, nil::crypto3::zk::snark::detail::transcript_initialization_context<PlaceholderParamsType>>(context);
-
-                        std::vector<std::uint8_t> cv(filled_context.length(), 0x00);
-                        auto write_iter = cv.begin();
-                        nil::marshalling::status_type status = filled_context.write(write_iter, cv.size());
-                        THROW_IF_ERROR_STATUS(status, "transcript_initialization_context::compute_constraint_system_with_params_hash");
-
-                        // Append constraint_system to the buffer "cv".
+                        using TTypeBase = nil::marshalling::field_type<Endianness>;
                         using FieldType = typename PlaceholderParamsType::field_type;
                         using ConstraintSystem = plonk_constraint_system<FieldType>;
 
-                        auto filled_constraint_system = nil::crypto3::marshalling::types::fill_plonk_constraint_system<Endianness, ConstraintSystem>(constraint_system);
-                        cv.resize(filled_context.length() + filled_constraint_system.length(), 0x00);
+                        marshalling_hash_stream<transcript_hash_type> stream;
+                        stream.write(nil::crypto3::marshalling::types::fill_transcript_initialization_context<
+                            Endianness, nil::crypto3::zk::snark::detail::transcript_initialization_context<PlaceholderParamsType>>(context));
 
-                        // Function write wants an lvalue as 1st parameter.
-                        write_iter = cv.begin() + filled_context.length();
-                        filled_constraint_system.write(write_iter, filled_constraint_system.length());
+                        stream.write(nil::crypto3::marshalling::types::fill_plonk_gates<
+                            Endianness, typename ConstraintSystem::gates_container_type::value_type>(constraint_system.gates()));
+                        hash_copy_constraints<transcript_hash_type, Endianness, FieldType>(
+                            stream, constraint_system.copy_constraints());
+                        stream.write(nil::crypto3::marshalling::types::fill_plonk_lookup_gates<
+                            Endianness, typename ConstraintSystem::lookup_gates_container_type::value_type>(
+                                constraint_system.lookup_gates()));
+                        stream.write(nil::crypto3::marshalling::types::fill_plonk_lookup_tables<
+                            Endianness, typename ConstraintSystem::lookup_tables_type::value_type>(
+                                constraint_system.lookup_tables()));
 
-                        // Return hash of "cv", which contains concatenated constraint system and other initialization parameters.
-                        return hash<transcript_hash_type>(
-                            hashes::conditional_block_to_field_elements_wrapper<
-                                typename transcript_hash_type::word_type,
-                                decltype(cv)
-                            >(cv)
-                        );
+                        nil::crypto3::marshalling::types::public_input_sizes_type<TTypeBase> public_input_sizes;
+                        for (std::size_t i = 0; i < constraint_system.public_input_sizes_num(); i++) {
+                            public_input_sizes.value().push_back(
+                                nil::marshalling::types::integral<TTypeBase, std::size_t>(constraint_system.public_input_size(i)));
+                        }
+                        stream.write(public_input_sizes);
+
+                        return stream.digest();
                     }
                 }    // namespace detail
             }        // namespace snark
@@ -318,8 +318,8 @@ namespace nil {
 
                         std::array<typename FieldType::value_type, argument_size> F;
 
-                        F[0] = common_data.lagrange_0.evaluate(challenge) *
-                               (one - perm_polynomial_value);
+                        // The verifier passes lagrange_0 at the challenge as the first special selector value.
+                        F[0] = special_selector_values[0] * (one - perm_polynomial_value);
 
                         std::vector<typename FieldType::value_type> permutation_alphas;
                         for( std::size_t i = 0; i < common_data.permutation_parts - 1; i++ ){
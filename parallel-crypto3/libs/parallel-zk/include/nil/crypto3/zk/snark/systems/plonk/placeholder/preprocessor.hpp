@@ -33,6 +33,13 @@
 #include <sstream>
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <optional>
+#include <limits>
+#include <numeric>
+#include <vector>
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
@@ -53,6 +60,9 @@
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -288,6 +298,52 @@ namespace nil {
                         common_data_type common_data;
                     };
 
+                    /**
+                     * Fixed data that depends only on the size class of the table, i.e. on the amounts of rows and
+                     * usable rows, and not on the circuit: the powers of omega, shared by the identity and the
+                     * permutation columns, and the q_last/q_blind selectors.
+                     */
+                    struct size_class_data_type {
+                        std::size_t rows_amount;
+                        std::size_t usable_rows_amount;
+                        std::vector<value_type> omega_powers;
+                        polynomial_dfs_type q_last;
+                        polynomial_dfs_type q_blind;
+                    };
+
+                    /**
+                     * Keeps the size class data of the last table between calls to process(), so circuits of the same
+                     * size class with different witnesses or gates reuse it. The cache is owned by the caller, e.g. a
+                     * pipeline preprocessing several circuits, and the data is released with it or by clear().
+                     */
+                    class size_class_cache {
+                    public:
+                        std::shared_ptr<const size_class_data_type> get(
+                            std::size_t usable_rows,
+                            std::shared_ptr<math::evaluation_domain<FieldType>> domain
+                        ) {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            if (_data && _data->rows_amount == domain->size() &&
+                                _data->usable_rows_amount == usable_rows) {
+                                return _data;
+                            }
+
+                            // The stale data is released before the new one is computed.
+                            _data.reset();
+                            _data = make_size_class_data(usable_rows, domain);
+                            return _data;
+                        }
+
+                        void clear() {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            _data.reset();
+                        }
+
+                    private:
+                        std::mutex _mutex;
+                        std::shared_ptr<const size_class_data_type> _data;
+                    };
+
                 private:
                     static polynomial_dfs_type lagrange_polynomial(
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
@@ -306,83 +362,140 @@ namespace nil {
                         return f;
                     }
 
+                    /**
+                     * Cycles of the copy constraint permutation over the cells of the permuted columns. Cells are
+                     * addressed by the flat index position * rows_amount + row, where position is the index of the
+                     * column in the ordered list of global indices of the permuted columns. Cycles are tracked with a
+                     * union-find with union by size and path halving, each copy constraint between different cycles
+                     * swaps the successors of its two cells and so joins the cycles.
+                     */
                     struct cycle_representation {
                         // Using std::uint32_t reduces RAM usage a bit. Our table size (rows_amount * width) will never be > 2^32 elements.
-                        typedef std::pair<std::uint32_t, std::uint32_t> key_type;
+                        typedef std::uint32_t key_type;
 
-                        std::map<key_type, key_type> _mapping;
-                        std::map<key_type, key_type> _aux;
-                        std::map<key_type, std::uint32_t> _sizes;
+                        std::size_t _rows_amount;
+                        std::vector<key_type> _mapping;
+                        std::vector<key_type> _parent;
+                        std::vector<key_type> _sizes;
 
                         cycle_representation(
                             const plonk_constraint_system<FieldType>  &constraint_system,
-                            const plonk_table_description<FieldType> &table_description
-                        ) {
-                            for (std::size_t i = 0;
-                                 i < table_description.table_width() - table_description.selector_columns;
-                                 i++) {
-                                for (std::size_t j = 0; j < table_description.rows_amount; j++) {
-                                    key_type key(i, j);
-                                    this->_mapping[key] = key;
-                                    this->_aux[key] = key;
-                                    this->_sizes[key] = 1;
-                                }
+                            const plonk_table_description<FieldType> &table_description,
+                            const std::vector<std::size_t> &global_indices // ordered global indices
+                        ) : _rows_amount(table_description.rows_amount) {
+                            const std::size_t cells_amount = global_indices.size() * _rows_amount;
+                            BOOST_ASSERT(cells_amount <= std::numeric_limits<key_type>::max());
+
+                            _mapping.resize(cells_amount);
+                            _parent.resize(cells_amount);
+                            _sizes.resize(cells_amount, 1);
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                cells_amount,
+                                [this](std::size_t begin, std::size_t end) {
+                                    std::iota(_mapping.begin() + begin, _mapping.begin() + end, key_type(begin));
+                                    std::iota(_parent.begin() + begin, _parent.begin() + end, key_type(begin));
+                                }));
+
+                            std::vector<std::size_t> column_positions(table_description.table_width(), global_indices.size());
+                            for (std::size_t i = 0; i < global_indices.size(); i++) {
+                                column_positions[global_indices[i]] = i;
                             }
 
-                            std::vector<plonk_copy_constraint<FieldType>> copy_constraints =
-                                constraint_system.copy_constraints();
-                            for (std::size_t i = 0; i < copy_constraints.size(); i++) {
-                                std::size_t x_idx = table_description.global_index(copy_constraints[i].first);
-                                key_type x = key_type(x_idx, copy_constraints[i].first.rotation);
+                            const auto cell = [this, &table_description, &column_positions](
+                                    const variable_type &var) {
+                                std::size_t position = column_positions[table_description.global_index(var)];
+                                BOOST_ASSERT(position != column_positions.size());
+                                BOOST_ASSERT(var.rotation >= 0 && std::size_t(var.rotation) < _rows_amount);
+                                return key_type(position * _rows_amount + var.rotation);
+                            };
 
-                                std::size_t y_idx = table_description.global_index(copy_constraints[i].second);
-                                key_type y = key_type(y_idx, copy_constraints[i].second.rotation);
-                                this->apply_copy_constraint(x, y);
+                            for (const auto &copy_constraint : constraint_system.copy_constraints()) {
+                                this->apply_copy_constraint(cell(copy_constraint.first), cell(copy_constraint.second));
                             }
                         }
 
-                        void apply_copy_constraint(key_type x, key_type y) {
-
-                            if (!_mapping.count(x)) {
-                                _mapping[x] = x;
-                                _aux[x] = x;
-                                _sizes[x] = 1;
+                        key_type find(key_type x) {
+                            while (_parent[x] != x) {
+                                _parent[x] = _parent[_parent[x]];
+                                x = _parent[x];
                             }
+                            return x;
+                        }
 
-                            if (!_mapping.count(y)) {
-                                _mapping[y] = y;
-                                _aux[y] = y;
-                                _sizes[y] = 1;
+                        void apply_copy_constraint(key_type x, key_type y) {
+                            key_type x_root = find(x);
+                            key_type y_root = find(y);
+                            if (x_root == y_root) {
+                                return;
                             }
 
-                            if (_aux[x] != _aux[y]) {
-                                key_type &left = x;
-                                key_type &right = y;
-                                if (_sizes[_aux[left]] < _sizes[_aux[right]]) {
-                                    std::swap(left, right);
-                                }
-
-                                _sizes[_aux[left]] = _sizes[_aux[left]] + _sizes[_aux[right]];
-
-                                key_type z = _aux[right];
-                                key_type exit_condition = _aux[right];
-
-                                do {
-                                    _aux[z] = _aux[left];
-                                    z = _mapping[z];
-                                } while (z != exit_condition);
-
-                                key_type tmp = _mapping[left];
-                                _mapping[left] = _mapping[right];
-                                _mapping[right] = tmp;
+                            if (_sizes[x_root] < _sizes[y_root]) {
+                                std::swap(x_root, y_root);
                             }
+                            _parent[y_root] = x_root;
+                            _sizes[x_root] += _sizes[y_root];
+
+                            std::swap(_mapping[x], _mapping[y]);
                         }
 
-                        key_type &operator[](key_type key) {
+                        // Cell that follows the given one in its cycle.
+                        key_type operator[](key_type key) const {
                             return _mapping[key];
                         }
+
+                        std::size_t rows_amount() const {
+                            return _rows_amount;
+                        }
                     };
 
+                    // Returns value^0, ..., value^(count - 1).
+                    static std::vector<value_type> powers(const value_type &value, std::size_t count) {
+                        std::vector<value_type> result(count);
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            count,
+                            [&result, &value](std::size_t begin, std::size_t end) {
+                                value_type current = value.pow(begin);
+                                for (std::size_t i = begin; i < end; i++) {
+                                    result[i] = current;
+                                    current *= value;
+                                }
+                            }));
+                        return result;
+                    }
+
+                    // Allocates 'count' zero polynomials over 'domain' in parallel.
+                    static std::vector<polynomial_dfs_type> zero_polynomials(
+                        std::size_t count,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> domain
+                    ) {
+                        std::vector<polynomial_dfs_type> result(count);
+                        parallel_for(0, count, [&result, &domain](std::size_t i) {
+                            result[i] = polynomial_dfs_type(domain->size() - 1, domain->size(), FieldType::value_type::zero());
+                        });
+                        return result;
+                    }
+
+                    static std::shared_ptr<const size_class_data_type> make_size_class_data(
+                        std::size_t usable_rows,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> domain
+                    ) {
+                        auto data = std::make_shared<size_class_data_type>();
+                        data->rows_amount = domain->size();
+                        data->usable_rows_amount = usable_rows;
+                        data->omega_powers = powers(domain->get_domain_element(1), domain->size());
+                        data->q_last = lagrange_polynomial(domain, usable_rows);
+                        data->q_blind = selector_blind(usable_rows, domain);
+                        return data;
+                    }
+
+                    // Runs independent stages of the preprocessing concurrently. We use LASTPOOL level thread pool
+                    // here, because the stages use the HIGH and LOW level ones.
+                    static void run_concurrently(const std::vector<std::function<void()>> &stages) {
+                        parallel_for(0, stages.size(), [&stages](std::size_t i) {
+                            stages[i]();
+                        }, ThreadPool::PoolLevel::LASTPOOL);
+                    }
+
                 public:
                     static inline std::vector<std::set<int>>
                     columns_rotations(
@@ -457,17 +570,46 @@ namespace nil {
                         const typename FieldType::value_type &delta,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain
                     ) {
-                        std::vector<polynomial_dfs_type> S_id(permutation_size);
-
-                        for (std::size_t i = 0; i < permutation_size; i++) {
-                            S_id[i] = polynomial_dfs_type(
-                                domain->size() - 1, domain->size(), FieldType::value_type::zero());
+                        return identity_polynomials(
+                            permutation_size, powers(omega, domain->size()), powers(delta, permutation_size), domain);
+                    }
 
-                            S_id[i][0] = delta.pow(i);
-                            for (std::size_t j = 1; j < domain->size(); j++) {
-                                S_id[i][j] = S_id[i][j-1] * omega;
-                             }
-                        }
+                    // S_id[i][j] = delta^i * omega^j: every column is a copy of the shared powers of omega scaled by
+                    // the power of delta.
+                    static inline std::vector<polynomial_dfs_type> identity_polynomials(
+                        const std::size_t permutation_size,
+                        const std::vector<value_type> &omega_powers,
+                        const std::vector<value_type> &delta_powers,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> domain
+                    ) {
+                        PROFILE_SCOPE("Placeholder identity polynomials");
+                        BOOST_ASSERT(omega_powers.size() >= domain->size());
+                        BOOST_ASSERT(delta_powers.size() >= permutation_size);
+
+                        std::vector<polynomial_dfs_type> S_id = zero_polynomials(permutation_size, domain);
+
+                        const std::size_t domain_size = domain->size();
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            permutation_size * domain_size,
+                            [&S_id, &omega_powers, &delta_powers, domain_size](std::size_t begin, std::size_t end) {
+                                // Chunks may span several columns, each column segment is processed at once.
+                                for (std::size_t cell = begin; cell < end;) {
+                                    const std::size_t i = cell / domain_size;
+                                    const std::size_t j = cell % domain_size;
+                                    const std::size_t segment_end = std::min(end - cell, domain_size - j) + j;
+                                    auto destination = S_id[i].begin() + j;
+                                    if (delta_powers[i] == value_type::one()) {
+                                        std::copy(omega_powers.begin() + j, omega_powers.begin() + segment_end, destination);
+                                    } else {
+                                        const value_type &scale = delta_powers[i];
+                                        std::transform(omega_powers.begin() + j, omega_powers.begin() + segment_end,
+                                                       destination, [&scale](const value_type &power) {
+                                                           return scale * power;
+                                                       });
+                                    }
+                                    cell += segment_end - j;
+                                }
+                            }));
 
                         return S_id;
                     }
@@ -476,20 +618,42 @@ namespace nil {
                         const std::vector<std::size_t> &global_indices, // ordered global indices
                         const typename FieldType::value_type &omega,
                         const typename FieldType::value_type &delta,
-                        cycle_representation &permutation,
+                        const cycle_representation &permutation,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain
                     ) {
-                        std::vector<polynomial_dfs_type> S_perm(global_indices.size());
-                        for (std::size_t i = 0; i < global_indices.size(); i++) {
-                            S_perm[i] = polynomial_dfs_type(
-                                domain->size() - 1, domain->size(), FieldType::value_type::zero());
-
-                            for (std::size_t j = 0; j < domain->size(); j++) {
-                                auto key = std::make_pair(global_indices[i], j);
-                                auto permuted_index = find(global_indices.begin(), global_indices.end(), permutation[key].first) - global_indices.begin();
-                                S_perm[i][j] = delta.pow(permuted_index) * omega.pow(permutation[key].second);
-                            }
-                        }
+                        return permutation_polynomials(
+                            global_indices, powers(omega, domain->size()), powers(delta, global_indices.size()),
+                            permutation, domain);
+                    }
+
+                    // S_perm[i][j] is the value of S_id at the cell that follows cell (i, j) in its cycle.
+                    static inline std::vector<polynomial_dfs_type> permutation_polynomials(
+                        const std::vector<std::size_t> &global_indices, // ordered global indices
+                        const std::vector<value_type> &omega_powers,
+                        const std::vector<value_type> &delta_powers,
+                        const cycle_representation &permutation,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> domain
+                    ) {
+                        PROFILE_SCOPE("Placeholder permutation polynomials");
+                        BOOST_ASSERT(omega_powers.size() >= domain->size());
+                        BOOST_ASSERT(delta_powers.size() >= global_indices.size());
+                        BOOST_ASSERT(permutation.rows_amount() == domain->size());
+
+                        std::vector<polynomial_dfs_type> S_perm = zero_polynomials(global_indices.size(), domain);
+
+                        const std::size_t domain_size = domain->size();
+                        const std::size_t rows_amount = permutation.rows_amount();
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            global_indices.size() * domain_size,
+                            [&S_perm, &omega_powers, &delta_powers, &permutation, domain_size, rows_amount](
+                                    std::size_t begin, std::size_t end) {
+                                for (std::size_t cell = begin; cell < end; cell++) {
+                                    std::size_t i = cell / domain_size;
+                                    std::size_t j = cell % domain_size;
+                                    std::size_t next = permutation[i * rows_amount + j];
+                                    S_perm[i][j] = delta_powers[next / rows_amount] * omega_powers[next % rows_amount];
+                                }
+                            }));
 
                         return S_perm;
                     }
@@ -539,7 +703,13 @@ namespace nil {
                         //    if 0 -- any degree
                         //    else -- we have a bound for permutations and lookups F-s degree rows_amount * (2 ^ max_quotient_poly_expand)
                         const std::size_t max_quotient_poly_chunks = 0,
-                        const typename FieldType::value_type& delta=algebra::fields::arithmetic_params<FieldType>::multiplicative_generator
+                        const typename FieldType::value_type& delta=algebra::fields::arithmetic_params<FieldType>::multiplicative_generator,
+                        // Hash of the constraint system with the parameters above, computed by an earlier preprocessing
+                        // of the same circuit. It's computed from scratch if not set.
+                        const std::optional<typename transcript_hash_type::digest_type>& cached_constraint_system_with_params_hash =
+                            std::nullopt,
+                        // Keeps the size class data for later calls, it's computed for this call only if not set.
+                        size_class_cache *cache = nullptr
                     ) {
                         PROFILE_SCOPE("Placeholder public preprocessor");
 
@@ -555,38 +725,46 @@ namespace nil {
                         std::shared_ptr<math::evaluation_domain<FieldType>> basic_domain =
                             math::make_evaluation_domain<FieldType>(N_rows);
 
-                        // TODO: add std::vector<std::size_t> columns_with_copy_constraints;
-                        cycle_representation permutation(constraint_system, table_description);
-
                         auto permuted_columns = constraint_system.permuted_columns();
                         std::vector<std::size_t> global_indices;
                         for( auto it = permuted_columns.begin(); it != permuted_columns.end(); it++ ){
                             global_indices.push_back(table_description.global_index(*it));
                         }
 
-                        std::vector<polynomial_dfs_type> id_perm_polys =
-                            identity_polynomials(permuted_columns.size(), basic_domain->get_domain_element(1),
-                                                 delta, basic_domain);
-
-                        std::vector<polynomial_dfs_type> sigma_perm_polys =
-                            permutation_polynomials(global_indices, basic_domain->get_domain_element(1),
-                                                    delta, permutation, basic_domain);
-
-                        polynomial_dfs_type lagrange_0 = lagrange_polynomial(basic_domain, 0);
-
-                        std::array<polynomial_dfs_type, 2> q_last_q_blind;
-                        q_last_q_blind[0] = lagrange_polynomial(basic_domain, usable_rows);
-                        q_last_q_blind[1] = selector_blind(usable_rows, basic_domain);
-
-                        plonk_public_polynomial_dfs_table<FieldType>
-                            public_polynomial_table =
-                                plonk_public_polynomial_dfs_table<FieldType>(
+                        std::shared_ptr<const size_class_data_type> size_class = cache != nullptr ?
+                            cache->get(usable_rows, basic_domain) : make_size_class_data(usable_rows, basic_domain);
+                        std::vector<value_type> delta_powers = powers(delta, global_indices.size());
+
+                        // The cycles of the copy constraints are built by a serial union-find, the identity columns and
+                        // the public columns are produced meanwhile.
+                        std::optional<cycle_representation> permutation;
+                        std::vector<polynomial_dfs_type> id_perm_polys;
+                        plonk_public_polynomial_dfs_table<FieldType> public_polynomial_table;
+                        run_concurrently({
+                            [&]() {
+                                permutation.emplace(constraint_system, table_description, global_indices);
+                            },
+                            [&]() {
+                                id_perm_polys = identity_polynomials(
+                                    permuted_columns.size(), size_class->omega_powers, delta_powers, basic_domain);
+                            },
+                            [&]() {
+                                public_polynomial_table = plonk_public_polynomial_dfs_table<FieldType>(
                                     detail::column_range_polynomial_dfs<FieldType>(public_assignment.move_public_inputs(),
                                                                                    basic_domain),
                                     detail::column_range_polynomial_dfs<FieldType>(public_assignment.move_constants(),
                                                                                    basic_domain),
                                     detail::column_range_polynomial_dfs<FieldType>(public_assignment.move_selectors(),
                                                                                    basic_domain));
+                            }
+                        });
+
+                        std::vector<polynomial_dfs_type> sigma_perm_polys = permutation_polynomials(
+                            global_indices, size_class->omega_powers, delta_powers, *permutation, basic_domain);
+                        permutation.reset();
+
+                        std::array<polynomial_dfs_type, 2> q_last_q_blind = {size_class->q_last, size_class->q_blind};
+                        size_class.reset();
 
                         // prepare commitments for short verifier
                         //typename preprocessed_data_type::public_precommitments_type public_precommitments =
@@ -597,23 +775,34 @@ namespace nil {
                         std::size_t permutation_parts_num = permutation_partitions_num(permuted_columns.size(), max_quotient_poly_chunks);
                         std::size_t lookup_parts_num = constraint_system.lookup_parts(max_quotient_poly_chunks).size();
 
-                        typename preprocessed_data_type::public_commitments_type public_commitments = commitments(
-                            public_polynomial_table, id_perm_polys,
-                            sigma_perm_polys, q_last_q_blind, commitment_scheme
-                        );
-
-                        std::vector<std::set<int>> c_rotations =
-                            columns_rotations(constraint_system, table_description);
-
-                        typename transcript_hash_type::digest_type constraint_system_with_params_hash =
-                            nil::crypto3::zk::snark::detail::compute_constraint_system_with_params_hash<ParamsType, transcript_hash_type>(
-                                constraint_system,
-                                table_description,
-                                N_rows,
-                                table_description.usable_rows_amount,
-                                commitment_scheme.get_commitment_params(),
-                                "Default application dependent transcript initialization string",
-                                delta);
+                        // The LDE and the merkle tree of the fixed columns are computed while the constraint system is
+                        // hashed. The commitment parameters are not changed by the commitment.
+                        typename preprocessed_data_type::public_commitments_type public_commitments;
+                        std::vector<std::set<int>> c_rotations;
+                        typename transcript_hash_type::digest_type constraint_system_with_params_hash;
+                        run_concurrently({
+                            [&]() {
+                                public_commitments = commitments(
+                                    public_polynomial_table, id_perm_polys,
+                                    sigma_perm_polys, q_last_q_blind, commitment_scheme
+                                );
+                            },
+                            [&]() {
+                                c_rotations = columns_rotations(constraint_system, table_description);
+
+                                constraint_system_with_params_hash =
+                                    cached_constraint_system_with_params_hash.has_value() ?
+                                    *cached_constraint_system_with_params_hash :
+                                    nil::crypto3::zk::snark::detail::compute_constraint_system_with_params_hash<ParamsType, transcript_hash_type>(
+                                        constraint_system,
+                                        table_description,
+                                        N_rows,
+                                        table_description.usable_rows_amount,
+                                        commitment_scheme.get_commitment_params(),
+                                        "Default application dependent transcript initialization string",
+                                        delta);
+                            }
+                        });
 
                         typename preprocessed_data_type::verification_key vk = {constraint_system_with_params_hash, public_commitments.fixed_values};
 
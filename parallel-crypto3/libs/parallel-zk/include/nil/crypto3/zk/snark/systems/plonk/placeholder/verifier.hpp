@@ -44,6 +44,9 @@
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -56,6 +59,7 @@ namespace nil {
 
                     using commitment_scheme_type = typename ParamsType::commitment_scheme_type;
                     using commitment_type = typename commitment_scheme_type::commitment_type;
+                    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
 
                     constexpr static const std::size_t gate_parts = 1;
                     constexpr static const std::size_t permutation_parts = 3;
@@ -193,7 +197,22 @@ namespace nil {
                         const plonk_constraint_system<FieldType> &constraint_system,
                         commitment_scheme_type commitment_scheme
                     ) {
+                        return process(
+                            prepare(common_data, std::move(commitment_scheme)),
+                            common_data, proof, table_description, constraint_system);
+                    }
+
+                    // Commitment scheme and transcript after the common data was absorbed. These depend on the circuit
+                    // only, so they are computed once for all the proofs verified against the same common data.
+                    struct prepared_common_data_type {
+                        commitment_scheme_type commitment_scheme;
+                        transcript_type transcript;
+                    };
 
+                    static prepared_common_data_type prepare(
+                        const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
+                        commitment_scheme_type commitment_scheme
+                    ) {
                         // We cannot add eval points unless everything is committed, so when verifying assume it's committed.
                         commitment_scheme.state_commited(FIXED_VALUES_BATCH);
                         commitment_scheme.state_commited(VARIABLE_VALUES_BATCH);
@@ -204,12 +223,7 @@ namespace nil {
 
                         commitment_scheme.set_fixed_polys_values(common_data.commitment_scheme_data);
 
-                        const std::size_t witness_columns = table_description.witness_columns;
-                        const std::size_t public_input_columns = table_description.public_input_columns;
-                        const std::size_t constant_columns = table_description.constant_columns;
-                        const std::size_t selector_columns = table_description.selector_columns;
-
-                        transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(std::vector<std::uint8_t>({}));
+                        transcript_type transcript(std::vector<std::uint8_t>({}));
 
                         transcript(common_data.vk.constraint_system_with_params_hash);
                         transcript(common_data.vk.fixed_values_commitment);
@@ -217,6 +231,50 @@ namespace nil {
                         // Setup commitment scheme. LPC adds an additional point here.
                         commitment_scheme.setup(transcript, common_data.commitment_scheme_data);
 
+                        return {std::move(commitment_scheme), std::move(transcript)};
+                    }
+
+                    /**
+                     * Verifies many proofs of the same circuit. The common data is absorbed once, and the proofs are
+                     * verified concurrently, each of them checks its FRI queries in parallel as well.
+                     * \returns The result of the verification of each proof, in the order of 'proofs'.
+                     */
+                    static std::vector<bool> process_batch(
+                        const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
+                        const std::vector<placeholder_proof<FieldType, ParamsType>> &proofs,
+                        const plonk_table_description<FieldType> &table_description,
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        commitment_scheme_type commitment_scheme
+                    ) {
+                        PROFILE_SCOPE("Placeholder batch verification");
+
+                        const prepared_common_data_type prepared = prepare(common_data, std::move(commitment_scheme));
+
+                        // std::vector<bool> can't be written from several threads.
+                        std::vector<std::uint8_t> results(proofs.size(), 0);
+                        parallel_for(0, proofs.size(),
+                            [&prepared, &common_data, &proofs, &table_description, &constraint_system, &results](std::size_t i) {
+                                results[i] = process(prepared, common_data, proofs[i], table_description, constraint_system);
+                            }, ThreadPool::PoolLevel::LASTPOOL);
+
+                        return std::vector<bool>(results.begin(), results.end());
+                    }
+
+                    static inline bool process(
+                        const prepared_common_data_type &prepared,
+                        const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
+                        const placeholder_proof<FieldType, ParamsType> &proof,
+                        const plonk_table_description<FieldType> &table_description,
+                        const plonk_constraint_system<FieldType> &constraint_system
+                    ) {
+                        commitment_scheme_type commitment_scheme = prepared.commitment_scheme;
+                        transcript_type transcript = prepared.transcript;
+
+                        const std::size_t witness_columns = table_description.witness_columns;
+                        const std::size_t public_input_columns = table_description.public_input_columns;
+                        const std::size_t constant_columns = table_description.constant_columns;
+                        const std::size_t selector_columns = table_description.selector_columns;
+
                         // 3. append witness commitments to transcript
                         transcript(proof.commitments.at(VARIABLE_VALUES_BATCH));
 
@@ -359,7 +417,7 @@ namespace nil {
                                 PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED, 0,
                                 plonk_variable<typename FieldType::value_type>::column_type::selector
                             );
-                            columns_at_y[key] = mask_value - common_data.lagrange_0.evaluate(proof.eval_proof.challenge);
+                            columns_at_y[key] = mask_value - special_selector_values[0];
                         }
                         {
                             auto key = std::make_tuple(
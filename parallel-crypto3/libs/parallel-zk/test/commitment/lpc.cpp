@@ -46,6 +46,9 @@
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
 
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
 #include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
 #include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
@@ -459,6 +462,264 @@ BOOST_AUTO_TEST_SUITE(lpc_math_polynomial_suite);
         BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
     }
 
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_combined_Q_evaluation_form_test, test_fixture) {
+        // Setup types
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        // Setup params
+        std::size_t degree_log = std::ceil(std::log2(2 * d - 1));
+        typename fri_type::params_type fri_params(
+                1, /*max_step*/
+                degree_log,
+                lambda,
+                2, //expand_factor
+                true // use_grinding
+                );
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+        lpc_scheme_type lpc_scheme_prover(fri_params);
+
+        // Polynomials of different sizes, so some of them are moved to the largest domain.
+        lpc_scheme_prover.append_to_batch(0, generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(1, 10)(test_global_rnd_engine), d, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.append_to_batch(1, generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(1, 10)(test_global_rnd_engine), 2 * d, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.append_to_batch(2, generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(1, 10)(test_global_rnd_engine), d / 2, test_global_alg_rnd_engine<FieldType>));
+
+        lpc_scheme_prover.commit(0);
+        lpc_scheme_prover.commit(1);
+        lpc_scheme_prover.commit(2);
+        lpc_scheme_prover.mark_batch_as_fixed(0);
+
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+        auto other_point = test_global_alg_rnd_engine<FieldType>();
+        lpc_scheme_prover.append_eval_point(0, point);
+        lpc_scheme_prover.append_eval_point(1, point);
+        lpc_scheme_prover.append_eval_point(1, other_point);
+        lpc_scheme_prover.append_eval_point(2, other_point);
+
+        std::array<std::uint8_t, 96> x_data{};
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> preprocessor_transcript(x_data);
+        auto fixed_polys_values = lpc_scheme_prover.preprocess(preprocessor_transcript);
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+        lpc_scheme_prover.setup(transcript, fixed_polys_values);
+        lpc_scheme_prover.eval_polys();
+
+        auto theta = test_global_alg_rnd_engine<FieldType>();
+        std::size_t starting_power = 5;
+
+        auto combined_Q = lpc_scheme_prover.prepare_combined_Q_on_evaluation_domain(theta, starting_power);
+        BOOST_CHECK(combined_Q.has_value());
+        auto expected_Q = lpc_scheme_prover.prepare_combined_Q_in_coefficient_form(theta, starting_power);
+
+        BOOST_CHECK_EQUAL(combined_Q->size(), expected_Q.size());
+        BOOST_CHECK(std::equal(combined_Q->begin(), combined_Q->end(), expected_Q.begin()));
+    }
+
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_spilled_batches_test, test_fixture) {
+        // Setup types
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        // Setup params
+        std::size_t degree_log = std::ceil(std::log2(d - 1));
+        typename fri_type::params_type fri_params(
+                1, /*max_step*/
+                degree_log,
+                lambda,
+                2, //expand_factor
+                true // use_grinding
+                );
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+        lpc_scheme_type lpc_scheme_prover(fri_params);
+        lpc_scheme_type lpc_scheme_verifier(fri_params);
+
+        lpc_scheme_prover.append_to_batch(0, generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(1, 10)(test_global_rnd_engine), d, test_global_alg_rnd_engine<FieldType>));
+        lpc_scheme_prover.append_to_batch(1, generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(1, 10)(test_global_rnd_engine), d, test_global_alg_rnd_engine<FieldType>));
+        auto batch_0_copy = lpc_scheme_prover._polys[0];
+        auto batch_1_copy = lpc_scheme_prover._polys[1];
+
+        // The first batch is committed while the prover is within its budget and stays in memory.
+        auto budget = std::make_shared<zk::commitments::detail::memory_budget>();
+        lpc_scheme_prover.set_memory_budget(budget);
+
+        std::map<std::size_t, typename lpc_type::commitment_type> commitments;
+        commitments[0] = lpc_scheme_prover.commit(0);
+        BOOST_CHECK(lpc_scheme_prover._spilled.empty());
+
+        // Any process is over a budget of 1 byte, so all the committed batches are spilled, including the first one.
+        budget->set_limit(1);
+        commitments[1] = lpc_scheme_prover.commit(1);
+        budget->set_limit(0);
+
+        BOOST_CHECK_EQUAL(lpc_scheme_prover._spilled.size(), 2);
+        BOOST_CHECK(lpc_scheme_prover._polys[0].empty());
+        BOOST_CHECK(lpc_scheme_prover._polys[1].empty());
+        BOOST_CHECK_EQUAL(lpc_scheme_prover.get_batch_size(1), batch_1_copy.size());
+        BOOST_CHECK_EQUAL(lpc_scheme_prover.get_poly_size(1, 0), batch_1_copy[0].size());
+        BOOST_CHECK_EQUAL(lpc_scheme_prover.get_poly_degree(1, 0), batch_1_copy[0].degree());
+        BOOST_CHECK(*lpc_scheme_prover.get_batch(0) == batch_0_copy);
+        BOOST_CHECK(*lpc_scheme_prover.get_batch(1) == batch_1_copy);
+
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+        lpc_scheme_prover.append_eval_point(0, point);
+        lpc_scheme_prover.append_eval_point(1, point);
+
+        std::array<std::uint8_t, 96> x_data{};
+
+        // Prove, the batches are read back one at a time and stay spilled.
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+        auto proof = lpc_scheme_prover.proof_eval(transcript);
+        BOOST_CHECK_EQUAL(lpc_scheme_prover._spilled.size(), 2);
+
+        lpc_scheme_prover.load_spilled_batches();
+        BOOST_CHECK(lpc_scheme_prover._spilled.empty());
+        BOOST_CHECK(lpc_scheme_prover._polys[1] == batch_1_copy);
+
+        // Verify
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(x_data);
+
+        lpc_scheme_verifier.set_batch_size(0, proof.z.get_batch_size(0));
+        lpc_scheme_verifier.set_batch_size(1, proof.z.get_batch_size(1));
+
+        lpc_scheme_verifier.append_eval_point(0, point);
+        lpc_scheme_verifier.append_eval_point(1, point);
+        BOOST_CHECK(lpc_scheme_verifier.verify_eval(proof, commitments, transcript_verifier));
+    }
+
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_lde_cache_test, test_fixture) {
+        // Setup types
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+
+        // Setup params
+        std::size_t degree_log = std::ceil(std::log2(d - 1));
+        typename fri_type::params_type fri_params(
+                1, /*max_step*/
+                degree_log,
+                lambda,
+                2, //expand_factor
+                true // use_grinding
+                );
+
+        auto batch = generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(2, 10)(test_global_rnd_engine), d, test_global_alg_rnd_engine<FieldType>);
+        auto changed_batch = batch;
+        changed_batch[0] = generate_random_polynomial_dfs_batch<FieldType>(
+                1, d, test_global_alg_rnd_engine<FieldType>)[0];
+
+        auto cache = std::make_shared<zk::commitments::detail::lde_cache>();
+        auto commit_batch = [&fri_params, &cache](const auto& polys) {
+            lpc_scheme_type lpc_scheme(fri_params);
+            lpc_scheme.set_lde_cache(cache);
+            lpc_scheme.append_to_batch(0, polys);
+            return lpc_scheme.commit(0);
+        };
+
+        // Roots without the cache, it has no directory yet.
+        auto root = commit_batch(batch);
+        auto changed_root = commit_batch(changed_batch);
+
+        boost::filesystem::path directory =
+            boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("lpc-lde-cache-%%%%%%%%");
+        cache->set_directory(directory);
+
+        auto count_entries = [&directory](const std::string& kind) {
+            std::size_t count = 0;
+            for (boost::filesystem::directory_iterator it(directory), end; it != end; ++it) {
+                count += it->path().filename().string().rfind(kind + "-", 0) == 0;
+            }
+            return count;
+        };
+        auto remove_entries = [&directory](const std::string& kind) {
+            std::vector<boost::filesystem::path> entries;
+            for (boost::filesystem::directory_iterator it(directory), end; it != end; ++it) {
+                if (it->path().filename().string().rfind(kind + "-", 0) == 0) {
+                    entries.push_back(it->path());
+                }
+            }
+            for (const auto& entry: entries) {
+                boost::filesystem::remove(entry);
+            }
+        };
+
+        // The first commitment fills the cache.
+        BOOST_CHECK(commit_batch(batch) == root);
+        BOOST_CHECK_EQUAL(count_entries("lde"), batch.size());
+        BOOST_CHECK_EQUAL(count_entries("tree"), 1u);
+
+        // The changed batch reuses the extensions of the unchanged columns.
+        BOOST_CHECK(commit_batch(changed_batch) == changed_root);
+        BOOST_CHECK_EQUAL(count_entries("lde"), batch.size() + 1);
+        BOOST_CHECK_EQUAL(count_entries("tree"), 2u);
+
+        // Without the extensions in the cache, the same batch is committed only if the tree is read from it.
+        remove_entries("lde");
+        BOOST_CHECK(commit_batch(batch) == root);
+        BOOST_CHECK_EQUAL(count_entries("lde"), 0u);
+
+        // Entries of another field or merkle hash never match.
+        using lde_cache_type = zk::commitments::detail::lde_cache;
+        using merkle_tree_type = typename lpc_scheme_type::precommitment_type;
+        const auto tag = lde_cache_type::type_tag<FieldType, merkle_tree_type>();
+        BOOST_CHECK(tag != (lde_cache_type::type_tag<typename curve_type::base_field_type, merkle_tree_type>()));
+        BOOST_CHECK(tag != (lde_cache_type::type_tag<
+            FieldType, containers::merkle_tree<hashes::keccak_1600<256>, 2>>()));
+        BOOST_CHECK(lde_cache_type::fingerprint(batch[0], tag) != lde_cache_type::fingerprint(
+            batch[0], lde_cache_type::type_tag<FieldType, containers::merkle_tree<hashes::sha2<512>, 2>>()));
+
+        cache->set_directory({});
+        boost::filesystem::remove_all(directory);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(lpc_params_test_suite)
@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE plonk_padding_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/random/chacha_field_engine.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/padding.hpp>
+
+using namespace nil::crypto3;
+
+BOOST_AUTO_TEST_SUITE(plonk_padding_test_suite)
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using value_type = typename FieldType::value_type;
+    using column_type = zk::snark::plonk_column<FieldType>;
+    using table_type = zk::snark::plonk_assignment_table<FieldType>;
+
+    table_type make_table(std::size_t witnesses_amount, std::size_t rows) {
+        std::vector<column_type> witnesses(witnesses_amount, column_type(rows));
+        std::vector<column_type> public_inputs(1, column_type(rows));
+        std::vector<column_type> constants(1, column_type(rows));
+        std::vector<column_type> selectors(1, column_type(rows));
+        for (std::size_t i = 0; i < rows; i++) {
+            for (std::size_t w = 0; w < witnesses_amount; w++) {
+                witnesses[w][i] = value_type(w * rows + i + 1);
+            }
+            public_inputs[0][i] = value_type(i + 2);
+            constants[0][i] = value_type(i + 3);
+            selectors[0][i] = value_type::one();
+        }
+        return table_type(
+            zk::snark::plonk_private_assignment_table<FieldType>(witnesses),
+            zk::snark::plonk_public_assignment_table<FieldType>(public_inputs, constants, selectors));
+    }
+
+BOOST_AUTO_TEST_CASE(plonk_zk_padding_chacha_test) {
+    // 3 * (8192 - 5000) padding cells, so the padding is filled by several chunks of the thread pool.
+    constexpr std::size_t witnesses_amount = 3;
+    constexpr std::size_t usable_rows = 5000;
+    constexpr std::size_t padded_rows = 8192;
+    constexpr std::size_t padding_rows = padded_rows - usable_rows;
+
+    random::chacha_field_engine<FieldType> rnd(0x5eed);
+    rnd.seek(7);
+
+    table_type table = make_table(witnesses_amount, usable_rows);
+    BOOST_CHECK_EQUAL(zk::snark::zk_padding(table, rnd), padded_rows);
+    BOOST_CHECK_EQUAL(rnd.position(), 7);
+
+    for (std::size_t w = 0; w < witnesses_amount; w++) {
+        BOOST_CHECK_EQUAL(table.witness(w).size(), padded_rows);
+        for (std::size_t i = 0; i < usable_rows; i++) {
+            BOOST_CHECK(table.witness(w)[i] == value_type(w * usable_rows + i + 1));
+        }
+        // Padding cell k gets element k of the stream, counted from the position of the engine.
+        for (std::size_t i = 0; i < padding_rows; i++) {
+            BOOST_CHECK(table.witness(w)[usable_rows + i] == rnd.at(7 + w * padding_rows + i));
+        }
+    }
+    BOOST_CHECK_EQUAL(table.public_input(0).size(), padded_rows);
+    BOOST_CHECK_EQUAL(table.constant(0).size(), padded_rows);
+    BOOST_CHECK_EQUAL(table.selector(0).size(), padded_rows);
+    for (std::size_t i = usable_rows; i < padded_rows; i++) {
+        BOOST_CHECK(table.public_input(0)[i] == value_type::zero());
+        BOOST_CHECK(table.constant(0)[i] == value_type::zero());
+        BOOST_CHECK(table.selector(0)[i] == value_type::zero());
+    }
+
+    // Same key and position give the same padding, whatever the chunking of the pool was.
+    table_type other_table = make_table(witnesses_amount, usable_rows);
+    zk::snark::zk_padding(other_table, rnd);
+    for (std::size_t w = 0; w < witnesses_amount; w++) {
+        BOOST_CHECK(other_table.witness(w) == table.witness(w));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(plonk_zk_padding_small_table_test) {
+    // Tables are padded to at least 8 rows, and a power of two amount of usable rows is doubled.
+    random::chacha_field_engine<FieldType> rnd(1);
+
+    table_type small_table = make_table(2, 3);
+    BOOST_CHECK_EQUAL(zk::snark::zk_padding(small_table, rnd), 8);
+    BOOST_CHECK_EQUAL(small_table.witness(1).size(), 8);
+
+    table_type power_of_two_table = make_table(2, 16);
+    BOOST_CHECK_EQUAL(zk::snark::zk_padding(power_of_two_table, rnd), 32);
+    BOOST_CHECK(power_of_two_table.witness(1)[16] == rnd.at(16));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
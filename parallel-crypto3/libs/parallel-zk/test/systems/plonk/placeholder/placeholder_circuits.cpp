@@ -61,6 +61,17 @@ BOOST_AUTO_TEST_SUITE(placeholder_circuits)
         BOOST_CHECK(test_runner.run_test());
     }
 
+    BOOST_AUTO_TEST_CASE(circuit1_batch_verification)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_1<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_batch_test());
+    }
+
     BOOST_AUTO_TEST_CASE(circuit2)
     {
         test_tools::random_test_initializer<field_type> random_test_initializer;
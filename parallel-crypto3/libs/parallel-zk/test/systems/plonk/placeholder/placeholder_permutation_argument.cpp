@@ -32,10 +32,17 @@
 
 #define BOOST_TEST_MODULE placeholder_permutation_test
 
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
+#include <boost/random/uniform_int_distribution.hpp>
+
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/pairing/bls12.hpp>
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
@@ -185,6 +192,125 @@ BOOST_AUTO_TEST_SUITE(permutation_argument)
         BOOST_CHECK_MESSAGE(id_res == sigma_res, "Complex check");
     }
 
+    // Permutation polynomials built with std::maps over all the (column, row) pairs, as the preprocessor did
+    // before it moved to the union-find over the permuted columns. Kept as the reference for the test below.
+    std::vector<math::polynomial_dfs<typename field_type::value_type>> reference_permutation_polynomials(
+            const plonk_constraint_system<field_type> &constraint_system,
+            const plonk_table_description<field_type> &desc,
+            const std::vector<std::size_t> &global_indices,
+            const typename field_type::value_type &omega,
+            const typename field_type::value_type &delta) {
+        using key_type = std::pair<std::uint32_t, std::uint32_t>;
+        std::map<key_type, key_type> mapping;
+        std::map<key_type, key_type> aux;
+        std::map<key_type, std::uint32_t> sizes;
+
+        for (std::size_t i = 0; i < desc.table_width() - desc.selector_columns; i++) {
+            for (std::size_t j = 0; j < desc.rows_amount; j++) {
+                key_type key(i, j);
+                mapping[key] = key;
+                aux[key] = key;
+                sizes[key] = 1;
+            }
+        }
+
+        for (const auto &copy_constraint: constraint_system.copy_constraints()) {
+            key_type left(desc.global_index(copy_constraint.first), copy_constraint.first.rotation);
+            key_type right(desc.global_index(copy_constraint.second), copy_constraint.second.rotation);
+            if (aux[left] == aux[right]) {
+                continue;
+            }
+            if (sizes[aux[left]] < sizes[aux[right]]) {
+                std::swap(left, right);
+            }
+            sizes[aux[left]] = sizes[aux[left]] + sizes[aux[right]];
+
+            key_type z = aux[right];
+            key_type exit_condition = aux[right];
+            do {
+                aux[z] = aux[left];
+                z = mapping[z];
+            } while (z != exit_condition);
+
+            std::swap(mapping[left], mapping[right]);
+        }
+
+        std::vector<math::polynomial_dfs<typename field_type::value_type>> S_perm(global_indices.size());
+        for (std::size_t i = 0; i < global_indices.size(); i++) {
+            S_perm[i] = math::polynomial_dfs<typename field_type::value_type>(
+                desc.rows_amount - 1, desc.rows_amount, field_type::value_type::zero());
+            for (std::size_t j = 0; j < desc.rows_amount; j++) {
+                key_type next = mapping[key_type(global_indices[i], j)];
+                auto permuted_index =
+                    std::find(global_indices.begin(), global_indices.end(), next.first) - global_indices.begin();
+                S_perm[i][j] = delta.pow(permuted_index) * omega.pow(next.second);
+            }
+        }
+        return S_perm;
+    }
+
+    BOOST_FIXTURE_TEST_CASE(permutation_polynomials_reference_test, test_tools::random_test_initializer<field_type>) {
+        auto circuit = circuit_test_t<field_type>(
+                alg_random_engines.template get_alg_engine<field_type>()(),
+                alg_random_engines.template get_alg_engine<field_type>(),
+                generic_random_engine
+        );
+
+        plonk_table_description<field_type> desc(
+                circuit.table.witnesses().size(),
+                circuit.table.public_inputs().size(),
+                circuit.table.constants().size(),
+                circuit.table.selectors().size(),
+                circuit.usable_rows,
+                circuit.table_rows);
+
+        // Random copy constraints over all the rows of the witness and public input columns join the cycles of
+        // the circuit into cycles of many cells, some of the constraints are inside an already joined cycle.
+        using variable_type = plonk_variable<typename field_type::value_type>;
+        boost::random::uniform_int_distribution<std::size_t> column_dist(
+            0, desc.witness_columns + desc.public_input_columns - 1);
+        boost::random::uniform_int_distribution<std::size_t> row_dist(0, desc.rows_amount - 1);
+        auto random_cell = [&]() {
+            std::size_t column = column_dist(generic_random_engine);
+            std::size_t row = row_dist(generic_random_engine);
+            return column < desc.witness_columns ?
+                variable_type(column, row, false, variable_type::column_type::witness) :
+                variable_type(column - desc.witness_columns, row, false, variable_type::column_type::public_input);
+        };
+        for (std::size_t i = 0; i < 4 * desc.rows_amount; i++) {
+            circuit.copy_constraints.push_back(plonk_copy_constraint<field_type>(random_cell(), random_cell()));
+        }
+
+        std::size_t table_rows_log = std::log2(desc.rows_amount);
+        typename policy_type::constraint_system_type constraint_system(circuit.gates, circuit.copy_constraints,
+                                                                       circuit.lookup_gates);
+        typename policy_type::variable_assignment_type assignments = circuit.table;
+
+        typename lpc_type::fri_type::params_type fri_params(1, table_rows_log, placeholder_test_params::lambda, 4);
+        lpc_scheme_type lpc_scheme(fri_params);
+
+        typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                preprocessed_public_data = placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.move_public_table(), desc, lpc_scheme
+        );
+
+        const auto &global_indices = preprocessed_public_data.common_data.permuted_columns;
+        auto domain = preprocessed_public_data.common_data.basic_domain;
+        const typename field_type::value_type omega = domain->get_domain_element(1);
+        const typename field_type::value_type delta = algebra::fields::arithmetic_params<field_type>::multiplicative_generator;
+
+        auto reference_S_perm = reference_permutation_polynomials(constraint_system, desc, global_indices, omega, delta);
+        BOOST_CHECK_EQUAL(preprocessed_public_data.permutation_polynomials.size(), reference_S_perm.size());
+        BOOST_CHECK(preprocessed_public_data.permutation_polynomials == reference_S_perm);
+
+        BOOST_CHECK_EQUAL(preprocessed_public_data.identity_polynomials.size(), global_indices.size());
+        for (std::size_t i = 0; i < preprocessed_public_data.identity_polynomials.size(); i++) {
+            for (std::size_t j = 0; j < desc.rows_amount; j++) {
+                BOOST_CHECK(preprocessed_public_data.identity_polynomials[i][j] == delta.pow(i) * omega.pow(j));
+            }
+        }
+    }
+
     BOOST_FIXTURE_TEST_CASE(placeholder_split_polynomial_test, test_tools::random_test_initializer<field_type>) {
         math::polynomial<typename field_type::value_type> f = {1, 3, 4, 1, 5, 6, 7, 2, 8, 7, 5, 6, 1, 2, 1, 1};
         std::size_t expected_size = 4;
@@ -112,6 +112,39 @@ struct placeholder_test_runner {
         return verifier_res;
     }
 
+    // Verifies a batch of copies of the same proof, one of them with a wrong evaluation. Only the wrong one must fail.
+    bool run_batch_test(std::size_t batch_size = 4) {
+        lpc_scheme_type lpc_scheme(fri_params);
+
+        typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                lpc_preprocessed_public_data = placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.move_public_table(), desc, lpc_scheme, max_quotient_poly_chunks);
+
+        typename placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                lpc_preprocessed_private_data = placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.move_private_table(), desc);
+
+        auto lpc_proof = placeholder_prover<field_type, lpc_placeholder_params_type>::process(
+                lpc_preprocessed_public_data, std::move(lpc_preprocessed_private_data), desc, constraint_system,
+                lpc_scheme);
+
+        std::vector<decltype(lpc_proof)> proofs(batch_size, lpc_proof);
+        std::size_t wrong_proof = batch_size / 2;
+        auto &z = proofs[wrong_proof].eval_proof.eval_proof.z;
+        z.set(QUOTIENT_BATCH, 0, 0, z.get(QUOTIENT_BATCH, 0, 0) + field_type::value_type::one());
+
+        lpc_scheme_type verifier_lpc_scheme(fri_params);
+        std::vector<bool> results = placeholder_verifier<field_type, lpc_placeholder_params_type>::process_batch(
+                lpc_preprocessed_public_data.common_data, proofs, desc, constraint_system, verifier_lpc_scheme);
+
+        for (std::size_t i = 0; i < batch_size; i++) {
+            if (results[i] != (i != wrong_proof)) {
+                return false;
+            }
+        }
+        return results.size() == batch_size;
+    }
+
     circuit_type circuit;
     plonk_table_description<field_type> desc;
     typename policy_type::constraint_system_type constraint_system;
@@ -28,6 +28,7 @@
 #include <boost/asio/thread_pool.hpp>
 #include <boost/asio/post.hpp>
 
+#include <atomic>
 #include <functional>
 #include <future>
 #include <thread>
@@ -35,7 +36,6 @@
 #include <memory>
 #include <stdexcept>
 
-
 namespace nil {
     namespace crypto3 {
 
@@ -53,9 +53,9 @@ namespace nil {
              *  Submission of higher level tasks to low level pool will immediately result in a deadlock.
              */
             static ThreadPool& get_instance(PoolLevel pool_id, std::size_t pool_size = std::thread::hardware_concurrency()) {
-                static ThreadPool instance_for_low_level(pool_size);
-                static ThreadPool instance_for_middle_level(pool_size);
-                static ThreadPool instance_for_high_level(pool_size);
+                static ThreadPool instance_for_low_level(pool_size, "pool LOW");
+                static ThreadPool instance_for_middle_level(pool_size, "pool HIGH");
+                static ThreadPool instance_for_high_level(pool_size, "pool LASTPOOL");
                 
                 if (pool_id == PoolLevel::LOW)
                     return instance_for_low_level;
@@ -67,6 +67,21 @@ namespace nil {
                 throw std::invalid_argument("Invalid instance of thread pool requested.");
             }
 
+            /** Observer of the tasks run by the pools, e.g. a tracer. Both calls are made on the worker thread
+             *  that runs the task.
+             */
+            class task_observer {
+            public:
+                virtual ~task_observer() = default;
+                virtual void task_started(const char* pool_name) = 0;
+                virtual void task_finished(const char* pool_name) = 0;
+            };
+
+            // Sets the observer of the tasks of all the pools, nullptr removes it. The observer must outlive the tasks.
+            static void set_task_observer(task_observer* observer) {
+                observer_instance().store(observer, std::memory_order_release);
+            }
+
             ThreadPool(const ThreadPool& obj)= delete;
             ThreadPool& operator=(const ThreadPool& obj)= delete;
 
@@ -74,7 +89,16 @@ namespace nil {
             inline std::future<ReturnType> post(std::function<ReturnType()> task) {
                 auto packaged_task = std::make_shared<std::packaged_task<ReturnType()>>(std::move(task));
                 std::future<ReturnType> fut = packaged_task->get_future();
-                boost::asio::post(pool, [packaged_task]() -> void { (*packaged_task)(); });
+                boost::asio::post(pool, [packaged_task, pool_name = pool_name]() -> void {
+                    task_observer* observer = observer_instance().load(std::memory_order_acquire);
+                    if (observer == nullptr) {
+                        (*packaged_task)();
+                        return;
+                    }
+                    observer->task_started(pool_name);
+                    (*packaged_task)();
+                    observer->task_finished(pool_name);
+                });
                 return fut;
             }
  
@@ -88,13 +112,20 @@ namespace nil {
             }
 
         private:
-            inline ThreadPool(std::size_t pool_size)
+            inline ThreadPool(std::size_t pool_size, const char* pool_name)
                 : pool(pool_size)
-                , pool_size(pool_size)  {
+                , pool_size(pool_size)
+                , pool_name(pool_name) {
+            }
+
+            static std::atomic<task_observer*>& observer_instance() {
+                static std::atomic<task_observer*> observer = nullptr;
+                return observer;
             }
 
             boost::asio::thread_pool pool;
             const std::size_t pool_size;
+            const char* const pool_name;
 
         };
 
@@ -20,12 +20,17 @@
 #ifndef PROOF_GENERATOR_ASSIGNER_PROOF_HPP
 #define PROOF_GENERATOR_ASSIGNER_PROOF_HPP
 
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <functional>
+#include <future>
+#include <memory>
 #include <ostream>
 #include <random>
 #include <sstream>
 #include <optional>
+#include <vector>
 
 #include <boost/log/trivial.hpp>
 
@@ -44,6 +49,9 @@
 
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
 
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
@@ -109,6 +117,182 @@ namespace nil {
                 return hex ? write_vector_to_hex_file(v, path.c_str()) : write_vector_to_file(v, path.c_str());
             }
 
+            // Compact commitment state files are framed as
+            //   magic (8 bytes) | format version (4 bytes LE) | payload | sha2-256 of payload (32 bytes),
+            // so stale or truncated files are rejected before the merkle trees are rebuilt from them.
+            constexpr std::array<std::uint8_t, 8> compact_state_magic = {'P', 'H', 'C', 'S', 'T', 'A', 'T', 'E'};
+            // Version 2 stores the polynomials as field element blocks in Montgomery form.
+            constexpr std::uint32_t compact_state_version = 2;
+            constexpr std::size_t compact_state_header_size = compact_state_magic.size() + sizeof(std::uint32_t);
+            constexpr std::size_t compact_state_checksum_size = 32;
+
+            inline bool has_compact_state_header(const std::vector<std::uint8_t>& v) {
+                return v.size() >= compact_state_header_size &&
+                    std::equal(compact_state_magic.begin(), compact_state_magic.end(), v.begin());
+            }
+
+            inline std::array<std::uint8_t, compact_state_checksum_size> compact_state_checksum(
+                std::vector<std::uint8_t>::const_iterator begin,
+                std::vector<std::uint8_t>::const_iterator end
+            ) {
+                using hash_type = nil::crypto3::hashes::sha2<256>;
+                typename hash_type::digest_type d = nil::crypto3::hash<hash_type>(begin, end);
+                std::array<std::uint8_t, compact_state_checksum_size> result;
+                std::copy(d.begin(), d.end(), result.begin());
+                return result;
+            }
+
+            template<typename MarshallingType>
+            bool encode_compact_state_to_file(
+                const boost::filesystem::path& path,
+                const MarshallingType& data_for_marshalling
+            ) {
+                std::vector<std::uint8_t> v(compact_state_header_size + data_for_marshalling.length(), 0x00);
+                std::copy(compact_state_magic.begin(), compact_state_magic.end(), v.begin());
+                for (std::size_t i = 0; i < sizeof(std::uint32_t); ++i) {
+                    v[compact_state_magic.size() + i] = std::uint8_t(compact_state_version >> (8 * i));
+                }
+
+                auto write_iter = v.begin() + compact_state_header_size;
+                nil::marshalling::status_type status = data_for_marshalling.write(
+                    write_iter, data_for_marshalling.length());
+                if (status != nil::marshalling::status_type::success) {
+                    BOOST_LOG_TRIVIAL(error) << "Marshalled structure encoding failed";
+                    return false;
+                }
+
+                auto checksum = compact_state_checksum(v.cbegin() + compact_state_header_size, v.cend());
+                v.insert(v.end(), checksum.begin(), checksum.end());
+                return write_vector_to_file(v, path.c_str());
+            }
+
+            // The caller is expected to check the magic with has_compact_state_header first.
+            template<typename MarshallingType>
+            std::optional<MarshallingType> decode_compact_state(
+                const boost::filesystem::path& path,
+                const std::vector<std::uint8_t>& v
+            ) {
+                if (v.size() < compact_state_header_size + compact_state_checksum_size) {
+                    BOOST_LOG_TRIVIAL(error) << "Commitment state file " << path << " is truncated.";
+                    return std::nullopt;
+                }
+
+                std::uint32_t version = 0;
+                for (std::size_t i = 0; i < sizeof(std::uint32_t); ++i) {
+                    version |= std::uint32_t(v[compact_state_magic.size() + i]) << (8 * i);
+                }
+                if (version != compact_state_version) {
+                    BOOST_LOG_TRIVIAL(error) << "Commitment state file " << path << " has format version " << version
+                        << ", expected " << compact_state_version;
+                    return std::nullopt;
+                }
+
+                auto payload_begin = v.cbegin() + compact_state_header_size;
+                auto payload_end = v.cend() - compact_state_checksum_size;
+                auto checksum = compact_state_checksum(payload_begin, payload_end);
+                if (!std::equal(checksum.begin(), checksum.end(), payload_end)) {
+                    BOOST_LOG_TRIVIAL(error) << "Checksum mismatch in commitment state file " << path;
+                    return std::nullopt;
+                }
+
+                MarshallingType marshalled_data;
+                auto read_iter = payload_begin;
+                auto status = marshalled_data.read(read_iter, std::distance(payload_begin, payload_end));
+                if (status != nil::marshalling::status_type::success) {
+                    BOOST_LOG_TRIVIAL(error) << "When reading a Marshalled structure from file "
+                        << path << ", decoding step failed.";
+                    return std::nullopt;
+                }
+                return marshalled_data;
+            }
+
+            // Constraint system hash cache files are
+            //   magic (8 bytes) | key (32 bytes) | digest,
+            // the key is a sha2-256 of the circuit file and of the parameters the hash depends on.
+            constexpr std::array<std::uint8_t, 8> constraint_system_hash_cache_magic = {'P', 'H', 'C', 'S', 'H', 'A', 'S', 'H'};
+            constexpr std::size_t constraint_system_hash_cache_key_size = compact_state_checksum_size;
+
+            template<typename DigestType>
+            std::vector<std::uint8_t> encode_digest(const DigestType& digest) {
+                if constexpr (nil::crypto3::algebra::is_field_element<DigestType>::value) {
+                    using TTypeBase = nil::marshalling::field_type<nil::marshalling::option::big_endian>;
+                    nil::crypto3::marshalling::types::field_element<TTypeBase, DigestType> filled_digest(digest);
+                    std::vector<std::uint8_t> v(filled_digest.length());
+                    auto write_iter = v.begin();
+                    filled_digest.write(write_iter, v.size());
+                    return v;
+                } else {
+                    return std::vector<std::uint8_t>(digest.begin(), digest.end());
+                }
+            }
+
+            template<typename DigestType>
+            std::optional<DigestType> decode_digest(
+                std::vector<std::uint8_t>::const_iterator begin,
+                std::vector<std::uint8_t>::const_iterator end
+            ) {
+                if constexpr (nil::crypto3::algebra::is_field_element<DigestType>::value) {
+                    using TTypeBase = nil::marshalling::field_type<nil::marshalling::option::big_endian>;
+                    nil::crypto3::marshalling::types::field_element<TTypeBase, DigestType> filled_digest;
+                    auto read_iter = begin;
+                    if (filled_digest.read(read_iter, std::distance(begin, end)) != nil::marshalling::status_type::success) {
+                        return std::nullopt;
+                    }
+                    return filled_digest.value();
+                } else {
+                    DigestType digest;
+                    if (std::size_t(std::distance(begin, end)) != digest.size()) {
+                        return std::nullopt;
+                    }
+                    std::copy(begin, end, digest.begin());
+                    return digest;
+                }
+            }
+
+            // Returns the cached digest if the cache file exists and was written for the same key.
+            template<typename DigestType>
+            std::optional<DigestType> read_constraint_system_hash_cache(
+                const boost::filesystem::path& path,
+                const std::array<std::uint8_t, constraint_system_hash_cache_key_size>& key
+            ) {
+                if (!boost::filesystem::exists(path)) {
+                    return std::nullopt;
+                }
+                const auto v = read_file_to_vector(path.c_str());
+                const std::size_t header_size = constraint_system_hash_cache_magic.size() + key.size();
+                if (!v.has_value() || v->size() < header_size ||
+                    !std::equal(constraint_system_hash_cache_magic.begin(), constraint_system_hash_cache_magic.end(),
+                                v->begin())) {
+                    BOOST_LOG_TRIVIAL(warning) << "Ignoring invalid constraint system hash cache " << path;
+                    return std::nullopt;
+                }
+                if (!std::equal(key.begin(), key.end(), v->begin() + constraint_system_hash_cache_magic.size())) {
+                    BOOST_LOG_TRIVIAL(info) << "Constraint system hash cache " << path << " is stale";
+                    return std::nullopt;
+                }
+                return decode_digest<DigestType>(v->cbegin() + header_size, v->cend());
+            }
+
+            template<typename DigestType>
+            bool write_constraint_system_hash_cache(
+                const boost::filesystem::path& path,
+                const std::array<std::uint8_t, constraint_system_hash_cache_key_size>& key,
+                const DigestType& digest
+            ) {
+                std::vector<std::uint8_t> v(constraint_system_hash_cache_magic.begin(), constraint_system_hash_cache_magic.end());
+                v.insert(v.end(), key.begin(), key.end());
+                auto digest_bytes = encode_digest(digest);
+                v.insert(v.end(), digest_bytes.begin(), digest_bytes.end());
+                return write_vector_to_file(v, path.c_str());
+            }
+
+            // Logs current and peak resident set size of the process after a prover phase.
+            inline void log_memory_usage(const std::string& phase) {
+                using namespace nil::crypto3::zk::commitments::detail;
+                BOOST_LOG_TRIVIAL(info) << "Memory usage after " << phase << ": RSS " << (current_rss_bytes() >> 20)
+                    << " MB, peak RSS " << (peak_rss_bytes() >> 20) << " MB";
+            }
+
             enum class ProverStage {
                 ALL = 0,
                 PRESET = 1,
@@ -121,7 +305,8 @@ namespace nil {
                 COMPUTE_COMBINED_Q = 8,
                 GENERATE_AGGREGATED_FRI_PROOF = 9,
                 GENERATE_CONSISTENCY_CHECKS_PROOF = 10,
-                MERGE_PROOFS = 11
+                MERGE_PROOFS = 11,
+                AGGREGATE = 12
             };
 
             ProverStage prover_stage_from_string(const std::string& stage) {
@@ -137,7 +322,8 @@ namespace nil {
                     {"compute-combined-Q", ProverStage::COMPUTE_COMBINED_Q},
                     {"merge-proofs", ProverStage::MERGE_PROOFS},
                     {"aggregated-FRI", ProverStage::GENERATE_AGGREGATED_FRI_PROOF},
-                    {"consistency-checks", ProverStage::GENERATE_CONSISTENCY_CHECKS_PROOF}
+                    {"consistency-checks", ProverStage::GENERATE_CONSISTENCY_CHECKS_PROOF},
+                    {"aggregate", ProverStage::AGGREGATE}
                 };
                 auto it = stage_map.find(stage);
                 if (it == stage_map.end()) {
@@ -189,6 +375,32 @@ namespace nil {
                 circuit_name_(circuit_name){
             }
 
+            // When set, the constraint system hash computed by the public preprocessor is stored in this file, and
+            // reused by later runs on the same circuit with the same parameters. 'hash_type_name' is the --hash-type
+            // name of HashType, it is a part of the cache key. Must be set before read_circuit.
+            void set_constraint_system_hash_cache(const boost::filesystem::path& cache_file,
+                                                  const std::string& hash_type_name) {
+                constraint_system_hash_cache_ = cache_file;
+                constraint_system_hash_type_name_ = hash_type_name;
+            }
+
+            // When the resident set grows over 'limit_bytes', committed polynomial batches are moved to scratch
+            // files in 'scratch_directory' until the evaluation proof. Must be set before the commitment scheme
+            // is created or read.
+            void set_memory_budget(std::size_t limit_bytes, const boost::filesystem::path& scratch_directory) {
+                memory_budget_ = std::make_shared<nil::crypto3::zk::commitments::detail::memory_budget>(
+                    limit_bytes, scratch_directory);
+            }
+
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+            // Low degree extensions and trees of committed columns are kept in 'directory' in between runs, at
+            // most 'limit_bytes' of them, 0 means no limit. Must be set before the commitment scheme is created.
+            void set_lde_cache(const boost::filesystem::path& directory, std::size_t limit_bytes) {
+                lde_cache_ = std::make_shared<nil::crypto3::zk::commitments::detail::lde_cache>(
+                    directory, limit_bytes);
+            }
+#endif
+
             bool print_evm_verifier(
                 boost::filesystem::path output_folder
             ){
@@ -254,6 +466,7 @@ namespace nil {
                     *lpc_scheme_
                 );
                 BOOST_LOG_TRIVIAL(info) << "Proof generated";
+                detail::log_memory_usage("proof generation");
 
                 if (skip_verification) {
                     BOOST_LOG_TRIVIAL(info) << "Skipping proof verification";
@@ -294,16 +507,18 @@ namespace nil {
                 return res;
             }
 
-            // The caller must call the preprocessor or load the preprocessed data before calling this function.
-            bool generate_partial_proof_to_file(
-                    boost::filesystem::path proof_file_,
-                    std::optional<boost::filesystem::path> challenge_file_,
-                    std::optional<boost::filesystem::path> theta_power_file) {
-                if (!nil::proof_generator::can_write_to_file(proof_file_.string())) {
-                    BOOST_LOG_TRIVIAL(error) << "Can't write to file " << proof_file_;
-                    return false;
-                }
+            // Everything a single prover produces in the first stage of the aggregated proof.
+            struct PartialProofResult {
+                Proof proof;
+                typename BlueprintField::value_type challenge;
+                // Amount of powers of theta used by combined_Q of this prover.
+                std::size_t theta_power;
+                // Commitment scheme state after the proof, it is used to compute combined_Q and consistency checks.
+                LpcScheme commitment_scheme;
+            };
 
+            // The caller must call the preprocessor or load the preprocessed data before calling this function.
+            PartialProofResult generate_partial_proof() {
                 BOOST_ASSERT(public_preprocessed_data_);
                 BOOST_ASSERT(private_preprocessed_data_);
                 BOOST_ASSERT(table_description_);
@@ -320,7 +535,27 @@ namespace nil {
                         true);
                 Proof proof = prover.process();
                 BOOST_LOG_TRIVIAL(info) << "Proof generated";
+                detail::log_memory_usage("proof generation");
+
+                auto commitment_scheme = prover.get_commitment_scheme();
+
+                commitment_scheme.state_commited(crypto3::zk::snark::FIXED_VALUES_BATCH);
+                commitment_scheme.state_commited(crypto3::zk::snark::VARIABLE_VALUES_BATCH);
+                commitment_scheme.state_commited(crypto3::zk::snark::PERMUTATION_BATCH);
+                commitment_scheme.state_commited(crypto3::zk::snark::QUOTIENT_BATCH);
+                commitment_scheme.state_commited(crypto3::zk::snark::LOOKUP_BATCH);
+                commitment_scheme.mark_batch_as_fixed(crypto3::zk::snark::FIXED_VALUES_BATCH);
+
+                commitment_scheme.set_fixed_polys_values(common_data_.has_value() ? common_data_->commitment_scheme_data :
+                                                                                    public_preprocessed_data_->common_data.commitment_scheme_data);
 
+                std::size_t theta_power = commitment_scheme.compute_theta_power_for_combined_Q();
+
+                auto challenge = proof.eval_proof.challenge;
+                return {std::move(proof), challenge, theta_power, std::move(commitment_scheme)};
+            }
+
+            bool save_partial_proof_to_file(const Proof& proof, const boost::filesystem::path& proof_file_) {
                 BOOST_LOG_TRIVIAL(info) << "Writing proof to " << proof_file_;
                 auto filled_placeholder_proof =
                     nil::crypto3::marshalling::types::fill_placeholder_proof<Endianness, Proof>(proof, lpc_scheme_->get_fri_params());
@@ -334,6 +569,32 @@ namespace nil {
                 } else {
                     BOOST_LOG_TRIVIAL(error) << "Failed to write proof to file.";
                 }
+                return res;
+            }
+
+            bool save_theta_power_to_file(std::size_t theta_power, const boost::filesystem::path& theta_power_file) {
+                auto output_file = open_file<std::ofstream>(theta_power_file.string(), std::ios_base::out);
+                if (!output_file) {
+                    return false;
+                }
+                (*output_file) << theta_power << std::endl;
+                output_file->close();
+                return true;
+            }
+
+            // The caller must call the preprocessor or load the preprocessed data before calling this function.
+            bool generate_partial_proof_to_file(
+                    boost::filesystem::path proof_file_,
+                    std::optional<boost::filesystem::path> challenge_file_,
+                    std::optional<boost::filesystem::path> theta_power_file) {
+                if (!nil::proof_generator::can_write_to_file(proof_file_.string())) {
+                    BOOST_LOG_TRIVIAL(error) << "Can't write to file " << proof_file_;
+                    return false;
+                }
+
+                PartialProofResult partial_proof = generate_partial_proof();
+
+                bool res = save_partial_proof_to_file(partial_proof.proof, proof_file_);
 
                 if (!challenge_file_) {
                     BOOST_LOG_TRIVIAL(error) << "Challenge output file is not set.";
@@ -344,37 +605,14 @@ namespace nil {
                     return false;
                 }
                 BOOST_LOG_TRIVIAL(info) << "Writing challenge";
-                using challenge_marshalling_type =
-                    nil::crypto3::marshalling::types::field_element<
-                    TTypeBase, typename BlueprintField::value_type>;
-
-                challenge_marshalling_type marshalled_challenge(proof.eval_proof.challenge);
-
-                res = detail::encode_marshalling_to_file<challenge_marshalling_type>(
-                            *challenge_file_, marshalled_challenge);
+                res = save_challenge(*challenge_file_, partial_proof.challenge);
                 if (res) {
                     BOOST_LOG_TRIVIAL(info) << "Challenge written.";
                 } else {
                     BOOST_LOG_TRIVIAL(error) << "Failed to write challenge to file.";
                 }
 
-                auto commitment_scheme = prover.get_commitment_scheme();
-
-                commitment_scheme.state_commited(crypto3::zk::snark::FIXED_VALUES_BATCH);
-                commitment_scheme.state_commited(crypto3::zk::snark::VARIABLE_VALUES_BATCH);
-                commitment_scheme.state_commited(crypto3::zk::snark::PERMUTATION_BATCH);
-                commitment_scheme.state_commited(crypto3::zk::snark::QUOTIENT_BATCH);
-                commitment_scheme.state_commited(crypto3::zk::snark::LOOKUP_BATCH);
-                commitment_scheme.mark_batch_as_fixed(crypto3::zk::snark::FIXED_VALUES_BATCH);
-
-                commitment_scheme.set_fixed_polys_values(common_data_.has_value() ? common_data_->commitment_scheme_data :
-                                                                                    public_preprocessed_data_->common_data.commitment_scheme_data);
-
-                std::size_t theta_power = commitment_scheme.compute_theta_power_for_combined_Q();
-
-                auto output_file = open_file<std::ofstream>(theta_power_file->string(), std::ios_base::out);
-                (*output_file) << theta_power << std::endl;
-                output_file->close();
+                save_theta_power_to_file(partial_proof.theta_power, *theta_power_file);
 
                 return res;
             }
@@ -398,6 +636,48 @@ namespace nil {
                 return res;
             }
 
+            // Verifies proofs of the same circuit in one batch, the result is true only if all of them are valid.
+            bool verify_batch_from_files(const std::vector<boost::filesystem::path>& proof_files) {
+                create_lpc_scheme();
+
+                using ProofMarshalling = nil::crypto3::marshalling::types::
+                    placeholder_proof<nil::marshalling::field_type<Endianness>, Proof>;
+
+                std::vector<Proof> proofs;
+                proofs.reserve(proof_files.size());
+                for (const auto& proof_file: proof_files) {
+                    BOOST_LOG_TRIVIAL(info) << "Reading proof from " << proof_file;
+                    auto marshalled_proof = detail::decode_marshalling_from_file<ProofMarshalling>(proof_file, true);
+                    if (!marshalled_proof) {
+                        return false;
+                    }
+                    proofs.emplace_back(nil::crypto3::marshalling::types::make_placeholder_proof<Endianness, Proof>(
+                        *marshalled_proof));
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Verifying " << proofs.size() << " proofs...";
+                std::vector<bool> results =
+                    nil::crypto3::zk::snark::placeholder_verifier<BlueprintField, PlaceholderParams>::process_batch(
+                        public_preprocessed_data_.has_value() ? public_preprocessed_data_->common_data : *common_data_,
+                        proofs,
+                        *table_description_,
+                        *constraint_system_,
+                        *lpc_scheme_
+                    );
+
+                bool res = true;
+                for (std::size_t i = 0; i < results.size(); ++i) {
+                    if (!results[i]) {
+                        BOOST_LOG_TRIVIAL(error) << "Proof verification failed for " << proof_files[i];
+                        res = false;
+                    }
+                }
+                if (res) {
+                    BOOST_LOG_TRIVIAL(info) << "All " << proofs.size() << " proofs are verified.";
+                }
+                return res;
+            }
+
             bool save_preprocessed_common_data_to_file(boost::filesystem::path preprocessed_common_data_file) {
                 BOOST_LOG_TRIVIAL(info) << "Writing preprocessed common data to " << preprocessed_common_data_file;
                 auto marshalled_common_data =
@@ -474,45 +754,85 @@ namespace nil {
                 return true;
             }
 
-            bool save_commitment_state_to_file(boost::filesystem::path commitment_scheme_state_file) {
+            // When 'compact' is set, only the roots of the merkle trees are saved, trees are rebuilt on reading.
+            bool save_commitment_state_to_file(boost::filesystem::path commitment_scheme_state_file, bool compact = false) {
                 using namespace nil::crypto3::marshalling::types;
 
-                BOOST_LOG_TRIVIAL(info) << "Writing commitment_state to " <<
+                BOOST_LOG_TRIVIAL(info) << "Writing " << (compact ? "compact " : "") << "commitment_state to " <<
                     commitment_scheme_state_file;
 
-                auto marshalled_lpc_state = fill_commitment_scheme<Endianness, LpcScheme>(
-                    *lpc_scheme_);
-                bool res = nil::proof_generator::detail::encode_marshalling_to_file(
-                    commitment_scheme_state_file,
-                    marshalled_lpc_state
-                );
+                // Marshalling reads the polynomials directly, so batches moved out of memory are loaded back.
+                lpc_scheme_->load_spilled_batches();
+
+                bool res;
+                if (compact) {
+                    auto marshalled_lpc_state = fill_compact_commitment_scheme<Endianness, LpcScheme>(
+                        *lpc_scheme_);
+                    res = nil::proof_generator::detail::encode_compact_state_to_file(
+                        commitment_scheme_state_file,
+                        marshalled_lpc_state
+                    );
+                } else {
+                    auto marshalled_lpc_state = fill_commitment_scheme<Endianness, LpcScheme>(
+                        *lpc_scheme_);
+                    res = nil::proof_generator::detail::encode_marshalling_to_file(
+                        commitment_scheme_state_file,
+                        marshalled_lpc_state
+                    );
+                }
                 if (res) {
                     BOOST_LOG_TRIVIAL(info) << "Commitment scheme written.";
                 }
                 return res;
             }
 
+            // Both the full and the compact formats are accepted, the format is detected by the file header.
             bool read_commitment_scheme_from_file(boost::filesystem::path commitment_scheme_state_file) {
                 BOOST_LOG_TRIVIAL(info) << "Read commitment scheme from " << commitment_scheme_state_file;
 
                 using namespace nil::crypto3::marshalling::types;
 
                 using CommitmentStateMarshalling = typename commitment_scheme_state<TTypeBase, LpcScheme>::type;
+                using CompactCommitmentStateMarshalling =
+                    typename compact_commitment_scheme_state<TTypeBase, LpcScheme>::type;
 
-                auto marshalled_value = detail::decode_marshalling_from_file<CommitmentStateMarshalling>(
-                    commitment_scheme_state_file);
-
-                if (!marshalled_value) {
+                const auto v = read_file_to_vector(commitment_scheme_state_file.c_str());
+                if (!v.has_value()) {
                     return false;
                 }
 
-                auto commitment_scheme = make_commitment_scheme<Endianness, LpcScheme>(*marshalled_value);
+                outcome::result<LpcScheme, nil::marshalling::status_type> commitment_scheme =
+                    nil::marshalling::status_type::invalid_msg_data;
+                if (detail::has_compact_state_header(*v)) {
+                    auto marshalled_value = detail::decode_compact_state<CompactCommitmentStateMarshalling>(
+                        commitment_scheme_state_file, *v);
+                    if (!marshalled_value) {
+                        return false;
+                    }
+                    BOOST_LOG_TRIVIAL(info) << "Rebuilding commitment scheme merkle trees";
+                    commitment_scheme = make_compact_commitment_scheme<Endianness, LpcScheme>(*marshalled_value);
+                } else {
+                    CommitmentStateMarshalling marshalled_value;
+                    auto read_iter = v->begin();
+                    auto status = marshalled_value.read(read_iter, v->size());
+                    if (status != nil::marshalling::status_type::success) {
+                        BOOST_LOG_TRIVIAL(error) << "When reading a Marshalled structure from file "
+                            << commitment_scheme_state_file << ", decoding step failed.";
+                        return false;
+                    }
+                    commitment_scheme = make_commitment_scheme<Endianness, LpcScheme>(marshalled_value);
+                }
+
                 if (!commitment_scheme) {
                     BOOST_LOG_TRIVIAL(error) << "Error decoding commitment scheme";
                     return false;
                 }
 
                 lpc_scheme_.emplace(commitment_scheme.value());
+                lpc_scheme_->set_memory_budget(memory_budget_);
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+                lpc_scheme_->set_lde_cache(lde_cache_);
+#endif
                 return true;
             }
 
@@ -552,6 +872,14 @@ namespace nil {
                     )
                 );
 
+                if (!constraint_system_hash_cache_.empty()) {
+                    // Checksum of the file is much cheaper than the constraint system hash, which uses the transcript hash.
+                    auto circuit_bytes = read_file_to_vector(circuit_file_.c_str());
+                    if (circuit_bytes.has_value()) {
+                        circuit_checksum_ = detail::compact_state_checksum(circuit_bytes->cbegin(), circuit_bytes->cend());
+                    }
+                }
+
                 return true;
             }
 
@@ -758,6 +1086,10 @@ namespace nil {
                 std::size_t table_rows_log = std::ceil(std::log2(table_description_->rows_amount));
 
                 lpc_scheme_.emplace(FriParams(1, table_rows_log, lambda_, expand_factor_, grind_!=0, grind_));
+                lpc_scheme_->set_memory_budget(memory_budget_);
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+                lpc_scheme_->set_lde_cache(lde_cache_);
+#endif
             }
 
             bool preprocess_public_data() {
@@ -765,6 +1097,17 @@ namespace nil {
 
                 create_lpc_scheme();
 
+                using digest_type = typename PlaceholderParams::transcript_hash_type::digest_type;
+                auto cache_key = constraint_system_hash_cache_key();
+                std::optional<digest_type> cached_hash;
+                if (cache_key.has_value()) {
+                    cached_hash = detail::read_constraint_system_hash_cache<digest_type>(
+                        constraint_system_hash_cache_, *cache_key);
+                    if (cached_hash.has_value()) {
+                        BOOST_LOG_TRIVIAL(info) << "Using constraint system hash from " << constraint_system_hash_cache_;
+                    }
+                }
+
                 BOOST_LOG_TRIVIAL(info) << "Preprocessing public data";
                 public_preprocessed_data_.emplace(
                     nil::crypto3::zk::snark::placeholder_public_preprocessor<BlueprintField, PlaceholderParams>::
@@ -773,12 +1116,46 @@ namespace nil {
                             assignment_table_->move_public_table(),
                             *table_description_,
                             *lpc_scheme_,
-                            max_quotient_chunks_
+                            max_quotient_chunks_,
+                            nil::crypto3::algebra::fields::arithmetic_params<BlueprintField>::multiplicative_generator,
+                            cached_hash
                         )
                 );
+                detail::log_memory_usage("public preprocessing");
+
+                if (cache_key.has_value() && !cached_hash.has_value()) {
+                    BOOST_LOG_TRIVIAL(info) << "Writing constraint system hash to " << constraint_system_hash_cache_;
+                    if (!detail::write_constraint_system_hash_cache(
+                            constraint_system_hash_cache_, *cache_key,
+                            public_preprocessed_data_->common_data.vk.constraint_system_with_params_hash)) {
+                        BOOST_LOG_TRIVIAL(warning) << "Failed to write constraint system hash cache "
+                            << constraint_system_hash_cache_;
+                    }
+                }
                 return true;
             }
 
+            // Key of the constraint system hash cache: the circuit file checksum and all the parameters the hash
+            // depends on. Not set if the cache is disabled.
+            std::optional<std::array<std::uint8_t, detail::constraint_system_hash_cache_key_size>>
+            constraint_system_hash_cache_key() const {
+                if (constraint_system_hash_cache_.empty() || !circuit_checksum_.has_value()) {
+                    return std::nullopt;
+                }
+                std::vector<std::uint8_t> data(circuit_checksum_->begin(), circuit_checksum_->end());
+                for (std::size_t param: {table_description_->rows_amount, table_description_->usable_rows_amount,
+                                         lambda_, expand_factor_, grind_, max_quotient_chunks_,
+                                         std::size_t(HashType::digest_bits)}) {
+                    for (std::size_t i = 0; i < sizeof(std::uint64_t); ++i) {
+                        data.push_back(std::uint8_t(std::uint64_t(param) >> (8 * i)));
+                    }
+                }
+                // The digest type and value depend on the transcript hash.
+                data.insert(data.end(), constraint_system_hash_type_name_.begin(),
+                            constraint_system_hash_type_name_.end());
+                return detail::compact_state_checksum(data.cbegin(), data.cend());
+            }
+
             bool preprocess_private_data() {
 
                 BOOST_LOG_TRIVIAL(info) << "Preprocessing private data";
@@ -789,6 +1166,7 @@ namespace nil {
 
                 // This is the last stage of preprocessor, and the assignment table is not used after this function call.
                 assignment_table_.reset();
+                detail::log_memory_usage("private preprocessing");
 
                 return true;
             }
@@ -1098,6 +1476,163 @@ namespace nil {
                 return save_lpc_consistency_proof_to_file(proof, output_proof_file);
             }
 
+            // Runs all the stages of the aggregated proof in a single process: partial proofs for all the circuits
+            // are generated concurrently, then challenges are aggregated, combined_Q polynomials are summed up in
+            // memory, and the aggregated FRI proof together with the consistency checks is merged into the final proof.
+            // If artifacts_dir is set, the same intermediate files as in the multi-process flow are written there.
+            bool generate_aggregated_proof_to_file(
+                const std::vector<boost::filesystem::path>& circuit_files,
+                const std::vector<boost::filesystem::path>& assignment_table_files,
+                const boost::filesystem::path& aggregated_proof_file,
+                const std::optional<boost::filesystem::path>& artifacts_dir,
+                std::size_t jobs) {
+
+                /* ZK types */
+                using placeholder_aggregated_proof_type = nil::crypto3::zk::snark::
+                    placeholder_aggregated_proof<BlueprintField, PlaceholderParams>;
+
+                using merged_proof_marshalling_type = nil::crypto3::marshalling::types::
+                    placeholder_aggregated_proof_type<TTypeBase, placeholder_aggregated_proof_type>;
+
+                using transcript_hash_type = typename PlaceholderParams::transcript_hash_type;
+                using transcript_type = crypto3::zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+
+                if (circuit_files.empty()) {
+                    BOOST_LOG_TRIVIAL(error) << "No circuits for aggregation";
+                    return false;
+                }
+                if (circuit_files.size() != assignment_table_files.size()) {
+                    BOOST_LOG_TRIVIAL(error) << "Number of circuit and assignment table files should match.";
+                    return false;
+                }
+                if (!nil::proof_generator::can_write_to_file(aggregated_proof_file.string())) {
+                    BOOST_LOG_TRIVIAL(error) << "Can't write to file " << aggregated_proof_file;
+                    return false;
+                }
+                if (artifacts_dir) {
+                    boost::filesystem::create_directories(*artifacts_dir);
+                }
+
+                const std::size_t provers_amount = circuit_files.size();
+                if (jobs == 0 || jobs > provers_amount) {
+                    jobs = provers_amount;
+                }
+
+                // Sub-provers are not run on the thread pools: the placeholder prover itself submits tasks to all
+                // the pool levels, so a dedicated thread per partial proof is used instead.
+                std::vector<std::unique_ptr<Prover>> provers;
+                std::vector<std::optional<PartialProofResult>> partial_proofs(provers_amount);
+                for (std::size_t i = 0; i < provers_amount; i++) {
+                    provers.emplace_back(std::make_unique<Prover>(
+                        lambda_, expand_factor_, max_quotient_chunks_, grind_, circuit_name_));
+                }
+
+                auto run_partial_prover = [&](std::size_t i) {
+                    Prover& prover = *provers[i];
+                    bool ok = prover.read_circuit(circuit_files[i]) &&
+                        prover.read_assignment_table(assignment_table_files[i]) &&
+                        prover.preprocess_public_data() &&
+                        prover.preprocess_private_data();
+                    if (!ok) {
+                        BOOST_LOG_TRIVIAL(error) << "Failed to prepare prover for circuit " << circuit_files[i];
+                        return false;
+                    }
+                    partial_proofs[i].emplace(prover.generate_partial_proof());
+                    return true;
+                };
+
+                for (std::size_t first = 0; first < provers_amount; first += jobs) {
+                    std::size_t last = std::min(first + jobs, provers_amount);
+                    std::vector<std::future<bool>> results;
+                    for (std::size_t i = first; i < last; i++) {
+                        results.emplace_back(std::async(std::launch::async, run_partial_prover, i));
+                    }
+                    bool all_ok = true;
+                    for (auto& result : results) {
+                        // get() rethrows the exception of a failed prover, so all the futures are waited for first.
+                        result.wait();
+                    }
+                    for (auto& result : results) {
+                        all_ok = result.get() && all_ok;
+                    }
+                    if (!all_ok) {
+                        return false;
+                    }
+                }
+
+                // Aggregate challenges in the order of the input circuits.
+                transcript_type challenges_transcript;
+                for (const auto& partial_proof : partial_proofs) {
+                    challenges_transcript(partial_proof->challenge);
+                }
+                auto aggregated_challenge = challenges_transcript.template challenge<BlueprintField>();
+
+                // Each prover gets the powers of theta right after the ones used by the previous provers.
+                std::vector<polynomial_type> combined_Qs(provers_amount);
+                std::size_t starting_power = 0;
+                for (std::size_t i = 0; i < provers_amount; i++) {
+                    combined_Qs[i] = partial_proofs[i]->commitment_scheme.prepare_combined_Q(
+                        aggregated_challenge, starting_power);
+                    starting_power += partial_proofs[i]->theta_power;
+                }
+
+                polynomial_type sum_poly;
+                for (const auto& combined_Q : combined_Qs) {
+                    sum_poly += combined_Q;
+                }
+
+                transcript_type transcript;
+                transcript(aggregated_challenge);
+
+                auto& main_scheme = partial_proofs.front()->commitment_scheme;
+                auto [fri_proof, challenges] = main_scheme.proof_eval_FRI_proof(sum_poly, transcript);
+
+                typename FriType::grinding_type::output_type proof_of_work = nil::crypto3::zk::algorithms::run_grinding<FriType>(
+                    main_scheme.get_fri_params(), transcript);
+
+                placeholder_aggregated_proof_type merged_proof;
+                for (std::size_t i = 0; i < provers_amount; i++) {
+                    merged_proof.partial_proofs.emplace_back(partial_proofs[i]->proof);
+                    merged_proof.aggregated_proof.initial_proofs_per_prover.emplace_back(
+                        partial_proofs[i]->commitment_scheme.proof_eval_lpc_proof(combined_Qs[i], challenges));
+                }
+                merged_proof.aggregated_proof.fri_proof = fri_proof;
+                merged_proof.aggregated_proof.proof_of_work = proof_of_work;
+
+                if (artifacts_dir) {
+                    bool res = true;
+                    for (std::size_t i = 0; i < provers_amount; i++) {
+                        const std::string prefix = std::to_string(i) + "-";
+                        const auto& dir = *artifacts_dir;
+                        res = res &&
+                            provers[i]->save_partial_proof_to_file(partial_proofs[i]->proof, dir / (prefix + "proof.dat")) &&
+                            save_challenge(dir / (prefix + "challenge.dat"), partial_proofs[i]->challenge) &&
+                            save_theta_power_to_file(partial_proofs[i]->theta_power, dir / (prefix + "theta-power.txt")) &&
+                            save_poly_to_file(combined_Qs[i], dir / (prefix + "combined-Q.dat")) &&
+                            save_lpc_consistency_proof_to_file(
+                                merged_proof.aggregated_proof.initial_proofs_per_prover[i],
+                                dir / (prefix + "LPC_consistency_check_proof.bin"));
+                    }
+                    res = res &&
+                        save_challenge(*artifacts_dir / "aggregated_challenge.dat", aggregated_challenge) &&
+                        save_fri_proof_to_file(fri_proof, *artifacts_dir / "aggregated_FRI_proof.bin") &&
+                        save_proof_of_work(proof_of_work, *artifacts_dir / "proof_of_work.dat") &&
+                        save_challenge_vector_to_file(challenges, *artifacts_dir / "consistency_check_challenges.dat");
+                    if (!res) {
+                        BOOST_LOG_TRIVIAL(error) << "Failed to write aggregation artifacts to " << *artifacts_dir;
+                        return false;
+                    }
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Writing aggregated proof to \"" << aggregated_proof_file << "\"";
+
+                auto marshalled_proof = nil::crypto3::marshalling::types::fill_placeholder_aggregated_proof
+                    <Endianness, placeholder_aggregated_proof_type, Proof>
+                    (merged_proof, main_scheme.get_fri_params());
+
+                return detail::encode_marshalling_to_file<merged_proof_marshalling_type>(aggregated_proof_file, marshalled_proof);
+            }
+
             bool setup_prover() {
                 const auto err = CircuitFactory<BlueprintField>::initialize_circuit(circuit_name_, constraint_system_, assignment_table_, table_description_);
                 if (err) {
@@ -1144,6 +1679,14 @@ namespace nil {
             std::optional<ConstraintSystem> constraint_system_;
             std::optional<AssignmentTable> assignment_table_;
             std::optional<LpcScheme> lpc_scheme_;
+
+            boost::filesystem::path constraint_system_hash_cache_;
+            std::string constraint_system_hash_type_name_;
+            std::shared_ptr<nil::crypto3::zk::commitments::detail::memory_budget> memory_budget_;
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+            std::shared_ptr<nil::crypto3::zk::commitments::detail::lde_cache> lde_cache_;
+#endif
+            std::optional<std::array<std::uint8_t, detail::compact_state_checksum_size>> circuit_checksum_;
         };
 
     } // namespace proof_generator
@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+// Replaces the global allocation functions, so the spans of the tracer report how many allocations were made
+// inside them. Counting is skipped while the tracer is not running. All the replaceable forms are replaced, plain,
+// nothrow and aligned, so that every allocation is counted and memory is always released by the matching function.
+
+#include <cstdlib>
+#include <new>
+
+#include <nil/crypto3/bench/tracer.hpp>
+
+namespace {
+    void* allocate(std::size_t size) noexcept {
+        nil::crypto3::bench::tracer::count_allocation();
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* allocate_aligned(std::size_t size, std::align_val_t alignment) noexcept {
+        nil::crypto3::bench::tracer::count_allocation();
+        std::size_t align = static_cast<std::size_t>(alignment);
+        // posix_memalign requires at least the alignment of a pointer.
+        if (align < sizeof(void*)) {
+            align = sizeof(void*);
+        }
+        void* ptr = nullptr;
+        if (posix_memalign(&ptr, align, size == 0 ? 1 : size) != 0) {
+            return nullptr;
+        }
+        return ptr;
+    }
+}    // namespace
+
+void* operator new(std::size_t size) {
+    if (void* ptr = allocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = allocate_aligned(size, alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate_aligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate_aligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
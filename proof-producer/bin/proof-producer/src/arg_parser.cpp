@@ -74,13 +74,27 @@ namespace nil {
             // clang-format off
             auto options_appender = config.add_options()
                 ("stage", make_defaulted_option(prover_options.stage),
-                 "Stage of the prover to run, one of (all, preprocess, prove, verify, generate-aggregated-challenge, generate-combined-Q, aggregated-FRI, consistency-checks). Defaults to 'all'.")
+                 "Stage of the prover to run, one of (all, preprocess, prove, verify, generate-aggregated-challenge, generate-combined-Q, aggregated-FRI, consistency-checks, aggregate). Defaults to 'all'.")
                 ("proof,p", make_defaulted_option(prover_options.proof_file_path), "Proof file")
                 ("json,j", make_defaulted_option(prover_options.json_file_path), "JSON proof file")
                 ("common-data", make_defaulted_option(prover_options.preprocessed_common_data_path), "Preprocessed common data file")
                 ("preprocessed-data", make_defaulted_option(prover_options.preprocessed_public_data_path), "Preprocessed public data file")
                 ("commitment-state-file", make_defaulted_option(prover_options.commitment_scheme_state_path), "Commitment state data file")
                 ("updated-commitment-state-file", make_defaulted_option(prover_options.updated_commitment_scheme_state_path), "Updated commitment state data file")
+                ("compact-commitment-state", po::bool_switch(&prover_options.compact_commitment_state),
+                 "Write commitment state files without merkle trees, they are rebuilt when the state is read")
+                ("constraint-system-hash-cache", po::value(&prover_options.constraint_system_hash_cache_path),
+                 "File to keep the constraint system hash in between runs on the same circuit, it is recomputed if the circuit or parameters change")
+                ("memory-budget", make_defaulted_option(prover_options.memory_budget_mb),
+                 "Memory budget in megabytes, committed polynomials are moved to scratch files when it is exceeded. 0 means no limit")
+                ("spill-directory", po::value(&prover_options.spill_directory),
+                 "Folder for scratch files of the memory budget, system temporary folder by default")
+                ("lde-cache-directory", po::value(&prover_options.lde_cache_directory),
+                 "Folder to keep the low degree extensions and merkle trees of committed columns in between runs, columns unchanged since an earlier proof are not extended again")
+                ("lde-cache-limit", make_defaulted_option(prover_options.lde_cache_limit_mb),
+                 "Size limit of the LDE cache folder in megabytes, least recently used entries are removed when it is exceeded. 0 means no limit")
+                ("trace-output", po::value(&prover_options.trace_output_file),
+                 "Write a Chrome trace event JSON of the prover phases to the file, it can be opened in the Perfetto UI")
                 ("trace", po::value(&prover_options.trace_file_path), "EVM trace input file")
                 ("circuit", po::value(&prover_options.circuit_file_path), "Circuit input file")
                 ("circuit-name", po::value(&prover_options.circuit_name), "Target circuit name")
@@ -108,6 +122,8 @@ namespace nil {
                  "File containing the polynomial combined-Q, generated on a single prover.")
                 ("combined-Q-starting-power", po::value<std::size_t>(&prover_options.combined_Q_starting_power),
                  "The starting power for combined-Q polynomial for the current prover.")
+                ("verify-proofs", po::value<std::vector<boost::filesystem::path>>(&prover_options.verify_proof_files)->multitoken(),
+                 "Proofs of the same circuit to verify in one batch. Used with 'verify' stage instead of --proof.")
                 ("partial-proof", po::value<std::vector<boost::filesystem::path>>(&prover_options.partial_proof_files)->multitoken(),
                  "Partial proofs. Used with 'merge-proofs' stage.")
                 ("aggregated-proof", po::value<std::vector<boost::filesystem::path>>(&prover_options.aggregated_proof_files)->multitoken(),
@@ -118,7 +134,15 @@ namespace nil {
                  "Aggregated FRI proof part of the final proof. Used with 'merge-proofs' stage.")
                 ("input-combined-Q-polynomial-files", po::value<std::vector<boost::filesystem::path>>(&prover_options.input_combined_Q_polynomial_files),
                  "Files containing polynomials combined-Q, 1 per prover instance.")
-                ("proof-of-work-file", make_defaulted_option(prover_options.proof_of_work_output_file), "File with proof of work.");
+                ("proof-of-work-file", make_defaulted_option(prover_options.proof_of_work_output_file), "File with proof of work.")
+                ("aggregate-circuits", po::value<std::vector<boost::filesystem::path>>(&prover_options.aggregate_circuit_files)->multitoken(),
+                 "Circuit files, 1 per partial proof. Used with 'aggregate' stage.")
+                ("aggregate-assignment-tables", po::value<std::vector<boost::filesystem::path>>(&prover_options.aggregate_assignment_table_files)->multitoken(),
+                 "Assignment table files in the same order as circuits. Used with 'aggregate' stage.")
+                ("aggregation-artifacts-dir", po::value<boost::filesystem::path>(&prover_options.aggregation_artifacts_dir),
+                 "Folder for the intermediate files of the 'aggregate' stage. Nothing is written if not set.")
+                ("aggregation-jobs", make_defaulted_option(prover_options.aggregation_jobs),
+                 "Amount of partial proofs generated concurrently in the 'aggregate' stage, 0 means all of them");
 
             register_output_artifacts_cli_args(prover_options.output_artifacts, config);
         
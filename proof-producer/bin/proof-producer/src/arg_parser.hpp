@@ -18,6 +18,7 @@
 #define PROOF_GENERATOR_ARG_PARSER_HPP
 
 #include <optional>
+#include <ostream>
 #include <string>
 
 #include <boost/filesystem/path.hpp>
@@ -53,6 +54,7 @@ namespace nil {
             boost::filesystem::path evm_verifier_path;
             std::vector<boost::filesystem::path> input_challenge_files;
             std::vector<boost::filesystem::path> partial_proof_files;
+            std::vector<boost::filesystem::path> verify_proof_files;
             std::vector<boost::filesystem::path> initial_proof_files;
             std::vector<boost::filesystem::path> aggregated_proof_files;
             boost::filesystem::path aggregated_FRI_proof_file = "aggregated_FRI_proof.bin";
@@ -63,6 +65,9 @@ namespace nil {
             std::size_t combined_Q_starting_power;
             std::vector<boost::filesystem::path> input_combined_Q_polynomial_files;
             boost::filesystem::path proof_of_work_output_file = "proof_of_work.dat";
+            std::vector<boost::filesystem::path> aggregate_circuit_files;
+            std::vector<boost::filesystem::path> aggregate_assignment_table_files;
+            boost::filesystem::path aggregation_artifacts_dir;
             boost::log::trivial::severity_level log_level = boost::log::trivial::severity_level::info;
             CurvesVariant elliptic_curve_type = type_identity<nil::crypto3::algebra::curves::pallas>{};
             HashesVariant hash_type = type_identity<nil::crypto3::hashes::keccak_1600<256>>{};
@@ -71,10 +76,21 @@ namespace nil {
             std::size_t grind = 0;
             std::size_t expand_factor = 2;
             std::size_t max_quotient_chunks = 0;
+            bool compact_commitment_state = false;
+            std::size_t aggregation_jobs = 0;
+            std::size_t memory_budget_mb = 0;
+            boost::filesystem::path spill_directory;
+            boost::filesystem::path lde_cache_directory;
+            std::size_t lde_cache_limit_mb = 0;
+            boost::filesystem::path trace_output_file;
+            boost::filesystem::path constraint_system_hash_cache_path;
         };
 
         std::optional<ProverOptions> parse_args(int argc, char* argv[]);
 
+        // Writes the command line name of the hash, e.g. "keccak".
+        std::ostream& operator<<(std::ostream& strm, const HashesVariant& variant);
+
     } // namespace proof_generator
 } // namespace nil
 
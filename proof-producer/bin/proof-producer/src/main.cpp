@@ -18,8 +18,16 @@
 //---------------------------------------------------------------------------//
 
 #include <iostream>
+#include <memory>
 #include <optional>
+#include <sstream>
 #include <utility>
+#include <vector>
+
+#include <nil/crypto3/bench/tracer.hpp>
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+#include <nil/actor/core/thread_pool.hpp>
+#endif
 
 #include <arg_parser.hpp>
 #include <nil/proof-generator/file_operations.hpp>
@@ -29,9 +37,41 @@
 
 using namespace nil::proof_generator;
 
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+// Traces thread pool tasks under the name of their pool, so the trace shows the utilization of each pool.
+class pool_task_tracer : public nil::crypto3::ThreadPool::task_observer {
+public:
+    void task_started(const char* pool_name) override {
+        spans().push_back(std::make_unique<nil::crypto3::bench::trace_span>("task", pool_name));
+    }
+
+    void task_finished(const char*) override {
+        spans().pop_back();
+    }
+
+private:
+    static std::vector<std::unique_ptr<nil::crypto3::bench::trace_span>>& spans() {
+        static thread_local std::vector<std::unique_ptr<nil::crypto3::bench::trace_span>> thread_spans;
+        return thread_spans;
+    }
+};
+#endif
+
 template<typename CurveType, typename HashType>
 int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
+    auto& tracer = nil::crypto3::bench::tracer::get_instance();
+    if (!prover_options.trace_output_file.empty()) {
+        tracer.start();
+        tracer.add_metadata("stage", prover_options.stage);
+        tracer.add_metadata("circuit_name", prover_options.circuit_name);
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+        static pool_task_tracer pool_tracer;
+        nil::crypto3::ThreadPool::set_task_observer(&pool_tracer);
+#endif
+    }
+
     auto prover_task = [&] {
+        nil::crypto3::bench::trace_span stage_span("proof-producer stage " + prover_options.stage);
         auto prover = nil::proof_generator::Prover<CurveType, HashType>(
             prover_options.lambda,
             prover_options.expand_factor,
@@ -39,6 +79,17 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
             prover_options.grind,
             prover_options.circuit_name
         );
+        std::ostringstream hash_type_name;
+        hash_type_name << prover_options.hash_type;
+        prover.set_constraint_system_hash_cache(prover_options.constraint_system_hash_cache_path, hash_type_name.str());
+        if (prover_options.memory_budget_mb != 0) {
+            prover.set_memory_budget(prover_options.memory_budget_mb << 20, prover_options.spill_directory);
+        }
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+        if (!prover_options.lde_cache_directory.empty()) {
+            prover.set_lde_cache(prover_options.lde_cache_directory, prover_options.lde_cache_limit_mb << 20);
+        }
+#endif
         bool prover_result;
         try {
             switch (nil::proof_generator::detail::prover_stage_from_string(prover_options.stage)) {
@@ -56,7 +107,8 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                             false/*don't skip verification*/) &&
                         prover.save_preprocessed_common_data_to_file(prover_options.preprocessed_common_data_path) &&
                         prover.save_public_preprocessed_data_to_file(prover_options.preprocessed_public_data_path) &&
-                        prover.save_commitment_state_to_file(prover_options.commitment_scheme_state_path) &&
+                        prover.save_commitment_state_to_file(
+                            prover_options.commitment_scheme_state_path, prover_options.compact_commitment_state) &&
                         prover.print_evm_verifier(prover_options.evm_verifier_path);
                     break;
                 case nil::proof_generator::detail::ProverStage::PRESET:
@@ -86,7 +138,8 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                         prover.preprocess_public_data() &&
                         prover.save_preprocessed_common_data_to_file(prover_options.preprocessed_common_data_path) &&
                         prover.save_public_preprocessed_data_to_file(prover_options.preprocessed_public_data_path) &&
-                        prover.save_commitment_state_to_file(prover_options.commitment_scheme_state_path)&&
+                        prover.save_commitment_state_to_file(
+                            prover_options.commitment_scheme_state_path, prover_options.compact_commitment_state)&&
                         prover.print_evm_verifier(prover_options.evm_verifier_path);
                     break;
                 case nil::proof_generator::detail::ProverStage::PROVE:
@@ -119,14 +172,17 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                             prover_options.proof_file_path,
                             prover_options.challenge_file_path,
                             prover_options.theta_power_file_path) &&
-                        prover.save_commitment_state_to_file(prover_options.updated_commitment_scheme_state_path);
+                        prover.save_commitment_state_to_file(
+                            prover_options.updated_commitment_scheme_state_path, prover_options.compact_commitment_state);
                     break;
                 case nil::proof_generator::detail::ProverStage::VERIFY:
                     prover_result =
                         prover.read_circuit(prover_options.circuit_file_path) &&
                         prover.read_preprocessed_common_data_from_file(prover_options.preprocessed_common_data_path) &&
                         prover.read_assignment_description(prover_options.assignment_description_file_path) &&
-                        prover.verify_from_file(prover_options.proof_file_path);
+                        (prover_options.verify_proof_files.empty() ?
+                            prover.verify_from_file(prover_options.proof_file_path) :
+                            prover.verify_batch_from_files(prover_options.verify_proof_files));
                     break;
                 case nil::proof_generator::detail::ProverStage::GENERATE_AGGREGATED_CHALLENGE:
                     prover_result =
@@ -169,6 +225,16 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                             prover_options.proof_file_path
                             );
                     break;
+                case nil::proof_generator::detail::ProverStage::AGGREGATE:
+                    prover_result =
+                        prover.generate_aggregated_proof_to_file(
+                            prover_options.aggregate_circuit_files,
+                            prover_options.aggregate_assignment_table_files,
+                            prover_options.proof_file_path,
+                            prover_options.aggregation_artifacts_dir.empty() ?
+                                std::nullopt : std::make_optional(prover_options.aggregation_artifacts_dir),
+                            prover_options.aggregation_jobs);
+                    break;
             }
         } catch (const std::exception& e) {
             BOOST_LOG_TRIVIAL(error) << e.what();
@@ -177,7 +243,18 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
         }
         return prover_result ? 0 : 1;
     };
-    return prover_task();
+    int ret = prover_task();
+
+    if (!prover_options.trace_output_file.empty()) {
+        tracer.stop();
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+        nil::crypto3::ThreadPool::set_task_observer(nullptr);
+#endif
+        if (!tracer.write_chrome_trace(prover_options.trace_output_file.string())) {
+            BOOST_LOG_TRIVIAL(error) << "Failed to write trace to " << prover_options.trace_output_file;
+        }
+    }
+    return ret;
 }
 
 // We could either make lambdas for generating Cartesian products of templates,
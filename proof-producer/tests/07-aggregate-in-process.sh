@@ -0,0 +1,17 @@
+#!/bin/sh
+
+CIRCUIT1=fri_array_swap
+CIRCUIT2=merkle_tree_poseidon_cpp_example
+
+echo "Generating aggregated proof in a single process"
+
+bin/proof-producer/proof-producer-multi-threaded \
+    --stage aggregate \
+    --grind-param 16 \
+    --max-quotient-chunks 10 \
+    --aggregate-circuits          circuits-and-assignments/$CIRCUIT1/circuit.crct \
+                                  circuits-and-assignments/$CIRCUIT2/circuit.crct \
+    --aggregate-assignment-tables circuits-and-assignments/$CIRCUIT1/assignment.tbl \
+                                  circuits-and-assignments/$CIRCUIT2/assignment.tbl \
+    --aggregation-artifacts-dir   aggregation-artifacts \
+    --proof                       final-proof-in-process.dat
@@ -33,5 +33,8 @@ echo "[33;1m === STAGE 05 === [0m"
 echo "[33;1m === STAGE 06 === [0m"
 ./06-merge-proofs.sh
 
+echo "[33;1m === STAGE 07 === [0m"
+./07-aggregate-in-process.sh
+
 
 
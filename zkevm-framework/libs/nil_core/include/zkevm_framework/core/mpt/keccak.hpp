@@ -0,0 +1,19 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_KECCAK_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_KECCAK_HPP_
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace core {
+    namespace mpt {
+
+        constexpr std::size_t kKeccakHashSize = 32;
+
+        // Keccak-256 as used by Ethereum (original padding, not SHA3-256), computed by crypto3.
+        std::array<std::byte, kKeccakHashSize> Keccak256(std::span<const std::byte> data);
+
+    }  // namespace mpt
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_KECCAK_HPP_
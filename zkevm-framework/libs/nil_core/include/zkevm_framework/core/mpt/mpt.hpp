@@ -4,21 +4,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
-#include <unordered_map>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "zkevm_framework/core/mpt/node.hpp"
-
-namespace std {
-    // To allow using vector of bytes as key in unordered_map
-    template<>
-    struct hash<vector<byte>> {
-        size_t operator()(const vector<byte>& v) const {
-            return hash<string_view>()(
-                string_view(reinterpret_cast<const char*>(v.data()), v.size()));
-        }
-    };
-}  // namespace std
+#include "zkevm_framework/core/mpt/node_storage.hpp"
 
 namespace core {
     namespace mpt {
@@ -32,11 +23,42 @@ namespace core {
 
         class MerklePatriciaTrie {
           public:
+            // Key and new value of an update, std::nullopt removes the key.
+            using Update = std::pair<std::vector<std::byte>, std::optional<std::vector<std::byte>>>;
+
             MerklePatriciaTrie();
+            // Opens the trie with the given root in an existing storage.
+            explicit MerklePatriciaTrie(std::shared_ptr<NodeStorage> storage, Reference root = {});
+
             std::vector<std::byte> get(const std::vector<std::byte>& key) const;
             void set(const std::vector<std::byte>& key, const std::vector<std::byte>& value);
             void remove(const std::vector<std::byte>& key);
 
+            /**
+             * @brief Starts buffering updates.
+             *
+             * Until commit_batch() nodes touched by set() and remove() are kept unhashed in memory
+             * and get() sees the buffered values. Nothing is written to the storage.
+             */
+            void begin_batch();
+            /**
+             * @brief Hashes the nodes reachable from the new root and writes them to the storage.
+             *
+             * Nodes replaced during the batch are dropped without being hashed. The remaining ones
+             * are hashed level by level from the leaves up, each level by up to `threads` threads
+             * (hardware concurrency if 0).
+             */
+            void commit_batch(std::size_t threads = 0);
+            // Drops the buffered updates and restores the root the batch was started with.
+            void abort_batch();
+            bool in_batch() const;
+
+            // Applies the updates in order as one batch. On error the trie is left unchanged.
+            void apply_batch(const std::vector<Update>& updates, std::size_t threads = 0);
+
+            // Reference of the root node, empty for an empty trie.
+            const Reference& root() const;
+
           protected:
             Node GetFromStorage(const Reference& ref) const;
             Reference PutToStorage(const Node& node);
@@ -50,9 +72,18 @@ namespace core {
             static Path PathFromKey(const std::vector<std::byte>& key);
             static constexpr size_t kMaxRawKeyLen = 32;
 
+            // Height of the pending node over the pending leaves of its subtree. Adds the nodes
+            // of the subtree to `levels` by height.
+            std::size_t CollectPendingLevels(std::size_t index, std::vector<std::size_t>& heights,
+                                             std::vector<std::vector<std::size_t>>& levels) const;
+
             Reference root_;
-            std::unordered_map<Reference, std::vector<std::byte>>
-                nodes_;  // Better design is to use other external class for storage
+            std::shared_ptr<NodeStorage> storage_;
+
+            bool batch_ = false;
+            Reference batch_root_;
+            // Nodes created during the batch, referenced by their index until commit.
+            std::vector<Node> pending_;
 
             friend class details::GetHandler;
             friend class details::SetHandler;
@@ -0,0 +1,106 @@
+#ifndef ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_NODE_STORAGE_HPP_
+#define ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_NODE_STORAGE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "zkevm_framework/core/mpt/node.hpp"
+
+namespace std {
+    // To allow using vector of bytes as key in unordered_map
+    template<>
+    struct hash<vector<byte>> {
+        size_t operator()(const vector<byte>& v) const {
+            return hash<string_view>()(
+                string_view(reinterpret_cast<const char*>(v.data()), v.size()));
+        }
+    };
+}  // namespace std
+
+namespace core {
+    namespace mpt {
+
+        // Content-addressed storage of encoded trie nodes, keyed by node hash.
+        class NodeStorage {
+          public:
+            virtual ~NodeStorage() = default;
+
+            virtual std::optional<Bytes> Get(const Reference& key) const = 0;
+            virtual void Put(const Reference& key, const Bytes& value) = 0;
+
+            // Stores all the entries at once, backends may override it to write them in one go.
+            virtual void PutBatch(const std::vector<std::pair<Reference, Bytes>>& entries) {
+                for (const auto& [key, value] : entries) {
+                    Put(key, value);
+                }
+            }
+
+            // Makes the stored nodes durable, no-op for volatile backends.
+            virtual void Flush() {}
+        };
+
+        class InMemoryNodeStorage : public NodeStorage {
+          public:
+            std::optional<Bytes> Get(const Reference& key) const override;
+            void Put(const Reference& key, const Bytes& value) override;
+
+            std::size_t size() const;
+
+          private:
+            std::unordered_map<Reference, Bytes> nodes_;
+        };
+
+        /**
+         * @brief Append-only node log on disk.
+         *
+         * Nodes are appended to the file as `[key size: u32][value size: u32][key][value]` records
+         * and read back through a read-only memory mapping, so only the key index stays resident.
+         * The index is rebuilt by scanning the file on open; an incomplete record at the end of the
+         * file (interrupted write) is cut off.
+         */
+        class AppendOnlyFileNodeStorage : public NodeStorage {
+          public:
+            explicit AppendOnlyFileNodeStorage(const std::string& path);
+            ~AppendOnlyFileNodeStorage() override;
+
+            AppendOnlyFileNodeStorage(const AppendOnlyFileNodeStorage&) = delete;
+            AppendOnlyFileNodeStorage& operator=(const AppendOnlyFileNodeStorage&) = delete;
+
+            std::optional<Bytes> Get(const Reference& key) const override;
+            void Put(const Reference& key, const Bytes& value) override;
+            void PutBatch(const std::vector<std::pair<Reference, Bytes>>& entries) override;
+            void Flush() override;
+
+            std::size_t size() const;
+
+          private:
+            struct Location {
+                std::uint64_t offset;
+                std::uint32_t size;
+            };
+
+            void LoadIndex();
+            void AppendRecords(const std::vector<std::pair<const Reference*, const Bytes*>>& records);
+            // Maps the file up to its current end. Must be called with mutex_ held.
+            void Remap() const;
+
+            int fd_ = -1;
+            std::uint64_t file_size_ = 0;
+            std::unordered_map<Reference, Location> index_;
+
+            mutable std::mutex mutex_;
+            mutable const std::byte* mapping_ = nullptr;
+            mutable std::uint64_t mapped_size_ = 0;
+        };
+
+    }  // namespace mpt
+}  // namespace core
+
+#endif  // ZKEMV_FRAMEWORK_LIBS_NIL_CORE_INCLUDE_ZKEVM_FRAMEWORK_CORE_MPT_NODE_STORAGE_HPP_
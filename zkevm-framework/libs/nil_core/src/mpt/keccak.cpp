@@ -0,0 +1,28 @@
+#include "zkevm_framework/core/mpt/keccak.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+namespace core {
+    namespace mpt {
+
+        std::array<std::byte, kKeccakHashSize> Keccak256(std::span<const std::byte> data) {
+            using HashType = nil::crypto3::hashes::keccak_1600<256>;
+            static_assert(std::tuple_size_v<typename HashType::digest_type> == kKeccakHashSize);
+
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(data.data());
+            typename HashType::digest_type digest =
+                nil::crypto3::hash<HashType>(bytes, bytes + data.size());
+
+            std::array<std::byte, kKeccakHashSize> result;
+            std::transform(digest.begin(), digest.end(), result.begin(),
+                           [](std::uint8_t byte) { return std::byte{byte}; });
+            return result;
+        }
+
+    }  // namespace mpt
+}  // namespace core
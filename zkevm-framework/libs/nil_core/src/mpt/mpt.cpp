@@ -1,5 +1,16 @@
 #include "zkevm_framework/core/mpt/mpt.hpp"
 
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+#include "zkevm_framework/core/mpt/keccak.hpp"
+
 namespace core {
     namespace mpt {
         namespace details {
@@ -389,29 +400,155 @@ namespace core {
             };
         }  // namespace details
 
-        // Crypto3 compiles so slow... Use this dummy hash for testing.
-        //   Hash we are going to use is still willing to change anyway
-        std::array<std::byte, 64> BasicHash(const std::vector<std::byte>& key) {
-            std::array<std::byte, 64> result = {std::byte{0}};
+        namespace {
+            // References to pending nodes are longer than any real reference (an inlined node is
+            // shorter than a hash), so they can't be confused with them.
+            constexpr std::size_t kPendingReferenceSize = kKeccakHashSize + 1;
+            constexpr std::byte kPendingReferenceTag{0xFF};
+
+            // Levels smaller than this are hashed by the calling thread.
+            constexpr std::size_t kMinParallelLevelSize = 64;
 
-            for (size_t i = 0; i < key.size(); ++i) {
-                result[i % 64] ^= key[i];
+            Reference MakePendingReference(std::size_t index) {
+                Reference ref(kPendingReferenceSize, std::byte{0});
+                ref[0] = kPendingReferenceTag;
+                for (std::size_t i = 0; i < sizeof(std::uint64_t); ++i) {
+                    ref[i + 1] = static_cast<std::byte>(static_cast<std::uint64_t>(index) >> (8 * i));
+                }
+                return ref;
             }
 
-            for (size_t i = 0; i < 64; ++i) {
-                result[i] ^= result[(i + 1) % 64];
-                result[i] = (result[i] << 1) | (result[i] >> 7);
+            bool IsPendingReference(const Reference& ref) {
+                return ref.size() == kPendingReferenceSize && ref[0] == kPendingReferenceTag;
             }
 
-            return result;
-        }
+            std::size_t PendingIndex(const Reference& ref) {
+                std::uint64_t index = 0;
+                for (std::size_t i = 0; i < sizeof(std::uint64_t); ++i) {
+                    index |= std::to_integer<std::uint64_t>(ref[i + 1]) << (8 * i);
+                }
+                return index;
+            }
+
+            Bytes EncodeNode(const Node& node) {
+                return std::visit([](const auto& n) { return n.Encode(); }, node);
+            }
+
+            // Threads shared by all the tries of the process and started on first use, so hashing a
+            // level costs a wake-up of the workers rather than starting new threads.
+            class WorkerPool {
+              public:
+                static WorkerPool& Instance() {
+                    static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()));
+                    return pool;
+                }
+
+                WorkerPool(const WorkerPool&) = delete;
+                WorkerPool& operator=(const WorkerPool&) = delete;
+
+                ~WorkerPool() {
+                    {
+                        std::lock_guard lock(mutex_);
+                        stopping_ = true;
+                    }
+                    condition_.notify_all();
+                }
+
+                void Submit(std::function<void()> task) {
+                    {
+                        std::lock_guard lock(mutex_);
+                        tasks_.push(std::move(task));
+                    }
+                    condition_.notify_one();
+                }
+
+              private:
+                explicit WorkerPool(std::size_t size) {
+                    workers_.reserve(size);
+                    for (std::size_t i = 0; i < size; ++i) {
+                        workers_.emplace_back([this] { Run(); });
+                    }
+                }
 
-        MerklePatriciaTrie::MerklePatriciaTrie(){};
+                void Run() {
+                    while (true) {
+                        std::function<void()> task;
+                        {
+                            std::unique_lock lock(mutex_);
+                            condition_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                            if (tasks_.empty()) {
+                                return;
+                            }
+                            task = std::move(tasks_.front());
+                            tasks_.pop();
+                        }
+                        task();
+                    }
+                }
+
+                std::mutex mutex_;
+                std::condition_variable condition_;
+                std::queue<std::function<void()>> tasks_;
+                bool stopping_ = false;
+                // Declared last, so the workers are joined before the queue is destroyed.
+                std::vector<std::jthread> workers_;
+            };
+
+            // Runs func(i) for i in [0, size) in up to `threads` chunks. The calling thread runs the
+            // first chunk, the workers of the pool run the others.
+            template<typename Func>
+            void ParallelFor(std::size_t size, std::size_t threads, const Func& func) {
+                threads = std::min(threads, (size + kMinParallelLevelSize - 1) / kMinParallelLevelSize);
+                if (threads <= 1) {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        func(i);
+                    }
+                    return;
+                }
+
+                std::vector<std::exception_ptr> errors(threads);
+                auto run_chunk = [&](std::size_t t) {
+                    try {
+                        for (std::size_t i = size * t / threads; i < size * (t + 1) / threads; ++i) {
+                            func(i);
+                        }
+                    } catch (...) {
+                        errors[t] = std::current_exception();
+                    }
+                };
+
+                std::latch done(threads - 1);
+                for (std::size_t t = 1; t < threads; ++t) {
+                    WorkerPool::Instance().Submit([&, t] {
+                        run_chunk(t);
+                        done.count_down();
+                    });
+                }
+                run_chunk(0);
+                done.wait();
+
+                for (const auto& error : errors) {
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+        }  // namespace
+
+        MerklePatriciaTrie::MerklePatriciaTrie()
+            : storage_(std::make_shared<InMemoryNodeStorage>()) {}
+
+        MerklePatriciaTrie::MerklePatriciaTrie(std::shared_ptr<NodeStorage> storage, Reference root)
+            : root_(std::move(root)), storage_(std::move(storage)) {
+            if (!storage_) {
+                throw std::invalid_argument("MPT storage is not set");
+            }
+        }
 
         Path MerklePatriciaTrie::PathFromKey(const std::vector<std::byte>& key) {
             std::vector<std::byte> hash_result;
             if (key.size() > kMaxRawKeyLen) {
-                auto hash_array = BasicHash(key);
+                auto hash_array = Keccak256(key);
                 hash_result = std::vector<std::byte>(hash_array.begin(), hash_array.end());
             } else {
                 hash_result = key;
@@ -457,6 +594,7 @@ namespace core {
             switch (result.action) {
                 case details::DeleteAction::Deleted: {
                     root_.clear();
+                    return;
                 }
                 case details::DeleteAction::Updated: {
                 }
@@ -477,25 +615,33 @@ namespace core {
         }
 
         Node MerklePatriciaTrie::GetFromStorage(const Reference& ref) const {
-            if (ref.size() < 32) {
+            if (IsPendingReference(ref)) {
+                return pending_.at(PendingIndex(ref));
+            }
+            if (ref.size() < kKeccakHashSize) {
                 return DecodeNode(ref);
             }
-            auto it = nodes_.find(ref);
-            if (it == nodes_.end()) {
+            auto encoded = storage_->Get(ref);
+            if (!encoded) {
                 throw std::runtime_error("Node not found");
             }
 
-            return DecodeNode(it->second);
+            return DecodeNode(*encoded);
         }
 
         Reference MerklePatriciaTrie::PutToStorage(const Node& node) {
-            Bytes encoded = std::visit([](const auto& n) { return n.Encode(); }, node);
-            if (encoded.size() < 32) {
+            if (batch_) {
+                pending_.push_back(node);
+                return MakePendingReference(pending_.size() - 1);
+            }
+
+            Bytes encoded = EncodeNode(node);
+            if (encoded.size() < kKeccakHashSize) {
                 return encoded;
             }
-            auto key_arr = BasicHash(encoded);
+            auto key_arr = Keccak256(encoded);
             Bytes key(key_arr.begin(), key_arr.end());
-            nodes_[key] = encoded;
+            storage_->Put(key, encoded);
             return key;
         }
 
@@ -509,5 +655,149 @@ namespace core {
             return std::visit(details::SetHandler(*this, path, value), node);
         }
 
+        void MerklePatriciaTrie::begin_batch() {
+            if (batch_) {
+                throw std::runtime_error("MPT batch is already started");
+            }
+            batch_ = true;
+            batch_root_ = root_;
+        }
+
+        void MerklePatriciaTrie::abort_batch() {
+            if (!batch_) {
+                return;
+            }
+            root_ = std::move(batch_root_);
+            batch_root_.clear();
+            pending_.clear();
+            batch_ = false;
+        }
+
+        bool MerklePatriciaTrie::in_batch() const { return batch_; }
+
+        const Reference& MerklePatriciaTrie::root() const { return root_; }
+
+        std::size_t MerklePatriciaTrie::CollectPendingLevels(
+            std::size_t index, std::vector<std::size_t>& heights,
+            std::vector<std::vector<std::size_t>>& levels) const {
+            constexpr std::size_t kNotVisited = static_cast<std::size_t>(-1);
+            if (heights[index] != kNotVisited) {
+                return heights[index];
+            }
+
+            std::size_t height = 0;
+            auto visit_child = [&](const Reference& child) {
+                if (IsPendingReference(child)) {
+                    height = std::max(height,
+                                      CollectPendingLevels(PendingIndex(child), heights, levels) + 1);
+                }
+            };
+            std::visit(details::overloaded{
+                           [](const LeafNode&) {},
+                           [&](const ExtensionNode& extension_node) {
+                               visit_child(extension_node.get_next_ref());
+                           },
+                           [&](const BranchNode& branch_node) {
+                               for (const auto& branch : branch_node.get_branches()) {
+                                   visit_child(branch);
+                               }
+                           }},
+                       pending_[index]);
+
+            heights[index] = height;
+            if (levels.size() <= height) {
+                levels.resize(height + 1);
+            }
+            levels[height].push_back(index);
+            return height;
+        }
+
+        void MerklePatriciaTrie::commit_batch(std::size_t threads) {
+            if (!batch_) {
+                throw std::runtime_error("MPT batch is not started");
+            }
+            if (threads == 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            std::vector<std::size_t> heights(pending_.size(), static_cast<std::size_t>(-1));
+            std::vector<std::vector<std::size_t>> levels;
+            if (IsPendingReference(root_)) {
+                CollectPendingLevels(PendingIndex(root_), heights, levels);
+            }
+
+            // Children of a node are on lower levels, so their references are final when the
+            // node is encoded.
+            std::vector<Reference> resolved(pending_.size());
+            auto resolve = [&resolved](const Reference& ref) -> const Reference& {
+                return IsPendingReference(ref) ? resolved[PendingIndex(ref)] : ref;
+            };
+
+            std::vector<std::pair<Reference, Bytes>> hashed_nodes;
+            for (const auto& level : levels) {
+                std::vector<std::optional<std::pair<Reference, Bytes>>> level_nodes(level.size());
+                ParallelFor(level.size(), threads, [&](std::size_t i) {
+                    const std::size_t index = level[i];
+                    Bytes encoded = std::visit(
+                        details::overloaded{
+                            [](const LeafNode& leaf) { return leaf.Encode(); },
+                            [&](const ExtensionNode& extension_node) {
+                                return ExtensionNode{extension_node.path,
+                                                     resolve(extension_node.get_next_ref())}
+                                    .Encode();
+                            },
+                            [&](const BranchNode& branch_node) {
+                                auto branches = branch_node.get_branches();
+                                for (auto& branch : branches) {
+                                    branch = resolve(branch);
+                                }
+                                return BranchNode{branches, branch_node.value()}.Encode();
+                            }},
+                        pending_[index]);
+
+                    if (encoded.size() < kKeccakHashSize) {
+                        resolved[index] = std::move(encoded);
+                        return;
+                    }
+                    auto key_arr = Keccak256(encoded);
+                    resolved[index] = Reference(key_arr.begin(), key_arr.end());
+                    level_nodes[i].emplace(resolved[index], std::move(encoded));
+                });
+
+                for (auto& node : level_nodes) {
+                    if (node) {
+                        hashed_nodes.push_back(std::move(*node));
+                    }
+                }
+            }
+
+            storage_->PutBatch(hashed_nodes);
+
+            if (IsPendingReference(root_)) {
+                root_ = std::move(resolved[PendingIndex(root_)]);
+            }
+            batch_root_.clear();
+            pending_.clear();
+            batch_ = false;
+        }
+
+        void MerklePatriciaTrie::apply_batch(const std::vector<Update>& updates,
+                                             std::size_t threads) {
+            begin_batch();
+            try {
+                for (const auto& [key, value] : updates) {
+                    if (value) {
+                        set(key, *value);
+                    } else {
+                        remove(key);
+                    }
+                }
+            } catch (...) {
+                abort_batch();
+                throw;
+            }
+            commit_batch(threads);
+        }
+
     }  // namespace mpt
 }  // namespace core
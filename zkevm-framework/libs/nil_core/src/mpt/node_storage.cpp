@@ -0,0 +1,208 @@
+#include "zkevm_framework/core/mpt/node_storage.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace core {
+    namespace mpt {
+
+        namespace {
+            constexpr std::size_t kRecordHeaderSize = 2 * sizeof(std::uint32_t);
+
+            std::runtime_error SystemError(const std::string& what) {
+                return std::runtime_error(what + ": " + std::strerror(errno));
+            }
+
+            void AppendU32(std::vector<std::byte>& buffer, std::uint32_t value) {
+                for (std::size_t i = 0; i < sizeof(value); ++i) {
+                    buffer.push_back(static_cast<std::byte>(value >> (8 * i)));
+                }
+            }
+
+            std::uint32_t ReadU32(const std::byte* data) {
+                std::uint32_t value = 0;
+                for (std::size_t i = 0; i < sizeof(value); ++i) {
+                    value |= static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data[i]))
+                             << (8 * i);
+                }
+                return value;
+            }
+        }  // namespace
+
+        std::optional<Bytes> InMemoryNodeStorage::Get(const Reference& key) const {
+            auto it = nodes_.find(key);
+            if (it == nodes_.end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+        void InMemoryNodeStorage::Put(const Reference& key, const Bytes& value) {
+            nodes_[key] = value;
+        }
+
+        std::size_t InMemoryNodeStorage::size() const { return nodes_.size(); }
+
+        AppendOnlyFileNodeStorage::AppendOnlyFileNodeStorage(const std::string& path) {
+            fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (fd_ == -1) {
+                throw SystemError("Can't open node storage " + path);
+            }
+            try {
+                LoadIndex();
+            } catch (...) {
+                ::close(fd_);
+                throw;
+            }
+        }
+
+        AppendOnlyFileNodeStorage::~AppendOnlyFileNodeStorage() {
+            if (mapping_ != nullptr) {
+                ::munmap(const_cast<std::byte*>(mapping_), mapped_size_);
+            }
+            if (fd_ != -1) {
+                ::close(fd_);
+            }
+        }
+
+        void AppendOnlyFileNodeStorage::LoadIndex() {
+            struct stat st;
+            if (::fstat(fd_, &st) != 0) {
+                throw SystemError("Can't stat node storage");
+            }
+            file_size_ = st.st_size;
+            if (file_size_ == 0) {
+                return;
+            }
+
+            Remap();
+            std::uint64_t offset = 0;
+            while (offset + kRecordHeaderSize <= file_size_) {
+                const std::uint32_t key_size = ReadU32(mapping_ + offset);
+                const std::uint32_t value_size = ReadU32(mapping_ + offset + sizeof(std::uint32_t));
+                const std::uint64_t record_end = offset + kRecordHeaderSize + key_size + value_size;
+                if (record_end > file_size_) {
+                    break;
+                }
+                const std::byte* key = mapping_ + offset + kRecordHeaderSize;
+                index_[Reference(key, key + key_size)] =
+                    Location{offset + kRecordHeaderSize + key_size, value_size};
+                offset = record_end;
+            }
+
+            if (offset != file_size_) {
+                if (::ftruncate(fd_, offset) != 0) {
+                    throw SystemError("Can't drop incomplete node storage record");
+                }
+                file_size_ = offset;
+            }
+        }
+
+        void AppendOnlyFileNodeStorage::Remap() const {
+            if (mapping_ != nullptr) {
+                ::munmap(const_cast<std::byte*>(mapping_), mapped_size_);
+                mapping_ = nullptr;
+                mapped_size_ = 0;
+            }
+            if (file_size_ == 0) {
+                return;
+            }
+            void* data = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd_, 0);
+            if (data == MAP_FAILED) {
+                throw SystemError("Can't map node storage");
+            }
+            mapping_ = static_cast<const std::byte*>(data);
+            mapped_size_ = file_size_;
+        }
+
+        std::optional<Bytes> AppendOnlyFileNodeStorage::Get(const Reference& key) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(key);
+            if (it == index_.end()) {
+                return std::nullopt;
+            }
+            const auto& location = it->second;
+            if (location.offset + location.size > mapped_size_) {
+                Remap();
+            }
+            return Bytes(mapping_ + location.offset, mapping_ + location.offset + location.size);
+        }
+
+        void AppendOnlyFileNodeStorage::Put(const Reference& key, const Bytes& value) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            AppendRecords({{&key, &value}});
+        }
+
+        void AppendOnlyFileNodeStorage::PutBatch(
+            const std::vector<std::pair<Reference, Bytes>>& entries) {
+            std::vector<std::pair<const Reference*, const Bytes*>> records;
+            records.reserve(entries.size());
+            for (const auto& [key, value] : entries) {
+                records.emplace_back(&key, &value);
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            AppendRecords(records);
+        }
+
+        void AppendOnlyFileNodeStorage::AppendRecords(
+            const std::vector<std::pair<const Reference*, const Bytes*>>& records) {
+            // Nodes are content-addressed, so a key that is already stored has the same value.
+            std::vector<std::byte> buffer;
+            std::vector<std::pair<const Reference*, Location>> added;
+            for (const auto& [key, value] : records) {
+                if (index_.contains(*key)) {
+                    continue;
+                }
+                AppendU32(buffer, static_cast<std::uint32_t>(key->size()));
+                AppendU32(buffer, static_cast<std::uint32_t>(value->size()));
+                buffer.insert(buffer.end(), key->begin(), key->end());
+                const std::uint64_t value_offset = file_size_ + buffer.size();
+                buffer.insert(buffer.end(), value->begin(), value->end());
+                added.emplace_back(key, Location{value_offset, static_cast<std::uint32_t>(value->size())});
+            }
+            if (buffer.empty()) {
+                return;
+            }
+
+            std::size_t written = 0;
+            while (written < buffer.size()) {
+                const auto result = ::pwrite(fd_, buffer.data() + written, buffer.size() - written,
+                                             file_size_ + written);
+                if (result < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    // Cut off the partially written records, they are not in the index yet. If it
+                    // fails too, the incomplete tail is dropped on the next open.
+                    [[maybe_unused]] auto truncated = ::ftruncate(fd_, file_size_);
+                    throw SystemError("Can't write node storage");
+                }
+                written += result;
+            }
+            file_size_ += buffer.size();
+
+            for (const auto& [key, location] : added) {
+                index_.emplace(*key, location);
+            }
+        }
+
+        void AppendOnlyFileNodeStorage::Flush() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (::fdatasync(fd_) != 0) {
+                throw SystemError("Can't sync node storage");
+            }
+        }
+
+        std::size_t AppendOnlyFileNodeStorage::size() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return index_.size();
+        }
+
+    }  // namespace mpt
+}  // namespace core
@@ -1,9 +1,15 @@
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "ssz++.hpp"
+#include "zkevm_framework/core/mpt/keccak.hpp"
 #include "zkevm_framework/core/mpt/mpt.hpp"
 
 using namespace core;
@@ -120,3 +126,105 @@ TEST(NilCoreMerklePatriciaTrieTest, TestDelete) {
     ASSERT_NO_THROW(trie.get(stringToByteVector("dog")));    // Can access existing
     ASSERT_NO_THROW(trie.get(stringToByteVector("horse")));  // Can access existing
 }
+
+TEST(NilCoreMerklePatriciaTrieTest, Keccak256) {
+    auto hash = Keccak256(stringToByteVector("abc"));
+    std::vector<std::byte> expected;
+    for (std::uint8_t b : {0x4e, 0x03, 0x65, 0x7a, 0xea, 0x45, 0xa9, 0x4f, 0xc7, 0xd4, 0x7b,
+                           0xa8, 0x26, 0xc8, 0xd6, 0x67, 0xc0, 0xd1, 0xe6, 0xe3, 0x3a, 0x64,
+                           0xa0, 0x36, 0xec, 0x44, 0xf5, 0x8f, 0xa1, 0x2d, 0x6c, 0x45}) {
+        expected.push_back(std::byte{b});
+    }
+    ASSERT_EQ(std::vector<std::byte>(hash.begin(), hash.end()), expected);
+}
+
+// Hashed keys, as in the state trie
+std::vector<MerklePatriciaTrie::Update> makeUpdates(std::size_t count) {
+    std::vector<MerklePatriciaTrie::Update> updates;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto key = Keccak256(stringToByteVector("key" + std::to_string(i)));
+        updates.emplace_back(std::vector<std::byte>(key.begin(), key.end()),
+                             stringToByteVector("value" + std::to_string(i)));
+    }
+    return updates;
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, BatchMatchesSequential) {
+    auto updates = makeUpdates(2000);
+    // Overwrite and remove some of the keys inside the same batch
+    for (std::size_t i = 0; i < 2000; i += 5) {
+        updates.emplace_back(updates[i].first, stringToByteVector("updated"));
+    }
+    for (std::size_t i = 1; i < 2000; i += 5) {
+        updates.emplace_back(updates[i].first, std::nullopt);
+    }
+
+    MerklePatriciaTrie sequential;
+    for (const auto& [key, value] : updates) {
+        if (value) {
+            sequential.set(key, *value);
+        } else {
+            sequential.remove(key);
+        }
+    }
+
+    for (std::size_t threads : {1, 4}) {
+        MerklePatriciaTrie batched;
+        batched.apply_batch(updates, threads);
+        ASSERT_FALSE(batched.in_batch());
+        ASSERT_EQ(batched.root(), sequential.root());
+        ASSERT_EQ(batched.get(updates[0].first), stringToByteVector("updated"));
+        ASSERT_ANY_THROW(batched.get(updates[1].first));
+        ASSERT_EQ(batched.get(updates[2].first), stringToByteVector("value2"));
+    }
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, BatchReadsAndAbort) {
+    MerklePatriciaTrie trie;
+    trie.set(stringToByteVector("dog"), stringToByteVector("puppy"));
+    const auto root = trie.root();
+
+    trie.begin_batch();
+    trie.set(stringToByteVector("doge"), stringToByteVector("coin"));
+    ASSERT_EQ(trie.get(stringToByteVector("doge")), stringToByteVector("coin"));
+    trie.abort_batch();
+
+    ASSERT_EQ(trie.root(), root);
+    ASSERT_ANY_THROW(trie.get(stringToByteVector("doge")));
+
+    // A failed update leaves the trie unchanged
+    ASSERT_ANY_THROW(trie.apply_batch({{stringToByteVector("horse"), stringToByteVector("x")},
+                                       {stringToByteVector("cat"), std::nullopt}}));
+    ASSERT_EQ(trie.root(), root);
+}
+
+TEST(NilCoreMerklePatriciaTrieTest, AppendOnlyFileStorage) {
+    // A unique file per run, so concurrent runs don't share the storage, removed on any exit.
+    const auto path = (std::filesystem::temp_directory_path() /
+                       ("nil_core_mpt_storage_test_" + std::to_string(std::random_device()()) + ".bin"))
+                          .string();
+    struct RemoveFile {
+        std::string path;
+        ~RemoveFile() { std::filesystem::remove(path); }
+    } remove_file{path};
+
+    const auto updates = makeUpdates(500);
+    Reference root;
+    {
+        auto storage = std::make_shared<AppendOnlyFileNodeStorage>(path);
+        MerklePatriciaTrie trie(storage);
+        trie.apply_batch(updates);
+        storage->Flush();
+        root = trie.root();
+    }
+
+    // Reopen the trie from the file
+    auto storage = std::make_shared<AppendOnlyFileNodeStorage>(path);
+    MerklePatriciaTrie trie(storage, root);
+    for (const auto& [key, value] : updates) {
+        ASSERT_EQ(trie.get(key), *value);
+    }
+
+    trie.set(stringToByteVector("key-new"), stringToByteVector("new"));
+    ASSERT_EQ(trie.get(stringToByteVector("key-new")), stringToByteVector("new"));
+}